@@ -0,0 +1,182 @@
+/**
+ * Identification of an unknown FIR system by the adaptive filters, built once
+ * against the scalar library (adaptive_bench_scalar) and once against the
+ * ARM_MATH_X86_SIMD one (adaptive_bench_x86simd): arm_lms_f32,
+ * arm_lms_norm_f32, the block LMS arm_lms_block_f32, the frequency-domain
+ * arm_lms_fd_f32 and the RLS arm_rls_f32, for 16 to 1024 taps (RLS up to 128),
+ * each call processing numTaps samples.
+ *
+ * The input is a coloured noise, white noise through a first order low-pass
+ * filter with a pole at 0.9, whose spread of eigenvalues slows down the LMS
+ * filters; the reference is the output of the system plus a white noise 60 dB
+ * below it. misalignment_db is the power of the coefficient error over the
+ * power of the system after NUM_SAMPLES samples, and after a quarter of them.
+ *
+ * Output: method;numTaps;ns_per_sample;misalignment_quarter_db;misalignment_db
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+#include "arm_math.h"
+
+static constexpr double MIN_SECONDS = 0.05; // Timing of each method
+static constexpr uint32_t NUM_SAMPLES = 65536;
+static constexpr double POLE = 0.9;         // Colour of the input
+static constexpr uint16_t MAX_RLS_TAPS = 128;
+
+static std::mt19937 rng(29);
+
+// Nanoseconds per call of fn
+static double timeCall(const std::function<void()> &fn)
+{
+    long calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        fn();
+        calls++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+    return elapsed * 1e9 / static_cast<double>(calls);
+}
+
+// Coefficient error over the system, in dB
+static double misalignment(const std::vector<float32_t> &coeffs, const std::vector<float32_t> &system)
+{
+    double error = 0.0, power = 0.0;
+    for (std::size_t k = 0; k < system.size(); k++)
+    {
+        error += (coeffs[k] - system[k]) * (coeffs[k] - system[k]);
+        power += system[k] * system[k];
+    }
+    return 10.0 * std::log10(error / power);
+}
+
+// Runs process(x, d, y, e) on blocks of numTaps samples, from the initialization done by init()
+static void run(const char *method, uint16_t numTaps, const std::vector<float32_t> &input,
+                const std::vector<float32_t> &reference, const std::vector<float32_t> &system,
+                std::vector<float32_t> &coeffs, const std::function<void()> &init,
+                const std::function<void(const float32_t *, const float32_t *, float32_t *, float32_t *)> &process)
+{
+    std::vector<float32_t> output(numTaps), error(numTaps);
+    double quarter = 0.0;
+    auto all = [&](bool measure) {
+        std::fill(coeffs.begin(), coeffs.end(), 0.0f);
+        init();
+        for (uint32_t n = 0; n < NUM_SAMPLES; n += numTaps)
+        {
+            process(input.data() + n, reference.data() + n, output.data(), error.data());
+            if (measure && n + numTaps == NUM_SAMPLES / 4)
+            {
+                quarter = misalignment(coeffs, system);
+            }
+        }
+    };
+    double ns = timeCall([&] { all(false); });
+    all(true);
+    std::printf("%s;%u;%.2f;%.1f;%.1f\n", method, static_cast<unsigned>(numTaps), ns / NUM_SAMPLES, quarter,
+                misalignment(coeffs, system));
+}
+
+int main()
+{
+#if defined(ARM_MATH_X86_AVX2)
+    std::printf("# ARM_MATH_X86_SIMD, AVX2\n");
+#elif defined(ARM_MATH_X86_SIMD)
+    std::printf("# ARM_MATH_X86_SIMD, SSE4.2\n");
+#else
+    std::printf("# scalar\n");
+#endif
+    std::printf("method;numTaps;ns_per_sample;misalignment_quarter_db;misalignment_db\n");
+
+    std::normal_distribution<double> gauss(0.0, 1.0);
+
+    // Unit power coloured input
+    std::vector<float32_t> input(NUM_SAMPLES);
+    double lowPass = 0.0;
+    for (auto &x : input)
+    {
+        lowPass = POLE * lowPass + std::sqrt(1.0 - POLE * POLE) * gauss(rng);
+        x = static_cast<float32_t>(lowPass);
+    }
+
+    const uint16_t tapCounts[] = {16, 32, 64, 128, 256, 512, 1024};
+    for (uint16_t numTaps : tapCounts)
+    {
+        // Decaying random impulse response, in time reversed order as the adaptive coefficients
+        std::vector<float32_t> system(numTaps);
+        for (uint16_t k = 0; k < numTaps; k++)
+        {
+            system[numTaps - 1U - k] = static_cast<float32_t>(gauss(rng) * std::exp(-4.0 * k / numTaps));
+        }
+
+        std::vector<float32_t> reference(NUM_SAMPLES);
+        double power = 0.0;
+        for (uint32_t n = 0; n < NUM_SAMPLES; n++)
+        {
+            double acc = 0.0;
+            for (uint16_t k = 0; k < numTaps && k <= n; k++)
+            {
+                acc += system[numTaps - 1U - k] * input[n - k];
+            }
+            reference[n] = static_cast<float32_t>(acc);
+            power += acc * acc;
+        }
+        const double noise = std::sqrt(power / NUM_SAMPLES) * 1e-3;
+        for (auto &d : reference)
+        {
+            d += static_cast<float32_t>(noise * gauss(rng));
+        }
+
+        std::vector<float32_t> coeffs(numTaps), state(2U * numTaps - 1U);
+        const float32_t mu = 0.25f / numTaps; // A quarter of the stability bound of LMS for a unit input power
+        // The numTaps updates of a block add up: its bound is 2 / (numTaps * largest eigenvalue), 19 for this input
+        const float32_t muBlock = mu / 8.0f;
+
+        arm_lms_instance_f32 lms;
+        run("lms", numTaps, input, reference, system, coeffs,
+            [&] { arm_lms_init_f32(&lms, numTaps, coeffs.data(), state.data(), mu, numTaps); },
+            [&](const float32_t *x, const float32_t *d, float32_t *y, float32_t *e) {
+                arm_lms_f32(&lms, x, const_cast<float32_t *>(d), y, e, numTaps);
+            });
+
+        arm_lms_norm_instance_f32 lmsNorm;
+        run("lms_norm", numTaps, input, reference, system, coeffs,
+            [&] { arm_lms_norm_init_f32(&lmsNorm, numTaps, coeffs.data(), state.data(), 0.5f, numTaps); },
+            [&](const float32_t *x, const float32_t *d, float32_t *y, float32_t *e) {
+                arm_lms_norm_f32(&lmsNorm, x, const_cast<float32_t *>(d), y, e, numTaps);
+            });
+
+        arm_lms_block_instance_f32 lmsBlock;
+        run("lms_block", numTaps, input, reference, system, coeffs,
+            [&] { arm_lms_block_init_f32(&lmsBlock, numTaps, coeffs.data(), state.data(), muBlock, numTaps); },
+            [&](const float32_t *x, const float32_t *d, float32_t *y, float32_t *e) {
+                arm_lms_block_f32(&lmsBlock, x, d, y, e, numTaps);
+            });
+
+        std::vector<float32_t> fdState(ARM_LMS_FD_STATE_LENGTH(numTaps));
+        arm_lms_fd_instance_f32 lmsFd;
+        run("lms_fd", numTaps, input, reference, system, coeffs,
+            [&] { arm_lms_fd_init_f32(&lmsFd, numTaps, coeffs.data(), fdState.data(), 0.5f, 0.9f); },
+            [&](const float32_t *x, const float32_t *d, float32_t *y, float32_t *e) {
+                arm_lms_fd_f32(&lmsFd, x, d, y, e);
+            });
+
+        if (numTaps <= MAX_RLS_TAPS)
+        {
+            std::vector<float32_t> factor(ARM_RLS_FACTOR_LENGTH(numTaps));
+            arm_rls_instance_f32 rls;
+            run("rls", numTaps, input, reference, system, coeffs,
+                [&] { arm_rls_init_f32(&rls, numTaps, coeffs.data(), state.data(), factor.data(), 0.9999f, 0.01f, numTaps); },
+                [&](const float32_t *x, const float32_t *d, float32_t *y, float32_t *e) {
+                    arm_rls_f32(&rls, x, d, y, e, numTaps);
+                });
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,218 @@
+/**
+ * Classifier population benchmark: N Reception models (CO2reception.hpp)
+ * against one ReceptionBank<N> (reception_bank.hpp), for N = 10 to 1,000.
+ *
+ * Both populations receive a new reading per member every 0.8 s and classify
+ * every 0.1 s, over 60 s of virtual time:
+ *  - transitions: the models' transition and output functions called in
+ *    order, as the coordinator does, without scheduling (cost of the models),
+ *  - simulation: the same populations fed by a source model and run by
+ *    HeapRootCoordinator<VirtualClock> (cost per simulated second).
+ * The band counts of both populations must agree at the end of each run.
+ *
+ * Output: members;mode;separate_us;bank_us;speedup;agree
+ * (microseconds per 0.1 s step for transitions, per simulated second for simulation)
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "cadmium/modeling/devs/coupled.hpp"
+#include "heap_coordinator.hpp"
+#include "reception_bank.hpp"
+
+using namespace cadmium;
+
+static constexpr double STEP = 0.1;      // Classification period
+static constexpr int READING_STEPS = 8;  // A new reading every 0.8 s
+static constexpr double DURATION = 60.0; // Simulated seconds
+
+// Deterministic readings sweeping the three bands
+static float reading(std::size_t member, long round)
+{
+    return 400.0f + static_cast<float>((member * 37 + static_cast<std::size_t>(round) * 11) % 900);
+}
+
+static std::string counts(std::size_t good, std::size_t average, std::size_t bad)
+{
+    std::ostringstream text;
+    text << "good: " << good << ", average: " << average << ", bad: " << bad;
+    return text.str();
+}
+
+// Band counts of separate Reception models, from the flags they would send now
+static std::string receptionCounts(const std::vector<std::shared_ptr<Reception>> &models)
+{
+    std::size_t good = 0, average = 0, bad = 0;
+    for (const auto &model : models)
+    {
+        static_cast<AtomicInterface &>(*model).output();
+        good += model->out_good->getBag().back();
+        average += model->out_avrege->getBag().back();
+        bad += model->out_bad->getBag().back();
+        model->clearPorts();
+    }
+    return counts(good, average, bad);
+}
+
+// Source of the readings: one port per member for separate models, or lanes for a bank
+struct SourceState
+{
+    long round; // Readings sent
+    double sigma;
+};
+
+inline std::ostream &operator<<(std::ostream &out, const SourceState &state)
+{
+    out << state.round;
+    return out;
+}
+
+class ReadingSource : public Atomic<SourceState>
+{
+public:
+    std::vector<Port<float>> outs; // Separate models
+    Port<Lane<float>> lanes;       // Bank
+    std::size_t members;
+    bool toBank;
+
+    ReadingSource(const std::string &id, std::size_t count, bool bank)
+        : Atomic<SourceState>(id, SourceState{0, 0.0}), members(count), toBank(bank)
+    {
+        lanes = addOutPort<Lane<float>>("lanes");
+        for (std::size_t i = 0; i < (bank ? 0 : count); i++)
+        {
+            outs.push_back(addOutPort<float>("out" + std::to_string(i)));
+        }
+    }
+
+    void internalTransition(SourceState &state) const override
+    {
+        state.round++;
+        state.sigma = STEP * READING_STEPS;
+    }
+
+    void externalTransition(SourceState &, double) const override {}
+
+    void output(const SourceState &state) const override
+    {
+        for (std::size_t i = 0; i < members; i++)
+        {
+            if (toBank)
+            {
+                lanes->addMessage({static_cast<uint32_t>(i), reading(i, state.round)});
+            }
+            else
+            {
+                outs[i]->addMessage(reading(i, state.round));
+            }
+        }
+    }
+
+    [[nodiscard]] double timeAdvance(const SourceState &state) const override { return state.sigma; }
+};
+
+template <std::size_t N>
+struct Population : public Coupled
+{
+    std::vector<std::shared_ptr<Reception>> separate;
+    std::shared_ptr<ReceptionBank<N>> bank;
+
+    Population(const std::string &id, bool asBank) : Coupled(id)
+    {
+        auto source = addComponent<ReadingSource>("source", N, asBank);
+        if (asBank)
+        {
+            bank = addComponent<ReceptionBank<N>>("bank");
+            addCoupling(source->lanes, bank->in);
+            return;
+        }
+        for (std::size_t i = 0; i < N; i++)
+        {
+            separate.push_back(addComponent<Reception>("reception" + std::to_string(i)));
+            addCoupling(source->outs[i], separate.back()->in);
+        }
+    }
+};
+
+template <std::size_t N>
+static void run()
+{
+    const long steps = static_cast<long>(DURATION / STEP);
+
+    // Transition functions only
+    std::vector<std::shared_ptr<Reception>> models;
+    for (std::size_t i = 0; i < N; i++)
+    {
+        models.push_back(std::make_shared<Reception>("reception" + std::to_string(i)));
+    }
+    auto bank = std::make_unique<ReceptionBank<N>>("bank");
+
+    auto start = std::chrono::steady_clock::now();
+    for (long s = 0; s < steps; s++)
+    {
+        for (std::size_t i = 0; i < N; i++)
+        {
+            AtomicInterface &model = *models[i]; // Virtual calls, as from the coordinator
+            if (s % READING_STEPS == 0)
+            {
+                models[i]->in->addMessage(reading(i, s / READING_STEPS));
+                model.externalTransition(0.0);
+                models[i]->in->clear();
+            }
+            model.output();
+            model.internalTransition();
+            model.clearPorts();
+        }
+    }
+    auto middle = std::chrono::steady_clock::now();
+    AtomicInterface &population = *bank;
+    for (long s = 0; s < steps; s++)
+    {
+        if (s % READING_STEPS == 0)
+        {
+            for (std::size_t i = 0; i < N; i++)
+            {
+                bank->in->addMessage({static_cast<uint32_t>(i), reading(i, s / READING_STEPS)});
+            }
+            population.externalTransition(0.0);
+            bank->in->clear();
+        }
+        population.output();
+        population.internalTransition();
+        population.clearPorts();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double separateUs = std::chrono::duration<double, std::micro>(middle - start).count() / steps;
+    double bankUs = std::chrono::duration<double, std::micro>(end - middle).count() / steps;
+    bool agree = receptionCounts(models) == bank->logState();
+    std::printf("%zu;transitions;%.2f;%.2f;%.1f;%s\n", N, separateUs, bankUs, separateUs / bankUs, agree ? "yes" : "no");
+
+    // Whole simulation
+    double wall[2];
+    std::string bandCounts[2];
+    for (int asBank = 0; asBank < 2; asBank++)
+    {
+        auto population = std::make_shared<Population<N>>("population", asBank == 1);
+        HeapRootCoordinator<> coordinator(population);
+        auto begin = std::chrono::steady_clock::now();
+        coordinator.start();
+        coordinator.simulate(DURATION);
+        coordinator.stop();
+        wall[asBank] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / DURATION;
+        bandCounts[asBank] = asBank ? population->bank->logState() : receptionCounts(population->separate);
+    }
+    std::printf("%zu;simulation;%.1f;%.1f;%.1f;%s\n", N, wall[0], wall[1], wall[0] / wall[1], bandCounts[0] == bandCounts[1] ? "yes" : "no");
+}
+
+int main()
+{
+    std::printf("members;mode;separate_us;bank_us;speedup;agree\n");
+    run<10>();
+    run<100>();
+    run<1000>();
+    return 0;
+}
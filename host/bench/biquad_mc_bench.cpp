@@ -0,0 +1,184 @@
+/**
+ * Many sensors filtered by the same biquad cascade, built once against the
+ * scalar library (biquad_mc_bench_scalar) and once against the
+ * ARM_MATH_X86_SIMD one (biquad_mc_bench_x86simd): the multi-channel kernels on
+ * the channel-interleaved block, against one single channel call per channel
+ * on de-interleaved buffers (the de-interleaving and re-interleaving are
+ * timed too), for 1 to 64 channels of 256 samples through 4 stages.
+ *
+ * max_diff is the largest difference between the two outputs, 0 when the
+ * multi-channel kernel is bit-exact with the single channel one.
+ *
+ * Output: format;channels;method;ns_per_sample;max_diff
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+#include "arm_math.h"
+
+static constexpr double MIN_SECONDS = 0.05; // Timing of each method
+static constexpr uint32_t BLOCK = 256;      // Samples per channel
+static constexpr uint8_t STAGES = 4;
+
+// Butterworth low-pass at fs/10, with the sign convention of CMSIS-DSP
+static const float32_t stageF32[5] = {0.067455f, 0.134911f, 0.067455f, 1.142980f, -0.412802f};
+
+static std::mt19937 rng(23);
+
+// Nanoseconds per call of fn
+static double timeCall(const std::function<void()> &fn)
+{
+    long calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            fn();
+        }
+        calls += 16;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+    return elapsed * 1e9 / static_cast<double>(calls);
+}
+
+template <typename T>
+static double maxDiff(const std::vector<T> &a, const std::vector<T> &b)
+{
+    double diff = 0.0;
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        diff = std::max(diff, std::fabs(static_cast<double>(a[i]) - static_cast<double>(b[i])));
+    }
+    return diff;
+}
+
+// One single channel filter per channel, each on its de-interleaved samples
+template <typename T, typename Inst>
+static void perChannel(std::vector<Inst> &inst, void (*fn)(const Inst *, const T *, T *, uint32_t),
+                       const std::vector<T> &in, std::vector<T> &out, std::vector<T> &tmp, uint16_t channels)
+{
+    for (uint16_t ch = 0; ch < channels; ch++)
+    {
+        for (uint32_t n = 0; n < BLOCK; n++)
+        {
+            tmp[n] = in[n * channels + ch];
+        }
+        fn(&inst[ch], tmp.data(), tmp.data() + BLOCK, BLOCK);
+        for (uint32_t n = 0; n < BLOCK; n++)
+        {
+            out[n * channels + ch] = tmp[BLOCK + n];
+        }
+    }
+}
+
+static void report(const char *format, uint16_t channels, const char *method, double ns, double diff)
+{
+    std::printf("%s;%u;%s;%.3f;%g\n", format, static_cast<unsigned>(channels), method,
+                ns / (static_cast<double>(BLOCK) * channels), diff);
+}
+
+int main()
+{
+#if defined(ARM_MATH_X86_AVX2)
+    std::printf("# ARM_MATH_X86_SIMD, AVX2\n");
+#elif defined(ARM_MATH_X86_SIMD)
+    std::printf("# ARM_MATH_X86_SIMD, SSE4.2\n");
+#else
+    std::printf("# scalar\n");
+#endif
+    std::printf("format;channels;method;ns_per_sample;max_diff\n");
+
+    std::vector<float32_t> coeffsF32(5 * STAGES);
+    std::vector<q31_t> coeffsQ31(5 * STAGES);
+    for (uint8_t s = 0; s < STAGES; s++)
+    {
+        for (int k = 0; k < 5; k++)
+        {
+            coeffsF32[5 * s + k] = stageF32[k];
+            // postShift 1: the coefficients are in 2.30
+            coeffsQ31[5 * s + k] = static_cast<q31_t>(stageF32[k] * 1073741824.0);
+        }
+    }
+
+    std::uniform_real_distribution<double> value(-0.5, 0.5);
+    const uint16_t channelCounts[] = {1, 2, 4, 7, 8, 16, 32, 64};
+    for (uint16_t channels : channelCounts)
+    {
+        const std::size_t total = static_cast<std::size_t>(BLOCK) * channels;
+        std::vector<float32_t> inF32(total), mcF32(total), refF32(total), tmpF32(2 * BLOCK);
+        std::vector<q31_t> inQ31(total), mcQ31(total), refQ31(total), tmpQ31(2 * BLOCK);
+        for (std::size_t i = 0; i < total; i++)
+        {
+            inF32[i] = static_cast<float32_t>(value(rng));
+            inQ31[i] = static_cast<q31_t>(inF32[i] * 2147483648.0);
+        }
+
+        // DF1 f32
+        {
+            std::vector<float32_t> mcState(4 * STAGES * channels), state(4 * STAGES * channels);
+            arm_biquad_casd_mc_df1_inst_f32 mc;
+            std::vector<arm_biquad_casd_df1_inst_f32> single(channels);
+            arm_biquad_cascade_mc_df1_init_f32(&mc, STAGES, channels, coeffsF32.data(), mcState.data());
+            for (uint16_t ch = 0; ch < channels; ch++)
+            {
+                arm_biquad_cascade_df1_init_f32(&single[ch], STAGES, coeffsF32.data(), state.data() + 4 * STAGES * ch);
+            }
+            arm_biquad_cascade_mc_df1_f32(&mc, inF32.data(), mcF32.data(), BLOCK);
+            perChannel<float32_t>(single, arm_biquad_cascade_df1_f32, inF32, refF32, tmpF32, channels);
+            double diff = maxDiff(mcF32, refF32);
+            report("f32", channels, "df1_per_channel",
+                   timeCall([&] { perChannel<float32_t>(single, arm_biquad_cascade_df1_f32, inF32, refF32, tmpF32, channels); }),
+                   0.0);
+            report("f32", channels, "df1_mc",
+                   timeCall([&] { arm_biquad_cascade_mc_df1_f32(&mc, inF32.data(), mcF32.data(), BLOCK); }), diff);
+        }
+
+        // DF2T f32
+        {
+            std::vector<float32_t> mcState(2 * STAGES * channels), state(2 * STAGES * channels);
+            arm_biquad_cascade_mc_df2T_instance_f32 mc;
+            std::vector<arm_biquad_cascade_df2T_instance_f32> single(channels);
+            arm_biquad_cascade_mc_df2T_init_f32(&mc, STAGES, channels, coeffsF32.data(), mcState.data());
+            for (uint16_t ch = 0; ch < channels; ch++)
+            {
+                arm_biquad_cascade_df2T_init_f32(&single[ch], STAGES, coeffsF32.data(), state.data() + 2 * STAGES * ch);
+            }
+            arm_biquad_cascade_mc_df2T_f32(&mc, inF32.data(), mcF32.data(), BLOCK);
+            perChannel<float32_t>(single, arm_biquad_cascade_df2T_f32, inF32, refF32, tmpF32, channels);
+            double diff = maxDiff(mcF32, refF32);
+            report("f32", channels, "df2T_per_channel",
+                   timeCall([&] { perChannel<float32_t>(single, arm_biquad_cascade_df2T_f32, inF32, refF32, tmpF32, channels); }),
+                   0.0);
+            report("f32", channels, "df2T_mc",
+                   timeCall([&] { arm_biquad_cascade_mc_df2T_f32(&mc, inF32.data(), mcF32.data(), BLOCK); }), diff);
+        }
+
+        // DF1 Q31
+        {
+            std::vector<q31_t> mcState(4 * STAGES * channels), state(4 * STAGES * channels);
+            arm_biquad_casd_mc_df1_inst_q31 mc;
+            std::vector<arm_biquad_casd_df1_inst_q31> single(channels);
+            arm_biquad_cascade_mc_df1_init_q31(&mc, STAGES, channels, coeffsQ31.data(), mcState.data(), 1);
+            for (uint16_t ch = 0; ch < channels; ch++)
+            {
+                arm_biquad_cascade_df1_init_q31(&single[ch], STAGES, coeffsQ31.data(), state.data() + 4 * STAGES * ch, 1);
+            }
+            arm_biquad_cascade_mc_df1_q31(&mc, inQ31.data(), mcQ31.data(), BLOCK);
+            perChannel<q31_t>(single, arm_biquad_cascade_df1_q31, inQ31, refQ31, tmpQ31, channels);
+            double diff = maxDiff(mcQ31, refQ31);
+            report("q31", channels, "df1_per_channel",
+                   timeCall([&] { perChannel<q31_t>(single, arm_biquad_cascade_df1_q31, inQ31, refQ31, tmpQ31, channels); }),
+                   0.0);
+            report("q31", channels, "df1_mc",
+                   timeCall([&] { arm_biquad_cascade_mc_df1_q31(&mc, inQ31.data(), mcQ31.data(), BLOCK); }), diff);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+/**
+ * Multi-room scaling on the host: the building of main/include/building.hpp
+ * with 1, 2, 4, ... rooms, drivers served by the HAL stand-in (the DHT11 read
+ * blocks for its real duration, about 24 ms).
+ *
+ * Usage: building_bench [max_rooms] [seconds]
+ * Output: the lines of BuildingScaling::sweep(), figures in host nanoseconds.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "building.hpp"
+
+extern "C"
+{
+#include "adc.h"
+#include "tim.h"
+}
+
+static void printLine(const char *line)
+{
+    std::fputs(line, stdout);
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t maxRooms = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+    double seconds = argc > 2 ? std::atof(argv[2]) : 10.0;
+
+    MX_ADC1_Init();
+    MX_TIM4_Init();
+    cadmium::BuildingScaling::sweep<cadmium::BuildingRoom>(maxRooms, seconds, &hadc1, printLine);
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * Change-only output benchmark: the lab model (top_coupled) replayed over one
+ * synthetic office day (a slow CO2 dip and a temperature swing) with every
+ * message sent and with the change-only outputs of the room models
+ * (change_only.hpp).
+ *
+ * Counted per simulated hour:
+ *  - transitions: internal, external and confluent transitions run,
+ *  - log lines: output and state lines the simulation log would print,
+ *  - output writes: HAL_GPIO_WritePin/TogglePin and timer compare writes.
+ * The time the CO2 LEDs, the motion LED and the servo spend in each state is
+ * printed with them, to show the room behaves the same.
+ *
+ * Output: outputs;transitions_per_h;log_lines_per_h;output_writes_per_h;good_s;average_s;bad_s;motion_s;servo_duty_s
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "top.hpp"
+#include "heap_coordinator.hpp"
+#include "trace_replay.hpp"
+#include "cadmium/simulation/logger/logger.hpp"
+
+extern "C"
+{
+#include "adc.h"
+#include "tim.h"
+}
+
+using namespace cadmium;
+
+// Counts the lines a text logger would print
+class CountingLogger : public Logger
+{
+    unsigned long &lines;
+
+public:
+    explicit CountingLogger(unsigned long *count) : lines(*count) {}
+
+    void start() override {}
+    void stop() override {}
+
+    void logOutput(double, long, const std::string &, const std::string &, const std::string &) override
+    {
+        lines++;
+    }
+
+    void logState(double, long, const std::string &, const std::string &) override
+    {
+        lines++;
+    }
+};
+
+// One day of an occupied office: motion, CO2 dip of the raw reading and a temperature swing, sampled every 10 s
+static std::shared_ptr<const SensorTrace> officeDay()
+{
+    auto trace = std::make_shared<SensorTrace>();
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    std::bernoulli_distribution moving(0.3);
+    for (double t = 0; t <= 86400.0; t += 10.0)
+    {
+        double hour = t / 3600.0;
+        bool occupied = hour >= 8.0 && hour < 18.0;
+        float raw = 512.0f + noise(rng) * 3.0f - (occupied ? 20.0f + 40.0f * static_cast<float>(std::sin((hour - 8.0) * M_PI / 10.0)) : 0.0f);
+        float celsius = 21.0f + 5.0f * static_cast<float>(std::sin((hour - 9.0) * M_PI / 12.0)) + noise(rng) * 0.3f;
+        trace->add(t, static_cast<uint16_t>(raw), std::nearbyint(celsius * 10.0f) / 10.0f, occupied && moving(rng));
+    }
+    return trace;
+}
+
+int main()
+{
+    auto trace = officeDay();
+    const double hours = trace->duration() / 3600.0;
+
+    std::printf("outputs;transitions_per_h;log_lines_per_h;output_writes_per_h;good_s;average_s;bad_s;motion_s;servo_duty_s\n");
+    for (bool changeOnly : {false, true})
+    {
+        hal_host_set_virtual_time(1);
+        MX_ADC1_Init();
+        MX_TIM2_Init();
+        HAL_TIM_Base_Start(&htim2);
+        MX_TIM4_Init();
+        HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_1);
+        MX_TIM6_Init();
+        HAL_TIM_Base_Start(&htim6);
+
+        RoomParameters params;
+        params.outputs.enabled = changeOnly;
+        auto model = std::make_shared<top_coupled>("top_coupled", params);
+        ReplayMetrics metrics;
+        HeapRootCoordinator<TraceReplayClock> coordinator(model, TraceReplayClock(trace, LabRoom::hardware(0), &metrics));
+        unsigned long lines = 0;
+        coordinator.setLogger<CountingLogger>(&lines);
+        hal_host_output_writes = 0;
+        coordinator.start();
+        coordinator.simulate(trace->duration());
+        coordinator.stop();
+
+        std::printf("%s;%.0f;%.0f;%.0f;%.0f;%.0f;%.0f;%.0f;%.0f\n", changeOnly ? "change_only" : "every_value",
+                    coordinator.getTransitionCount() / hours, lines / hours, hal_host_output_writes / hours, metrics.goodSeconds,
+                    metrics.averageSeconds, metrics.badSeconds, metrics.motionSeconds, metrics.servoDutySeconds);
+    }
+    return 0;
+}
@@ -0,0 +1,205 @@
+/**
+ * Decimation of an oversampled ADC stream by 64, built once against the
+ * scalar library (cic_bench_scalar) and once against the ARM_MATH_X86_SIMD one
+ * (cic_bench_x86simd): arm_fir_decimate_xxx with a Kaiser filter of 20 taps
+ * per unit of the factor, against the CIC decimator arm_cic_decimate_xxx
+ * alone, and followed by a droop compensation filter of 32 taps that
+ * decimates by 2 (arm_cic_compensate_design_f32, arm_fir_decimate_xxx).
+ *
+ * The input is a tone at 0.1 of the output rate and one as strong at 0.7,
+ * which aliases to 0.3. snr_db is the power of the tone at 0.1, fitted on the
+ * output, over the power of the rest: the alias that the filters let through.
+ * The Q15 CIC filters have fewer stages, their gain limited to 2^16.
+ *
+ * Output: format;method;R;N;ns_per_input_sample;snr_db
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#include "arm_math.h"
+
+static constexpr double MIN_SECONDS = 0.05; // Timing of each method
+static constexpr uint32_t DECIMATION = 64;  // Total decimation factor
+static constexpr uint32_t NUM_OUTPUTS = 2048;
+static constexpr uint32_t BLOCK = 2048;     // Input samples per call
+static constexpr uint16_t COMPENSATE_TAPS = 32;
+static constexpr double TONE = 0.1;         // Cycles per output sample
+static constexpr double ALIAS = 0.7;
+
+// Nanoseconds per call of fn
+static double timeCall(const std::function<void()> &fn)
+{
+    long calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        fn();
+        calls++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+    return elapsed * 1e9 / static_cast<double>(calls);
+}
+
+// Power of the least-squares fit of a sinusoid at TONE over the power of the residual, after the transient
+static double snr(const std::vector<double> &out)
+{
+    const std::size_t first = 64;
+    double cc = 0.0, ss = 0.0, cs = 0.0, yc = 0.0, ys = 0.0;
+    for (std::size_t m = first; m < out.size(); m++)
+    {
+        double c = std::cos(6.283185307179586 * TONE * m), s = std::sin(6.283185307179586 * TONE * m);
+        cc += c * c;
+        ss += s * s;
+        cs += c * s;
+        yc += out[m] * c;
+        ys += out[m] * s;
+    }
+    double det = cc * ss - cs * cs;
+    double a = (yc * ss - ys * cs) / det, b = (ys * cc - yc * cs) / det;
+    double sig = 0.0, noise = 0.0;
+    for (std::size_t m = first; m < out.size(); m++)
+    {
+        double fit = a * std::cos(6.283185307179586 * TONE * m) + b * std::sin(6.283185307179586 * TONE * m);
+        sig += fit * fit;
+        noise += (out[m] - fit) * (out[m] - fit);
+    }
+    return 10.0 * std::log10(sig / noise);
+}
+
+template <typename T> struct Ops;
+
+template <> struct Ops<q31_t>
+{
+    using Cic = arm_cic_decimate_instance_q31;
+    using CicState = q63_t;
+    using Decimate = arm_fir_decimate_instance_q31;
+    static constexpr const char *name = "q31";
+    static constexpr uint8_t cicStages = 4;
+    static void fromFloat(const float32_t *src, q31_t *dst, uint32_t n) { arm_float_to_q31(src, dst, n); }
+    static double toDouble(q31_t v) { return v / 2147483648.0; }
+    static constexpr auto cicInit = arm_cic_decimate_init_q31;
+    static constexpr auto cic = arm_cic_decimate_q31;
+    static constexpr auto decimateInit = arm_fir_decimate_init_q31;
+    static constexpr auto decimate = arm_fir_decimate_q31;
+};
+
+template <> struct Ops<q15_t>
+{
+    using Cic = arm_cic_decimate_instance_q15;
+    using CicState = q31_t;
+    using Decimate = arm_fir_decimate_instance_q15;
+    static constexpr const char *name = "q15";
+    static constexpr uint8_t cicStages = 2;
+    static void fromFloat(const float32_t *src, q15_t *dst, uint32_t n) { arm_float_to_q15(src, dst, n); }
+    static double toDouble(q15_t v) { return v / 32768.0; }
+    static constexpr auto cicInit = arm_cic_decimate_init_q15;
+    static constexpr auto cic = arm_cic_decimate_q15;
+    static constexpr auto decimateInit = arm_fir_decimate_init_q15;
+    static constexpr auto decimate = arm_fir_decimate_q15;
+};
+
+template <typename T>
+static void report(const char *method, uint32_t R, uint32_t N, double ns, const std::vector<T> &out, uint32_t n)
+{
+    std::vector<double> outputDouble(n);
+    for (uint32_t m = 0; m < n; m++)
+    {
+        outputDouble[m] = Ops<T>::toDouble(out[m]);
+    }
+    std::printf("%s;%s;%u;%u;%.2f;%.1f\n", Ops<T>::name, method, R, N, ns / (NUM_OUTPUTS * DECIMATION),
+                snr(outputDouble));
+}
+
+template <typename T>
+static void run(const std::vector<float32_t> &inputF32)
+{
+    using O = Ops<T>;
+    const uint32_t numInputs = static_cast<uint32_t>(inputF32.size());
+    std::vector<T> input(numInputs);
+    O::fromFloat(inputF32.data(), input.data(), numInputs);
+    std::vector<T> output(NUM_OUTPUTS * 2);
+    uint32_t numOutputs = 0;
+
+    // FIR decimator by 64
+    {
+        const uint16_t numTaps = static_cast<uint16_t>(20U * DECIMATION);
+        std::vector<float32_t> coeffsF32(numTaps);
+        arm_fir_resample_design_f32(1, DECIMATION, numTaps, 5.0f, coeffsF32.data());
+        std::vector<T> coeffs(numTaps), state(numTaps + BLOCK - 1);
+        O::fromFloat(coeffsF32.data(), coeffs.data(), numTaps);
+        typename O::Decimate decimator;
+        double ns = timeCall([&] {
+            O::decimateInit(&decimator, numTaps, DECIMATION, coeffs.data(), state.data(), BLOCK);
+            for (uint32_t n = 0; n < numInputs; n += BLOCK)
+            {
+                O::decimate(&decimator, input.data() + n, output.data() + n / DECIMATION, BLOCK);
+            }
+        });
+        report<T>("fir_decimate", DECIMATION, 0, ns, output, NUM_OUTPUTS);
+    }
+
+    // CIC decimator by 64
+    {
+        std::vector<typename O::CicState> state(ARM_CIC_STATE_LENGTH(O::cicStages, 1U));
+        typename O::Cic cic;
+        double ns = timeCall([&] {
+            O::cicInit(&cic, O::cicStages, DECIMATION, 1, state.data());
+            numOutputs = 0;
+            for (uint32_t n = 0; n < numInputs; n += BLOCK)
+            {
+                numOutputs += O::cic(&cic, input.data() + n, output.data() + numOutputs, BLOCK);
+            }
+        });
+        report<T>("cic", DECIMATION, O::cicStages, ns, output, numOutputs);
+    }
+
+    // CIC decimator by 32, then compensation filter decimating by 2
+    {
+        const uint32_t R = DECIMATION / 2U;
+        const uint32_t cicBlock = BLOCK / R;
+        std::vector<typename O::CicState> state(ARM_CIC_STATE_LENGTH(O::cicStages + 1U, 1U));
+        typename O::Cic cic;
+        std::vector<float32_t> coeffsF32(COMPENSATE_TAPS);
+        arm_cic_compensate_design_f32(R, O::cicStages + 1U, 1, COMPENSATE_TAPS, 0.2f, coeffsF32.data());
+        std::vector<T> coeffs(COMPENSATE_TAPS), compensateState(COMPENSATE_TAPS + cicBlock - 1), cicOutput(cicBlock);
+        O::fromFloat(coeffsF32.data(), coeffs.data(), COMPENSATE_TAPS);
+        typename O::Decimate compensator;
+        double ns = timeCall([&] {
+            O::cicInit(&cic, O::cicStages + 1U, R, 1, state.data());
+            O::decimateInit(&compensator, COMPENSATE_TAPS, 2, coeffs.data(), compensateState.data(), cicBlock);
+            for (uint32_t n = 0; n < numInputs; n += BLOCK)
+            {
+                O::cic(&cic, input.data() + n, cicOutput.data(), BLOCK);
+                O::decimate(&compensator, cicOutput.data(), output.data() + n / DECIMATION, cicBlock);
+            }
+        });
+        report<T>("cic_compensate", R, O::cicStages + 1U, ns, output, NUM_OUTPUTS);
+    }
+}
+
+int main()
+{
+#if defined(ARM_MATH_X86_AVX2)
+    std::printf("# ARM_MATH_X86_SIMD, AVX2\n");
+#elif defined(ARM_MATH_X86_SIMD)
+    std::printf("# ARM_MATH_X86_SIMD, SSE4.2\n");
+#else
+    std::printf("# scalar\n");
+#endif
+    std::printf("format;method;R;N;ns_per_input_sample;snr_db\n");
+
+    std::vector<float32_t> input(NUM_OUTPUTS * DECIMATION);
+    for (std::size_t n = 0; n < input.size(); n++)
+    {
+        double t = static_cast<double>(n) / DECIMATION;
+        input[n] = static_cast<float32_t>(0.4 * std::sin(6.283185307179586 * TONE * t) +
+                                          0.4 * std::sin(6.283185307179586 * ALIAS * t));
+    }
+    run<q31_t>(input);
+    run<q15_t>(input);
+    return 0;
+}
@@ -0,0 +1,256 @@
+/**
+ * CMSIS-DSP f32 kernel benchmark, built once against the scalar library
+ * (dsp_bench_scalar) and once against the ARM_MATH_X86_SIMD one
+ * (dsp_bench_x86simd): time per call and accuracy of the functions the host
+ * simulation and the offline analysis use.
+ *
+ * Every result is compared with the exact value computed in double. The error
+ * is given as a fraction of the documented bound of arm_math.h,
+ * n * 2^-24 * sum(|term|) for n terms (one term for element-wise functions,
+ * where it is half an ulp): the run fails if a result exceeds it.
+ *
+ * Output: function;size;ns_per_call;msamples_per_s;error_of_bound
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+#include "arm_math.h"
+
+static constexpr double EPS = 1.0 / 16777216.0; // 2^-24
+static constexpr double MIN_SECONDS = 0.05;     // Timing of each function
+
+static std::mt19937 rng(7);
+
+static std::vector<float32_t> randomVector(std::size_t n)
+{
+    std::uniform_real_distribution<float32_t> value(-1.0f, 1.0f);
+    std::vector<float32_t> v(n);
+    for (auto &x : v)
+    {
+        x = value(rng);
+    }
+    return v;
+}
+
+// Largest error of a run, as a fraction of its bound
+struct Accuracy
+{
+    double worst = 0.0;
+
+    void check(double got, double exact, double terms, double magnitude)
+    {
+        double bound = std::max(terms * EPS * magnitude, 1e-300);
+        worst = std::max(worst, std::fabs(got - exact) / bound);
+    }
+};
+
+static bool failed = false;
+
+// Calls fn until MIN_SECONDS elapsed, prints the time per call and the accuracy
+static void report(const char *name, std::size_t size, std::size_t samples, const std::function<void()> &fn, const Accuracy &accuracy)
+{
+    long calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            fn();
+        }
+        calls += 16;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+
+    double ns = elapsed * 1e9 / calls;
+    std::printf("%s;%zu;%.1f;%.1f;%.3f\n", name, size, ns, samples * 1e3 / ns, accuracy.worst);
+    failed |= accuracy.worst > 1.0;
+}
+
+static void elementWise(std::size_t n)
+{
+    auto a = randomVector(n);
+    auto b = randomVector(n);
+    std::vector<float32_t> out(n);
+    Accuracy add, mult, scale, abs;
+
+    arm_add_f32(a.data(), b.data(), out.data(), n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        add.check(out[i], static_cast<double>(a[i]) + b[i], 1, std::fabs(static_cast<double>(a[i]) + b[i]));
+    }
+    report("arm_add_f32", n, n, [&] { arm_add_f32(a.data(), b.data(), out.data(), n); }, add);
+
+    arm_mult_f32(a.data(), b.data(), out.data(), n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        mult.check(out[i], static_cast<double>(a[i]) * b[i], 1, std::fabs(static_cast<double>(a[i]) * b[i]));
+    }
+    report("arm_mult_f32", n, n, [&] { arm_mult_f32(a.data(), b.data(), out.data(), n); }, mult);
+
+    arm_scale_f32(a.data(), 0.3f, out.data(), n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        double exact = a[i] * static_cast<double>(0.3f);
+        scale.check(out[i], exact, 1, std::fabs(exact));
+    }
+    report("arm_scale_f32", n, n, [&] { arm_scale_f32(a.data(), 0.3f, out.data(), n); }, scale);
+
+    arm_abs_f32(a.data(), out.data(), n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        abs.check(out[i], std::fabs(a[i]), 1, std::fabs(a[i]));
+    }
+    report("arm_abs_f32", n, n, [&] { arm_abs_f32(a.data(), out.data(), n); }, abs);
+}
+
+static void reductions(std::size_t n)
+{
+    auto a = randomVector(n);
+    auto b = randomVector(n);
+    float32_t result;
+    uint32_t index;
+    Accuracy dot, mean, power, max;
+
+    double exact = 0.0, magnitude = 0.0;
+    arm_dot_prod_f32(a.data(), b.data(), n, &result);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        exact += static_cast<double>(a[i]) * b[i];
+        magnitude += std::fabs(static_cast<double>(a[i]) * b[i]);
+    }
+    dot.check(result, exact, n, magnitude);
+    report("arm_dot_prod_f32", n, n, [&] { arm_dot_prod_f32(a.data(), b.data(), n, &result); }, dot);
+
+    exact = 0.0, magnitude = 0.0;
+    arm_mean_f32(a.data(), n, &result);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        exact += a[i];
+        magnitude += std::fabs(a[i]);
+    }
+    mean.check(result, exact / n, n + 1, magnitude / n);
+    report("arm_mean_f32", n, n, [&] { arm_mean_f32(a.data(), n, &result); }, mean);
+
+    exact = 0.0;
+    arm_power_f32(a.data(), n, &result);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        exact += static_cast<double>(a[i]) * a[i];
+    }
+    power.check(result, exact, n, exact);
+    report("arm_power_f32", n, n, [&] { arm_power_f32(a.data(), n, &result); }, power);
+
+    arm_max_f32(a.data(), n, &result, &index);
+    max.check(result, *std::max_element(a.begin(), a.end()), 1, 1.0);
+    max.check(index, std::max_element(a.begin(), a.end()) - a.begin(), 1, 1.0);
+    report("arm_max_f32", n, n, [&] { arm_max_f32(a.data(), n, &result, &index); }, max);
+}
+
+static void complexMath(std::size_t n)
+{
+    auto a = randomVector(2 * n);
+    auto b = randomVector(2 * n);
+    std::vector<float32_t> out(2 * n);
+    Accuracy mag, mult;
+
+    arm_cmplx_mag_f32(a.data(), out.data(), n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        double exact = std::sqrt(static_cast<double>(a[2 * i]) * a[2 * i] + static_cast<double>(a[2 * i + 1]) * a[2 * i + 1]);
+        mag.check(out[i], exact, 3, exact);
+    }
+    report("arm_cmplx_mag_f32", n, n, [&] { arm_cmplx_mag_f32(a.data(), out.data(), n); }, mag);
+
+    arm_cmplx_mult_cmplx_f32(a.data(), b.data(), out.data(), n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        double ar = a[2 * i], ai = a[2 * i + 1], br = b[2 * i], bi = b[2 * i + 1];
+        mult.check(out[2 * i], ar * br - ai * bi, 2, std::fabs(ar * br) + std::fabs(ai * bi));
+        mult.check(out[2 * i + 1], ar * bi + ai * br, 2, std::fabs(ar * bi) + std::fabs(ai * br));
+    }
+    report("arm_cmplx_mult_cmplx_f32", n, n, [&] { arm_cmplx_mult_cmplx_f32(a.data(), b.data(), out.data(), n); }, mult);
+}
+
+static void fir(std::size_t taps, std::size_t block)
+{
+    auto coeffs = randomVector(taps);
+    auto input = randomVector(block);
+    std::vector<float32_t> state(taps + block - 1), out(block);
+    arm_fir_instance_f32 filter;
+    Accuracy accuracy;
+
+    arm_fir_init_f32(&filter, taps, coeffs.data(), state.data(), block);
+    arm_fir_f32(&filter, input.data(), out.data(), block);
+    for (std::size_t n = 0; n < block; n++)
+    {
+        double exact = 0.0, magnitude = 0.0;
+        for (std::size_t k = 0; k < taps && k <= n; k++)
+        {
+            // Coefficients in time-reversed order, as arm_fir_f32 expects
+            double term = static_cast<double>(coeffs[taps - 1 - k]) * input[n - k];
+            exact += term;
+            magnitude += std::fabs(term);
+        }
+        accuracy.check(out[n], exact, taps, magnitude);
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "arm_fir_f32_%zutaps", taps);
+    report(name, block, block, [&] { arm_fir_f32(&filter, input.data(), out.data(), block); }, accuracy);
+}
+
+static void matMult(uint16_t n)
+{
+    auto a = randomVector(n * n);
+    auto b = randomVector(n * n);
+    std::vector<float32_t> c(n * n);
+    arm_matrix_instance_f32 ma, mb, mc;
+    Accuracy accuracy;
+
+    arm_mat_init_f32(&ma, n, n, a.data());
+    arm_mat_init_f32(&mb, n, n, b.data());
+    arm_mat_init_f32(&mc, n, n, c.data());
+    arm_mat_mult_f32(&ma, &mb, &mc);
+    for (uint16_t i = 0; i < n; i++)
+    {
+        for (uint16_t j = 0; j < n; j++)
+        {
+            double exact = 0.0, magnitude = 0.0;
+            for (uint16_t k = 0; k < n; k++)
+            {
+                exact += static_cast<double>(a[i * n + k]) * b[k * n + j];
+                magnitude += std::fabs(static_cast<double>(a[i * n + k]) * b[k * n + j]);
+            }
+            accuracy.check(c[i * n + j], exact, n, magnitude);
+        }
+    }
+    report("arm_mat_mult_f32", n, static_cast<std::size_t>(n) * n * n, [&] { arm_mat_mult_f32(&ma, &mb, &mc); }, accuracy);
+}
+
+int main()
+{
+#if defined(ARM_MATH_X86_AVX2)
+    std::printf("# ARM_MATH_X86_SIMD, AVX2\n");
+#elif defined(ARM_MATH_X86_SIMD)
+    std::printf("# ARM_MATH_X86_SIMD, SSE4.2\n");
+#else
+    std::printf("# scalar\n");
+#endif
+    std::printf("function;size;ns_per_call;msamples_per_s;error_of_bound\n");
+    for (std::size_t n : {256, 4096})
+    {
+        elementWise(n);
+        reductions(n);
+        complexMath(n);
+    }
+    fir(32, 256);
+    fir(128, 1024);
+    matMult(16);
+    matMult(64);
+    return failed ? 1 : 0;
+}
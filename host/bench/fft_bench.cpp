@@ -0,0 +1,252 @@
+/**
+ * CMSIS-DSP FFT throughput, built once against the scalar library
+ * (fft_bench_scalar) and once against the ARM_MATH_X86_SIMD one
+ * (fft_bench_x86simd): forward arm_cfft_f32 (with bit reversal) and
+ * arm_rfft_fast_f32 from 64 to 4096 points, with the constant tables and
+ * with the tables generated by arm_cfft_tables_init_f32 and
+ * arm_rfft_fast_tables_init_f32 (rows suffixed _gen), then the mixed-radix
+ * arm_cfft_mixed_f32 and arm_rfft_mixed_f32 for multiples of 60 and a few
+ * powers of 2.
+ *
+ * Each call transforms a fresh copy of the input, the copy being timed too.
+ * The SNR is measured against a DFT computed in double, and the checksum
+ * (FNV-1a of the output bits) lets the two builds be compared: the vector
+ * butterflies, bit reversal and split stage compute the same operations as
+ * the scalar code, so the checksums of the power-of-2 FFTs must match.
+ *
+ * Output: transform;points;ffts_per_s;snr_db;checksum, and comment lines
+ * with the initialization time and arena size of the generated tables, and
+ * the number of their twiddle factors differing from the constant tables.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+static constexpr double MIN_SECONDS = 0.1; // Timing of each transform
+static constexpr double TWO_PI = 6.28318530717958647692;
+
+static std::mt19937 rng(11);
+
+// DFT of n complex samples (interleaved) in double
+static std::vector<double> dft(const std::vector<float32_t> &x, std::size_t n)
+{
+    std::vector<double> out(2 * n);
+    for (std::size_t k = 0; k < n; k++)
+    {
+        double re = 0.0, im = 0.0;
+        for (std::size_t t = 0; t < n; t++)
+        {
+            double angle = -TWO_PI * static_cast<double>((k * t) % n) / n;
+            re += x[2 * t] * std::cos(angle) - x[2 * t + 1] * std::sin(angle);
+            im += x[2 * t] * std::sin(angle) + x[2 * t + 1] * std::cos(angle);
+        }
+        out[2 * k] = re;
+        out[2 * k + 1] = im;
+    }
+    return out;
+}
+
+static double snrDb(const float32_t *got, const double *exact, std::size_t count)
+{
+    double signal = 0.0, noise = 0.0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        signal += exact[i] * exact[i];
+        noise += (got[i] - exact[i]) * (got[i] - exact[i]);
+    }
+    return noise > 0.0 ? 10.0 * std::log10(signal / noise) : INFINITY;
+}
+
+static uint32_t checksum(const float32_t *data, std::size_t count)
+{
+    uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &data[i], sizeof(bits));
+        for (int b = 0; b < 4; b++)
+        {
+            hash = (hash ^ ((bits >> (8 * b)) & 0xFFu)) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+static double callsPerSecond(const std::function<void()> &fn)
+{
+    long calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            fn();
+        }
+        calls += 16;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+    return calls / elapsed;
+}
+
+// Twiddle factors of two tables differing from each other, bit for bit
+static std::size_t differingValues(const float32_t *a, const float32_t *b, std::size_t count)
+{
+    std::size_t differing = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        differing += std::memcmp(&a[i], &b[i], sizeof(float32_t)) != 0;
+    }
+    return differing;
+}
+
+static const arm_cfft_instance_f32 *cfftInstance(std::size_t n)
+{
+    switch (n)
+    {
+    case 64:
+        return &arm_cfft_sR_f32_len64;
+    case 128:
+        return &arm_cfft_sR_f32_len128;
+    case 256:
+        return &arm_cfft_sR_f32_len256;
+    case 512:
+        return &arm_cfft_sR_f32_len512;
+    case 1024:
+        return &arm_cfft_sR_f32_len1024;
+    case 2048:
+        return &arm_cfft_sR_f32_len2048;
+    default:
+        return &arm_cfft_sR_f32_len4096;
+    }
+}
+
+// Forward complex FFT of n points, transform(p) being in-place
+static void cfft(const char *name, std::size_t n, const std::function<void(float32_t *)> &transform)
+{
+    std::uniform_real_distribution<float32_t> value(-1.0f, 1.0f);
+    std::vector<float32_t> input(2 * n), work(2 * n);
+    for (auto &x : input)
+    {
+        x = value(rng);
+    }
+
+    work = input;
+    transform(work.data());
+    double snr = snrDb(work.data(), dft(input, n).data(), 2 * n);
+    uint32_t sum = checksum(work.data(), 2 * n);
+
+    double rate = callsPerSecond([&] {
+        std::memcpy(work.data(), input.data(), input.size() * sizeof(float32_t));
+        transform(work.data());
+    });
+    std::printf("%s;%zu;%.0f;%.1f;%08x\n", name, n, rate, snr, sum);
+}
+
+// Forward real FFT of n points, transform(p, out) modifying p
+static void rfft(const char *name, std::size_t n, const std::function<void(float32_t *, float32_t *)> &transform)
+{
+    std::uniform_real_distribution<float32_t> value(-1.0f, 1.0f);
+    std::vector<float32_t> input(n), work(n), out(n);
+    for (auto &x : input)
+    {
+        x = value(rng);
+    }
+
+    work = input;
+    transform(work.data(), out.data());
+
+    // Bins 0 to n/2 - 1 of the real input, bin n/2 packed in the imaginary part of bin 0
+    std::vector<float32_t> complexInput(2 * n, 0.0f);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        complexInput[2 * i] = input[i];
+    }
+    std::vector<double> exact = dft(complexInput, n);
+    exact[1] = exact[n];
+    double snr = snrDb(out.data(), exact.data(), n);
+    uint32_t sum = checksum(out.data(), n);
+
+    double rate = callsPerSecond([&] {
+        std::memcpy(work.data(), input.data(), input.size() * sizeof(float32_t));
+        transform(work.data(), out.data());
+    });
+    std::printf("%s;%zu;%.0f;%.1f;%08x\n", name, n, rate, snr, sum);
+}
+
+int main()
+{
+#if defined(ARM_MATH_X86_AVX2)
+    std::printf("# ARM_MATH_X86_SIMD, AVX2\n");
+#elif defined(ARM_MATH_X86_SIMD)
+    std::printf("# ARM_MATH_X86_SIMD, SSE4.2\n");
+#else
+    std::printf("# scalar\n");
+#endif
+    std::printf("transform;points;ffts_per_s;snr_db;checksum\n");
+    for (std::size_t n = 64; n <= 4096; n *= 2)
+    {
+        const arm_cfft_instance_f32 *instance = cfftInstance(n);
+        cfft("arm_cfft_f32", n, [&](float32_t *p) { arm_cfft_f32(instance, p, 0, 1); });
+    }
+    for (std::size_t n = 64; n <= 4096; n *= 2)
+    {
+        arm_rfft_fast_instance_f32 instance;
+        arm_rfft_fast_init_f32(&instance, static_cast<uint16_t>(n));
+        rfft("arm_rfft_fast_f32", n, [&](float32_t *p, float32_t *out) { arm_rfft_fast_f32(&instance, p, out, 0); });
+    }
+
+    // Same transforms, tables generated into an arena
+    std::vector<uint64_t> arenaMemory(ARM_CFFT_TABLES_SIZE_F32(4096U) / 8U);
+    arm_fft_table_arena arena;
+    for (std::size_t n = 64; n <= 4096; n *= 2)
+    {
+        arm_cfft_instance_f32 instance;
+        double inits = callsPerSecond([&] {
+            arm_fft_table_arena_init(&arena, arenaMemory.data(), arenaMemory.size() * 8U);
+            arm_cfft_tables_init_f32(&instance, static_cast<uint16_t>(n), &arena);
+        });
+        std::printf("# arm_cfft_tables_init_f32 %zu: %.1f us, %u bytes, %zu twiddles differ from the constant table\n",
+                    n, 1e6 / inits, static_cast<unsigned>(arena.used),
+                    differingValues(instance.pTwiddle, cfftInstance(n)->pTwiddle, 2 * n));
+        cfft("arm_cfft_f32_gen", n, [&](float32_t *p) { arm_cfft_f32(&instance, p, 0, 1); });
+    }
+    for (std::size_t n = 64; n <= 4096; n *= 2)
+    {
+        arm_rfft_fast_instance_f32 instance, reference;
+        arm_rfft_fast_init_f32(&reference, static_cast<uint16_t>(n));
+        double inits = callsPerSecond([&] {
+            arm_fft_table_arena_init(&arena, arenaMemory.data(), arenaMemory.size() * 8U);
+            arm_rfft_fast_tables_init_f32(&instance, static_cast<uint16_t>(n), &arena);
+        });
+        std::printf("# arm_rfft_fast_tables_init_f32 %zu: %.1f us, %u bytes, %zu twiddles differ from the constant table\n",
+                    n, 1e6 / inits, static_cast<unsigned>(arena.used),
+                    differingValues(instance.pTwiddleRFFT, reference.pTwiddleRFFT, n));
+        rfft("arm_rfft_fast_f32_gen", n, [&](float32_t *p, float32_t *out) { arm_rfft_fast_f32(&instance, p, out, 0); });
+    }
+
+    // Lengths for 50/60 Hz multiples, and powers of 2 to compare with arm_cfft_f32
+    for (std::size_t n : {60, 120, 240, 480, 960, 1920, 3840, 64, 1024, 4096})
+    {
+        arm_cfft_mixed_instance_f32 instance;
+        std::vector<float32_t> state(ARM_CFFT_MIXED_STATE_LENGTH(n));
+        arm_cfft_mixed_init_f32(&instance, static_cast<uint16_t>(n), state.data());
+        cfft("arm_cfft_mixed_f32", n, [&](float32_t *p) { arm_cfft_mixed_f32(&instance, p, 0); });
+    }
+    for (std::size_t n : {60, 120, 240, 480, 960, 1920, 3840, 64, 1024, 4096})
+    {
+        arm_rfft_mixed_instance_f32 instance;
+        std::vector<float32_t> state(ARM_RFFT_MIXED_STATE_LENGTH(n));
+        arm_rfft_mixed_init_f32(&instance, static_cast<uint16_t>(n), state.data());
+        rfft("arm_rfft_mixed_f32", n, [&](float32_t *p, float32_t *out) { arm_rfft_mixed_f32(&instance, p, out, 0); });
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * arm_fir_fft_f32 methods compared, built once against the scalar library
+ * (fir_fft_bench_scalar) and once against the ARM_MATH_X86_SIMD one
+ * (fir_fft_bench_x86simd): direct form, overlap-save and overlap-add for 16 to
+ * 4096 taps, with blocks of 64 and 512 samples. Filters longer than the block
+ * use several partitions.
+ *
+ * The SNR is measured over 16 blocks against the convolution computed in
+ * double. The last line of each filter gives the method ARM_FIR_FFT_AUTO
+ * selects and the one that was fastest: the cost constants of
+ * arm_fir_fft_init_f32.c come from this benchmark.
+ *
+ * Output: taps;block;method;ns_per_sample;snr_db
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "arm_math.h"
+
+static constexpr double MIN_SECONDS = 0.05; // Timing of each method
+static constexpr std::size_t NUM_BLOCKS = 16;
+
+static std::mt19937 rng(13);
+
+static std::vector<float32_t> randomVector(std::size_t n)
+{
+    std::uniform_real_distribution<float32_t> value(-1.0f, 1.0f);
+    std::vector<float32_t> v(n);
+    for (auto &x : v)
+    {
+        x = value(rng);
+    }
+    return v;
+}
+
+static const char *methodName(arm_fir_fft_method method)
+{
+    switch (method)
+    {
+    case ARM_FIR_FFT_DIRECT:
+        return "direct";
+    case ARM_FIR_FFT_OVERLAP_SAVE:
+        return "overlap_save";
+    case ARM_FIR_FFT_OVERLAP_ADD:
+        return "overlap_add";
+    default:
+        return "auto";
+    }
+}
+
+// Runs one method, prints its time per sample and SNR, returns the time
+static double run(uint16_t taps, uint16_t block, arm_fir_fft_method method,
+                  const std::vector<float32_t> &coeffs, const std::vector<float32_t> &input)
+{
+    std::vector<float32_t> state(ARM_FIR_FFT_STATE_LENGTH(taps, block)), out(input.size());
+    arm_fir_fft_instance_f32 filter;
+    arm_fir_fft_init_f32(&filter, taps, coeffs.data(), state.data(), block, method);
+
+    for (std::size_t b = 0; b < NUM_BLOCKS; b++)
+    {
+        arm_fir_fft_f32(&filter, &input[b * block], &out[b * block]);
+    }
+    double signal = 0.0, noise = 0.0;
+    for (std::size_t n = 0; n < input.size(); n++)
+    {
+        double exact = 0.0;
+        for (std::size_t k = 0; k < taps && k <= n; k++)
+        {
+            // Coefficients in time-reversed order, as arm_fir_f32 expects
+            exact += static_cast<double>(coeffs[taps - 1 - k]) * input[n - k];
+        }
+        signal += exact * exact;
+        noise += (out[n] - exact) * (out[n] - exact);
+    }
+    double snr = noise > 0.0 ? 10.0 * std::log10(signal / noise) : INFINITY;
+
+    long calls = 0;
+    std::size_t b = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            arm_fir_fft_f32(&filter, &input[b * block], &out[b * block]);
+            b = (b + 1) % NUM_BLOCKS;
+        }
+        calls += 16;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+
+    double ns = elapsed * 1e9 / (static_cast<double>(calls) * block);
+    std::printf("%u;%u;%s;%.2f;%.1f\n", taps, block, methodName(method), ns, snr);
+    return ns;
+}
+
+int main()
+{
+#if defined(ARM_MATH_X86_AVX2)
+    std::printf("# ARM_MATH_X86_SIMD, AVX2\n");
+#elif defined(ARM_MATH_X86_SIMD)
+    std::printf("# ARM_MATH_X86_SIMD, SSE4.2\n");
+#else
+    std::printf("# scalar\n");
+#endif
+    std::printf("taps;block;method;ns_per_sample;snr_db\n");
+    for (uint16_t block : {64, 512})
+    {
+        auto input = randomVector(NUM_BLOCKS * block);
+        for (uint16_t taps = 16; taps <= 4096; taps *= 2)
+        {
+            auto coeffs = randomVector(taps);
+            arm_fir_fft_method fastest = ARM_FIR_FFT_DIRECT;
+            double best = INFINITY;
+            for (arm_fir_fft_method method : {ARM_FIR_FFT_DIRECT, ARM_FIR_FFT_OVERLAP_SAVE, ARM_FIR_FFT_OVERLAP_ADD})
+            {
+                double ns = run(taps, block, method, coeffs, input);
+                if (ns < best)
+                {
+                    best = ns;
+                    fastest = method;
+                }
+            }
+
+            std::vector<float32_t> state(ARM_FIR_FFT_STATE_LENGTH(taps, block));
+            arm_fir_fft_instance_f32 filter;
+            arm_fir_fft_init_f32(&filter, taps, coeffs.data(), state.data(), block, ARM_FIR_FFT_AUTO);
+            std::printf("# auto: %s, fastest: %s\n", methodName(filter.method), methodName(fastest));
+        }
+    }
+    return 0;
+}
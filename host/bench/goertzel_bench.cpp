@@ -0,0 +1,212 @@
+/**
+ * A few DFT bins of a block of 1024 samples, built once against the scalar
+ * library (goertzel_bench_scalar) and once against the ARM_MATH_X86_SIMD one
+ * (goertzel_bench_x86simd): Goertzel filter bank and sliding DFT for 1 to 32
+ * bins, against the real FFT of the whole block, in f32 and Q31. The sliding
+ * DFT is timed over a block too, although it has all the bins of the last
+ * window at every sample.
+ *
+ * The SNR is measured over the bins against the DFT computed in double, the
+ * sliding DFT starting from a zero state. The last line of each format gives
+ * the number of bins from which the FFT is faster than the Goertzel bank.
+ *
+ * Output: format;bins;method;ns_per_block;snr_db
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+#include "arm_math.h"
+
+static constexpr double MIN_SECONDS = 0.05; // Timing of each method
+static constexpr uint16_t BLOCK = 1024;
+
+static std::mt19937 rng(17);
+
+// Nanoseconds per call of fn
+static double timeCall(const std::function<void()> &fn)
+{
+    long calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            fn();
+        }
+        calls += 16;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+    return elapsed * 1e9 / static_cast<double>(calls);
+}
+
+// SNR of the complex bins out against exact
+static double snr(const std::vector<double> &exact, const std::vector<double> &out)
+{
+    double signal = 0.0, noise = 0.0;
+    for (std::size_t i = 0; i < exact.size(); i++)
+    {
+        signal += exact[i] * exact[i];
+        noise += (out[i] - exact[i]) * (out[i] - exact[i]);
+    }
+    return noise > 0.0 ? 10.0 * std::log10(signal / noise) : INFINITY;
+}
+
+int main()
+{
+#if defined(ARM_MATH_X86_AVX2)
+    std::printf("# ARM_MATH_X86_SIMD, AVX2\n");
+#elif defined(ARM_MATH_X86_SIMD)
+    std::printf("# ARM_MATH_X86_SIMD, SSE4.2\n");
+#else
+    std::printf("# scalar\n");
+#endif
+    std::printf("format;bins;method;ns_per_block;snr_db\n");
+
+    std::uniform_real_distribution<double> value(-1.0, 1.0);
+    std::vector<float32_t> inputF32(BLOCK), bufferF32(BLOCK), fftF32(BLOCK);
+    std::vector<q31_t> inputQ31(BLOCK), bufferQ31(BLOCK), fftQ31(2 * BLOCK);
+    for (uint16_t n = 0; n < BLOCK; n++)
+    {
+        inputF32[n] = static_cast<float32_t>(value(rng));
+        inputQ31[n] = static_cast<q31_t>(inputF32[n] * 2147483648.0);
+    }
+
+    arm_rfft_fast_instance_f32 rfftF32;
+    arm_rfft_fast_init_f32(&rfftF32, BLOCK);
+    arm_rfft_instance_q31 rfftQ31;
+    arm_rfft_init_q31(&rfftQ31, BLOCK, 0, 1);
+
+    for (int q31 = 0; q31 < 2; q31++)
+    {
+        const char *format = q31 ? "q31" : "f32";
+        int crossover = 0;
+
+        for (uint16_t numBins = 1; numBins <= 32; numBins *= 2)
+        {
+            // Integer bins spread over the spectrum, away from 0 and N/2
+            std::vector<uint16_t> bins(numBins);
+            std::vector<float32_t> binsF32(numBins);
+            std::vector<double> exact(2 * numBins);
+            for (uint16_t i = 0; i < numBins; i++)
+            {
+                bins[i] = static_cast<uint16_t>((i + 1) * (BLOCK / 2) / (numBins + 1));
+                binsF32[i] = bins[i];
+                double re = 0.0, im = 0.0;
+                for (uint16_t n = 0; n < BLOCK; n++)
+                {
+                    double x = q31 ? inputQ31[n] / 2147483648.0 : inputF32[n];
+                    double w = 6.283185307179586 * bins[i] * n / BLOCK;
+                    re += x * std::cos(w);
+                    im -= x * std::sin(w);
+                }
+                exact[2 * i] = re;
+                exact[2 * i + 1] = im;
+            }
+
+            std::vector<float32_t> coeffs(ARM_GOERTZEL_COEFFS_PER_BIN * numBins), outF32(2 * numBins);
+            std::vector<float32_t> state(ARM_SDFT_STATE_LENGTH(numBins, BLOCK));
+            std::vector<q31_t> outQ31(2 * numBins);
+            std::vector<double> out(2 * numBins);
+            double goertzelNs, fftNs, ns;
+
+            // Goertzel filter bank
+            if (q31)
+            {
+                arm_goertzel_instance_q31 S;
+                arm_goertzel_init_q31(&S, numBins, binsF32.data(), reinterpret_cast<q31_t *>(coeffs.data()), BLOCK);
+                arm_goertzel_q31(&S, inputQ31.data(), outQ31.data());
+                for (std::size_t i = 0; i < out.size(); i++)
+                {
+                    out[i] = std::ldexp(outQ31[i] / 2147483648.0, S.shift);
+                }
+                goertzelNs = timeCall([&] { arm_goertzel_q31(&S, inputQ31.data(), outQ31.data()); });
+            }
+            else
+            {
+                arm_goertzel_instance_f32 S;
+                arm_goertzel_init_f32(&S, numBins, binsF32.data(), coeffs.data(), BLOCK);
+                arm_goertzel_f32(&S, inputF32.data(), outF32.data());
+                out.assign(outF32.begin(), outF32.end());
+                goertzelNs = timeCall([&] { arm_goertzel_f32(&S, inputF32.data(), outF32.data()); });
+            }
+            std::printf("%s;%u;goertzel;%.0f;%.1f\n", format, numBins, goertzelNs, snr(exact, out));
+
+            // Sliding DFT over the block, from a zero state: the last window is the block
+            if (q31)
+            {
+                arm_sdft_instance_q31 S;
+                auto *pState = reinterpret_cast<q31_t *>(state.data());
+                arm_sdft_init_q31(&S, numBins, bins.data(), 0x7FFFFFFF,
+                                  reinterpret_cast<q31_t *>(coeffs.data()), pState, BLOCK);
+                arm_sdft_q31(&S, inputQ31.data(), outQ31.data(), BLOCK);
+                for (std::size_t i = 0; i < out.size(); i++)
+                {
+                    out[i] = std::ldexp(outQ31[i] / 2147483648.0, S.shift);
+                }
+                ns = timeCall([&] { arm_sdft_q31(&S, inputQ31.data(), outQ31.data(), BLOCK); });
+            }
+            else
+            {
+                arm_sdft_instance_f32 S;
+                arm_sdft_init_f32(&S, numBins, bins.data(), 1.0f, coeffs.data(), state.data(), BLOCK);
+                arm_sdft_f32(&S, inputF32.data(), outF32.data(), BLOCK);
+                out.assign(outF32.begin(), outF32.end());
+                ns = timeCall([&] { arm_sdft_f32(&S, inputF32.data(), outF32.data(), BLOCK); });
+            }
+            std::printf("%s;%u;sdft;%.0f;%.1f\n", format, numBins, ns, snr(exact, out));
+
+            // Real FFT of the whole block, the bins read from its output
+            if (q31)
+            {
+                // The input buffer is modified
+                auto fft = [&] {
+                    bufferQ31 = inputQ31;
+                    arm_rfft_q31(&rfftQ31, bufferQ31.data(), fftQ31.data());
+                };
+                fft();
+                for (uint16_t i = 0; i < numBins; i++)
+                {
+                    // 11.21 format for 1024 points
+                    out[2 * i] = std::ldexp(fftQ31[2 * bins[i]] / 2147483648.0, 10);
+                    out[2 * i + 1] = std::ldexp(fftQ31[2 * bins[i] + 1] / 2147483648.0, 10);
+                }
+                fftNs = timeCall(fft);
+            }
+            else
+            {
+                auto fft = [&] {
+                    bufferF32 = inputF32;
+                    arm_rfft_fast_f32(&rfftF32, bufferF32.data(), fftF32.data(), 0);
+                };
+                fft();
+                for (uint16_t i = 0; i < numBins; i++)
+                {
+                    out[2 * i] = fftF32[2 * bins[i]];
+                    out[2 * i + 1] = fftF32[2 * bins[i] + 1];
+                }
+                fftNs = timeCall(fft);
+            }
+            std::printf("%s;%u;rfft;%.0f;%.1f\n", format, numBins, fftNs, snr(exact, out));
+
+            if (crossover == 0 && fftNs < goertzelNs)
+            {
+                crossover = numBins;
+            }
+        }
+
+        if (crossover > 0)
+        {
+            std::printf("# %s: the FFT is faster from %d bins\n", format, crossover);
+        }
+        else
+        {
+            std::printf("# %s: the Goertzel bank is faster up to 32 bins\n", format);
+        }
+    }
+    return 0;
+}
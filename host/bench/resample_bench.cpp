@@ -0,0 +1,253 @@
+/**
+ * Rational sample rate conversion, built once against the scalar library
+ * (resample_bench_scalar) and once against the ARM_MATH_X86_SIMD one
+ * (resample_bench_x86simd): the polyphase resampler arm_fir_resample_xxx, on
+ * blocks and one sample at a time, against arm_fir_interpolate_xxx followed by
+ * arm_fir_decimate_xxx, each with its own Kaiser filter of 20 taps per unit
+ * of its factor, for 48 kHz <-> 44.1 kHz (147/160) and small ratios.
+ *
+ * The SNR is measured against the ideal resampled signal, two sinusoids in
+ * the passband, computed in double after the delay of the filters. The
+ * Farrow interpolator runs the same conversions with a step of M/L.
+ *
+ * Output: format;L;M;method;ns_per_input_sample;snr_db
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#include "arm_math.h"
+
+static constexpr double MIN_SECONDS = 0.05; // Timing of each method
+static constexpr double BETA = 5.0;         // Kaiser window of the filters
+static constexpr int TAPS_PER_FACTOR = 20;
+
+// Nanoseconds per call of fn
+static double timeCall(const std::function<void()> &fn)
+{
+    long calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do
+    {
+        fn();
+        calls++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+    return elapsed * 1e9 / static_cast<double>(calls);
+}
+
+// Two sinusoids in the passband of every ratio, in cycles per input sample
+static double signal(double t)
+{
+    return 0.4 * std::sin(6.283185307179586 * 0.031 * t) + 0.3 * std::sin(6.283185307179586 * 0.093 * t);
+}
+
+// SNR of out[m] against the signal at input time (m*M - delay)/L, after the transient
+static double snr(const std::vector<double> &out, uint32_t L, uint32_t M, double delay, uint32_t numInputs)
+{
+    double sig = 0.0, noise = 0.0;
+    for (std::size_t m = 0; m < out.size(); m++)
+    {
+        double t = (static_cast<double>(m) * M - delay) / L;
+        if (t < 64.0 || t > numInputs - 1.0)
+        {
+            continue;
+        }
+        double exact = signal(t);
+        sig += exact * exact;
+        noise += (out[m] - exact) * (out[m] - exact);
+    }
+    return 10.0 * std::log10(sig / noise);
+}
+
+template <typename T> struct Ops;
+
+template <> struct Ops<float32_t>
+{
+    using Resample = arm_fir_resample_instance_f32;
+    using Interpolate = arm_fir_interpolate_instance_f32;
+    using Decimate = arm_fir_decimate_instance_f32;
+    static constexpr const char *name = "f32";
+    static void fromFloat(const float32_t *src, float32_t *dst, uint32_t n) { arm_copy_f32(src, dst, n); }
+    static double toDouble(float32_t v) { return v; }
+    static constexpr auto resampleInit = arm_fir_resample_init_f32;
+    static constexpr auto resample = arm_fir_resample_f32;
+    static constexpr auto interpolateInit = arm_fir_interpolate_init_f32;
+    static constexpr auto interpolate = arm_fir_interpolate_f32;
+    static constexpr auto decimateInit = arm_fir_decimate_init_f32;
+    static constexpr auto decimate = arm_fir_decimate_f32;
+};
+
+template <> struct Ops<q31_t>
+{
+    using Resample = arm_fir_resample_instance_q31;
+    using Interpolate = arm_fir_interpolate_instance_q31;
+    using Decimate = arm_fir_decimate_instance_q31;
+    static constexpr const char *name = "q31";
+    static void fromFloat(const float32_t *src, q31_t *dst, uint32_t n) { arm_float_to_q31(src, dst, n); }
+    static double toDouble(q31_t v) { return v / 2147483648.0; }
+    static constexpr auto resampleInit = arm_fir_resample_init_q31;
+    static constexpr auto resample = arm_fir_resample_q31;
+    static constexpr auto interpolateInit = arm_fir_interpolate_init_q31;
+    static constexpr auto interpolate = arm_fir_interpolate_q31;
+    static constexpr auto decimateInit = arm_fir_decimate_init_q31;
+    static constexpr auto decimate = arm_fir_decimate_q31;
+};
+
+template <> struct Ops<q15_t>
+{
+    using Resample = arm_fir_resample_instance_q15;
+    using Interpolate = arm_fir_interpolate_instance_q15;
+    using Decimate = arm_fir_decimate_instance_q15;
+    static constexpr const char *name = "q15";
+    static void fromFloat(const float32_t *src, q15_t *dst, uint32_t n) { arm_float_to_q15(src, dst, n); }
+    static double toDouble(q15_t v) { return v / 32768.0; }
+    static constexpr auto resampleInit = arm_fir_resample_init_q15;
+    static constexpr auto resample = arm_fir_resample_q15;
+    static constexpr auto interpolateInit = arm_fir_interpolate_init_q15;
+    static constexpr auto interpolate = arm_fir_interpolate_q15;
+    static constexpr auto decimateInit = arm_fir_decimate_init_q15;
+    static constexpr auto decimate = arm_fir_decimate_q15;
+};
+
+template <typename T>
+static void run(uint16_t L, uint16_t M, const std::vector<float32_t> &inputF32)
+{
+    using O = Ops<T>;
+    const uint32_t numInputs = static_cast<uint32_t>(inputF32.size());
+    const uint32_t block = numInputs / 8U; // A multiple of M, for the decimator
+    const double ns = 1.0 / numInputs;
+
+    std::vector<T> input(numInputs);
+    O::fromFloat(inputF32.data(), input.data(), numInputs);
+
+    // One filter for the resampler, cutoff 1/max(L, M); its taps a multiple of L for the interpolator
+    uint16_t numTaps = static_cast<uint16_t>((TAPS_PER_FACTOR * (L > M ? L : M) + L - 1) / L * L);
+    std::vector<float32_t> coeffsF32(numTaps);
+    arm_fir_resample_design_f32(L, M, numTaps, BETA, coeffsF32.data());
+    std::vector<T> coeffs(numTaps);
+    O::fromFloat(coeffsF32.data(), coeffs.data(), numTaps);
+
+    std::vector<T> state(ARM_FIR_RESAMPLE_STATE_LENGTH(numTaps, L));
+    std::vector<T> output(ARM_FIR_RESAMPLE_MAX_OUTPUTS(numInputs, L, M));
+    typename O::Resample resampler;
+    uint32_t numOutputs = 0;
+    std::vector<double> outputDouble;
+
+    // Blocks
+    double blockNs = timeCall([&] {
+        O::resampleInit(&resampler, L, M, numTaps, coeffs.data(), state.data());
+        numOutputs = 0;
+        for (uint32_t n = 0; n < numInputs; n += block)
+        {
+            numOutputs += O::resample(&resampler, input.data() + n, output.data() + numOutputs, block);
+        }
+    });
+    outputDouble.assign(numOutputs, 0.0);
+    for (uint32_t m = 0; m < numOutputs; m++)
+    {
+        outputDouble[m] = O::toDouble(output[m]);
+    }
+    std::printf("%s;%u;%u;resample_block;%.2f;%.1f\n", O::name, L, M, blockNs * ns,
+                snr(outputDouble, L, M, 0.5 * (numTaps - 1), numInputs));
+
+    // One sample at a time
+    double sampleNs = timeCall([&] {
+        O::resampleInit(&resampler, L, M, numTaps, coeffs.data(), state.data());
+        numOutputs = 0;
+        for (uint32_t n = 0; n < numInputs; n++)
+        {
+            numOutputs += O::resample(&resampler, input.data() + n, output.data() + numOutputs, 1);
+        }
+    });
+    std::printf("%s;%u;%u;resample_sample;%.2f;%.1f\n", O::name, L, M, sampleNs * ns,
+                snr(outputDouble, L, M, 0.5 * (numTaps - 1), numInputs));
+
+    // Interpolator by L (cutoff 1/L) then decimator by M (cutoff 1/M), both at the upsampled rate
+    uint16_t interpolateTaps = static_cast<uint16_t>(TAPS_PER_FACTOR * L);
+    uint16_t decimateTaps = static_cast<uint16_t>(TAPS_PER_FACTOR * M);
+    std::vector<float32_t> interpolateF32(interpolateTaps), decimateF32(decimateTaps);
+    arm_fir_resample_design_f32(L, 1, interpolateTaps, BETA, interpolateF32.data());
+    arm_fir_resample_design_f32(1, M, decimateTaps, BETA, decimateF32.data());
+    std::vector<T> interpolateCoeffs(interpolateTaps), decimateCoeffs(decimateTaps);
+    O::fromFloat(interpolateF32.data(), interpolateCoeffs.data(), interpolateTaps);
+    O::fromFloat(decimateF32.data(), decimateCoeffs.data(), decimateTaps);
+
+    std::vector<T> interpolateState(interpolateTaps / L + block - 1);
+    std::vector<T> decimateState(decimateTaps + block * L - 1);
+    std::vector<T> upsampled(block * L);
+    typename O::Interpolate interpolator;
+    typename O::Decimate decimator;
+    double chainNs = timeCall([&] {
+        O::interpolateInit(&interpolator, static_cast<uint8_t>(L), interpolateTaps, interpolateCoeffs.data(),
+                           interpolateState.data(), block);
+        O::decimateInit(&decimator, decimateTaps, static_cast<uint8_t>(M), decimateCoeffs.data(), decimateState.data(),
+                        block * L);
+        for (uint32_t n = 0; n < numInputs; n += block)
+        {
+            O::interpolate(&interpolator, input.data() + n, upsampled.data(), block);
+            O::decimate(&decimator, upsampled.data(), output.data() + n * L / M, block * L);
+        }
+    });
+    outputDouble.assign(numInputs * L / M, 0.0);
+    for (std::size_t m = 0; m < outputDouble.size(); m++)
+    {
+        outputDouble[m] = O::toDouble(output[m]);
+    }
+    std::printf("%s;%u;%u;interpolate_decimate;%.2f;%.1f\n", O::name, L, M, chainNs * ns,
+                snr(outputDouble, L, M, 0.5 * (interpolateTaps - 1) + 0.5 * (decimateTaps - 1), numInputs));
+}
+
+static void runFarrow(uint16_t L, uint16_t M, const std::vector<float32_t> &input)
+{
+    const uint32_t numInputs = static_cast<uint32_t>(input.size());
+    const uint32_t block = numInputs / 8U;
+    std::vector<float32_t> output(numInputs * L / M + 8);
+    arm_farrow_instance_f32 farrow;
+    uint32_t numOutputs = 0;
+    double blockNs = timeCall([&] {
+        arm_farrow_init_f32(&farrow, static_cast<float32_t>(M) / L, 0.0f);
+        numOutputs = 0;
+        for (uint32_t n = 0; n < numInputs; n += block)
+        {
+            numOutputs += arm_farrow_f32(&farrow, input.data() + n, output.data() + numOutputs, block);
+        }
+    });
+    // Output m is the input at m*M/L - 1, the delay of the interpolator
+    std::vector<double> outputDouble(output.begin(), output.begin() + numOutputs);
+    std::printf("f32;%u;%u;farrow;%.2f;%.1f\n", L, M, blockNs / numInputs,
+                snr(outputDouble, L, M, static_cast<double>(L), numInputs));
+}
+
+int main()
+{
+#if defined(ARM_MATH_X86_AVX2)
+    std::printf("# ARM_MATH_X86_SIMD, AVX2\n");
+#elif defined(ARM_MATH_X86_SIMD)
+    std::printf("# ARM_MATH_X86_SIMD, SSE4.2\n");
+#else
+    std::printf("# scalar\n");
+#endif
+    std::printf("format;L;M;method;ns_per_input_sample;snr_db\n");
+
+    const uint16_t ratios[][2] = {{147, 160}, {160, 147}, {3, 2}, {2, 3}, {1, 3}};
+    for (const auto &ratio : ratios)
+    {
+        uint16_t L = ratio[0], M = ratio[1];
+        // 8 blocks of a multiple of M samples
+        uint32_t numInputs = 8U * M * ((512U + M - 1U) / M);
+        std::vector<float32_t> input(numInputs);
+        for (uint32_t n = 0; n < numInputs; n++)
+        {
+            input[n] = static_cast<float32_t>(signal(n));
+        }
+        run<float32_t>(L, M, input);
+        run<q31_t>(L, M, input);
+        run<q15_t>(L, M, input);
+        runFarrow(L, M, input);
+    }
+    return 0;
+}
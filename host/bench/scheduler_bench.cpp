@@ -0,0 +1,141 @@
+/**
+ * Scheduler scaling benchmark: Cadmium's RootCoordinator against
+ * HeapRootCoordinator, in virtual time, for 10 to 10,000 atomic models.
+ *
+ * Every model is a periodic virtual sensor with its own period, wired to the
+ * next model in a ring, so each event has one imminent model and one
+ * influenced model, like a large set of unsynchronised sensors. Periods scale
+ * with the model count so every run processes about the same number of
+ * events. Both schedulers must end with the same number of transitions.
+ *
+ * Output (one line per model count): models;events;cadmium_us_per_event;heap_us_per_event;speedup
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include "cadmium/modeling/devs/atomic.hpp"
+#include "cadmium/modeling/devs/coupled.hpp"
+#include "cadmium/simulation/root_coordinator.hpp"
+#include "heap_coordinator.hpp"
+
+using namespace cadmium;
+
+// State of one virtual sensor
+struct SensorState
+{
+    double sigma;   // Time to the next sample
+    double period;  // Sampling period
+    long received;  // Samples received from the previous sensor
+
+    explicit SensorState(double period) : sigma(period), period(period), received(0) {}
+};
+
+std::ostream &operator<<(std::ostream &out, const SensorState &state)
+{
+    out << state.received;
+    return out;
+}
+
+// Periodic sensor forwarding a sample to its neighbour
+class Sensor : public Atomic<SensorState>
+{
+public:
+    Port<int> in;
+    Port<int> out;
+
+    Sensor(const std::string &id, double period) : Atomic<SensorState>(id, SensorState(period))
+    {
+        in = addInPort<int>("in");
+        out = addOutPort<int>("out");
+    }
+
+    long received() const { return state.received; }
+
+    void internalTransition(SensorState &state) const override
+    {
+        state.sigma = state.period;
+    }
+
+    void externalTransition(SensorState &state, double e) const override
+    {
+        state.received += static_cast<long>(in->getBag().size());
+        state.sigma -= e;
+    }
+
+    void output(const SensorState &state) const override
+    {
+        out->addMessage(1);
+    }
+
+    [[nodiscard]] double timeAdvance(const SensorState &state) const override
+    {
+        return state.sigma;
+    }
+};
+
+// Ring of n sensors with random periods in [n/2, n)
+class SensorRing : public Coupled
+{
+public:
+    std::vector<std::shared_ptr<Sensor>> sensors;
+
+    SensorRing(const std::string &id, std::size_t n, unsigned seed) : Coupled(id)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> period(0.5 * n, 1.0 * n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            sensors.push_back(addComponent<Sensor>("sensor" + std::to_string(i), period(rng)));
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            addCoupling(sensors[i]->out, sensors[(i + 1) % n]->in);
+        }
+    }
+
+    long received() const
+    {
+        long total = 0;
+        for (const auto &sensor : sensors)
+        {
+            total += sensor->received();
+        }
+        return total;
+    }
+};
+
+template <class Coordinator>
+static double run(std::size_t n, long events, long &received)
+{
+    auto model = std::make_shared<SensorRing>("ring", n, 42);
+    Coordinator coordinator(model);
+    coordinator.start();
+    auto begin = std::chrono::steady_clock::now();
+    coordinator.simulate(events);
+    auto end = std::chrono::steady_clock::now();
+    coordinator.stop();
+    received = model->received();
+    return std::chrono::duration<double, std::micro>(end - begin).count() / events;
+}
+
+int main(int argc, char **argv)
+{
+    long events = argc > 1 ? std::atol(argv[1]) : 20000;
+    std::printf("models;events;cadmium_us_per_event;heap_us_per_event;speedup\n");
+    for (std::size_t n : {10, 30, 100, 300, 1000, 3000, 10000})
+    {
+        long cadmiumReceived = 0;
+        long heapReceived = 0;
+        double cadmiumTime = run<RootCoordinator>(n, events, cadmiumReceived);
+        double heapTime = run<HeapRootCoordinator<>>(n, events, heapReceived);
+        if (cadmiumReceived != heapReceived)
+        {
+            std::fprintf(stderr, "mismatch at %zu models: %ld vs %ld samples\n", n, cadmiumReceived, heapReceived);
+            return 1;
+        }
+        std::printf("%zu;%ld;%.3f;%.3f;%.1f\n", n, events, cadmiumTime, heapTime, cadmiumTime / heapTime);
+    }
+    return 0;
+}
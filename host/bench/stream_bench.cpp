@@ -0,0 +1,242 @@
+/**
+ * Log output benchmark: the blocking UART path (_write -> __io_putchar at
+ * 115200 baud) against the USB CDC stream (LogStream, log_stream.hpp) on the
+ * lines of a recorded log, replayed in virtual time at their time stamps.
+ *
+ * Each log line is repeated for every room (-r, default 1, 8 for a building)
+ * to show where each link saturates. Lines without a time stamp (reports)
+ * come out at the time of the last logged line, as at the end of a run.
+ *
+ * Links (1 ms steps):
+ *  - uart: the producer blocks until every byte is out (86.8 µs per byte);
+ *    stall is the time the coordinator spends in _write, lag how far the
+ *    output is behind the event that printed it.
+ *  - usb: transfers of up to 512 bytes straight from the ring, at the
+ *    full-speed bulk rate (-u bytes per ms, 1000 by default). An idle link
+ *    starts on a full packet or after the events of a time step (as
+ *    UsbStreamClock), a busy one chains what was written meanwhile (as the
+ *    transfer-complete interrupt). The producer never blocks.
+ *  - usb_slow_host: the same with a host reading only 4 bytes per ms
+ *    (a terminal falling behind), to show the downsampling and drops.
+ * The CPU cost per byte of LogStream::write is measured on this machine.
+ *
+ * Usage:
+ *   stream_bench [-r rooms] [-u bytes_per_ms] recorded.log
+ * Output: link;rooms;bytes;lines;delivered_bytes;downsampled;dropped;stall_s;max_lag_ms;peak_fill
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "log_stream.hpp"
+
+using namespace cadmium;
+
+struct Line
+{
+    double time;
+    std::string text;
+};
+
+static bool loadLog(const char *path, std::vector<Line> &lines)
+{
+    FILE *file = std::strcmp(path, "-") == 0 ? stdin : std::fopen(path, "r");
+    if (file == nullptr)
+    {
+        std::fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    char buffer[512];
+    double last = 0;
+    while (std::fgets(buffer, sizeof(buffer), file) != nullptr)
+    {
+        double time;
+        if (buffer[0] >= '0' && buffer[0] <= '9' && std::sscanf(buffer, "%lf;", &time) == 1)
+        {
+            last = time;
+        }
+        lines.push_back({last, buffer});
+    }
+    if (file != stdin)
+    {
+        std::fclose(file);
+    }
+    return true;
+}
+
+struct Result
+{
+    unsigned long bytes = 0;
+    unsigned long lines = 0;
+    unsigned long delivered = 0;
+    unsigned long downsampled = 0;
+    unsigned long dropped = 0;
+    double stall = 0;  // Seconds the producer spent blocked
+    double maxLag = 0; // Longest delay between an event and the end of its output (s)
+    unsigned long peak = 0;
+};
+
+// Blocking byte-by-byte UART: output of an event starts when the previous one is out
+static Result uart(const std::vector<Line> &lines, int rooms, double baud)
+{
+    const double byteTime = 10.0 / baud; // 8N1
+    Result r;
+    double busyUntil = 0;
+    for (const Line &line : lines)
+    {
+        for (int k = 0; k < rooms; k++)
+        {
+            double start = busyUntil > line.time ? busyUntil : line.time;
+            double end = start + line.text.size() * byteTime;
+            r.stall += end - start; // _write returns once the last byte is in the shift register
+            r.maxLag = end - line.time > r.maxLag ? end - line.time : r.maxLag;
+            busyUntil = end;
+            r.bytes += line.text.size();
+            r.delivered += line.text.size();
+            r.lines++;
+        }
+    }
+    return r;
+}
+
+// USB CDC: LogStream producer, link draining whole transfers at bytesPerMs
+static Result usb(const std::vector<Line> &lines, int rooms, double bytesPerMs)
+{
+    auto ring = std::make_unique<LogStream<16384>>(); // As UsbCdc (USB_STREAM_BYTES)
+    LogStream<16384> &stream = *ring;
+    Result r;
+    std::vector<std::pair<unsigned long, double>> marks; // Stream position and time of every written line
+    unsigned long written = 0;
+    unsigned long sent = 0;
+    double credit = 0;
+    uint32_t inFlight = 0;
+    std::size_t next = 0;
+    std::size_t markSent = 0;
+    bool chained = false; // A transfer is in flight, the link restarts by itself
+    const double end = lines.empty() ? 0 : lines.back().time + 600.0;
+
+    for (double now = 0; now <= end; now += 1e-3)
+    {
+        bool produced = false;
+        while (next < lines.size() && lines[next].time <= now + 1e-9)
+        {
+            for (int k = 0; k < rooms; k++)
+            {
+                uint32_t before = stream.fill();
+                stream.write(lines[next].text.data(), static_cast<uint32_t>(lines[next].text.size()));
+                written += stream.fill() - before; // Bytes actually kept (the link is not draining meanwhile)
+                marks.push_back({written, lines[next].time});
+                r.bytes += lines[next].text.size();
+                r.lines++;
+            }
+            next++;
+            produced = true;
+        }
+
+        // Link: finish the transfer in flight, then start the next one (flush once the events of this step are out)
+        credit += bytesPerMs;
+        bool completed = false; // A transfer just ended: the next one is started from its interrupt with what is there
+        for (;;)
+        {
+            if (inFlight == 0)
+            {
+                uint32_t len;
+                if (stream.pending(len, produced || completed || chained || next == lines.size()) == nullptr)
+                {
+                    break;
+                }
+                inFlight = len;
+            }
+            if (credit < inFlight)
+            {
+                break;
+            }
+            credit -= inFlight;
+            stream.release(inFlight);
+            sent += inFlight;
+            inFlight = 0;
+            completed = true;
+            while (markSent < marks.size() && marks[markSent].first <= sent)
+            {
+                double lag = now - marks[markSent].second;
+                r.maxLag = lag > r.maxLag ? lag : r.maxLag;
+                markSent++;
+            }
+        }
+        chained = inFlight != 0;
+        credit = inFlight == 0 && credit > LOG_STREAM_PACKET ? LOG_STREAM_PACKET : credit; // An idle link saves no bandwidth
+        if (next == lines.size() && stream.fill() == 0 && inFlight == 0)
+        {
+            break;
+        }
+    }
+    r.delivered = sent;
+    r.downsampled = stream.downsampledLines();
+    r.dropped = stream.droppedLines();
+    r.peak = stream.peakFill();
+    return r;
+}
+
+static void print(const char *link, int rooms, const Result &r)
+{
+    std::printf("%s;%d;%lu;%lu;%lu;%lu;%lu;%.3f;%.1f;%lu\n", link, rooms, r.bytes, r.lines, r.delivered, r.downsampled, r.dropped,
+                r.stall, r.maxLag * 1e3, r.peak);
+}
+
+int main(int argc, char **argv)
+{
+    int rooms = 1;
+    double bytesPerMs = 1000.0;
+    const char *path = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+        {
+            rooms = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "-u") == 0 && i + 1 < argc)
+        {
+            bytesPerMs = std::atof(argv[++i]);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    std::vector<Line> lines;
+    if (path == nullptr || rooms < 1 || !loadLog(path, lines))
+    {
+        std::fprintf(stderr, "usage: stream_bench [-r rooms] [-u bytes_per_ms] recorded.log\n");
+        return 2;
+    }
+
+    std::printf("link;rooms;bytes;lines;delivered_bytes;downsampled;dropped;stall_s;max_lag_ms;peak_fill\n");
+    print("uart", rooms, uart(lines, rooms, 115200.0));
+    print("usb", rooms, usb(lines, rooms, bytesPerMs));
+    print("usb_slow_host", rooms, usb(lines, rooms, 4.0));
+
+    // Producer cost: the whole log through the ring, drained without a link model
+    static LogStream<16384> stream;
+    unsigned long bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < 200; repeat++)
+    {
+        for (const Line &line : lines)
+        {
+            stream.write(line.text.data(), static_cast<uint32_t>(line.text.size()));
+            bytes += line.text.size();
+            uint32_t len;
+            while (stream.pending(len, false) != nullptr)
+            {
+                stream.release(len);
+            }
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::printf("write_ns_per_byte;%.2f\n", ns / bytes);
+    return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * Telemetry column benchmark: one synthetic day of the lab signals sampled
+ * every 2 s (43,200 samples) appended to a TelemetryStore (telemetry.hpp).
+ *
+ * Signals: CO2 following occupancy (400 ppm empty, rising while occupied)
+ * with ADC noise, temperature drifting by tenths of a degree like the DHT11,
+ * servo duty cycle switching between two positions, and the PIR level.
+ *
+ * Every window summary (1 min to 4 h, every 997 samples) is checked against a
+ * brute-force pass over the same samples, and must cover exactly the samples
+ * asked for while their raw values are held. The raw samples still held are
+ * checked against the quantised history. The run fails on any mismatch.
+ *
+ * Output:
+ *   column;coded_bytes_per_sample;held_samples;held_hours;summary_hours;column_bytes_per_sample
+ * where coded bytes only count the byte ring and column bytes spread the
+ * whole column (headers included) over the summary horizon.
+ *   window_s;summaries;ns_per_summary;brute_ns_per_summary
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "telemetry.hpp"
+
+using namespace cadmium;
+
+static TelemetryStore store;
+
+// Quantised history of one column, as the store sees it
+struct History
+{
+    float step;
+    std::vector<int32_t> q;
+
+    void append(float value) { q.push_back(static_cast<int32_t>(std::nearbyint(value / step))); }
+
+    // Min, max and mean of the last n samples, like DeltaColumn::summary
+    TelemetrySummary brute(uint32_t n) const
+    {
+        int32_t lo = q[q.size() - n], hi = lo;
+        int64_t sum = 0;
+        for (std::size_t i = q.size() - n; i < q.size(); i++)
+        {
+            lo = std::min(lo, q[i]);
+            hi = std::max(hi, q[i]);
+            sum += q[i];
+        }
+        return {n, lo * step, hi * step, static_cast<float>(static_cast<double>(sum) / n) * step};
+    }
+};
+
+static bool same(const TelemetrySummary &a, const TelemetrySummary &b)
+{
+    return a.samples == b.samples && a.min == b.min && a.max == b.max && std::fabs(a.mean - b.mean) <= 1e-6f * (1.0f + std::fabs(b.mean));
+}
+
+int main()
+{
+    const double period = 2.0;
+    const uint32_t day = static_cast<uint32_t>(24 * 3600 / period);
+    store.reset(period);
+
+    History ppm{1.0f, {}}, temperature{0.1f, {}}, duty{0.001f, {}};
+    std::vector<bool> motion;
+    std::mt19937 rng(12345);
+    std::normal_distribution<float> adcNoise(0.0f, 3.0f);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+    float co2 = 400.0f;
+    float celsius = 21.0f;
+    bool occupied = false;
+    uint32_t failures = 0;
+    uint32_t checks = 0;
+
+    for (uint32_t i = 0; i < day; i++)
+    {
+        double hour = i * period / 3600.0;
+        bool working = hour >= 8.0 && hour < 18.0;
+        if (uniform(rng) < (working ? 0.004f : 0.0005f))
+        {
+            occupied = !occupied; // PIR level changes every few minutes while people are around
+        }
+        co2 += occupied ? 0.4f : (400.0f - co2) * 0.002f;
+        if (uniform(rng) < 0.01f)
+        {
+            celsius += (working ? 0.1f : -0.1f) * (uniform(rng) < 0.7f ? 1.0f : -1.0f); // DHT11 moves in tenths
+        }
+        double dutyCycle = celsius > 25.0f ? 0.10 : 0.05;
+        float co2Read = std::nearbyint(co2 + adcNoise(rng));
+
+        store.append(co2Read, celsius, dutyCycle, occupied);
+        ppm.append(co2Read);
+        temperature.append(celsius);
+        duty.append(static_cast<float>(dutyCycle));
+        motion.push_back(occupied);
+
+        // Summaries against brute force, and raw samples against the history
+        if (i % 997 == 996)
+        {
+            for (double window : {60.0, 600.0, 3600.0, 14400.0})
+            {
+                uint32_t n = std::min(store.samplesIn(window), i + 1);
+                TelemetrySummary s = store.ppm.summary(n);
+                checks++;
+                failures += !same(s, ppm.brute(s.samples)) || (n <= store.ppm.heldSamples() && s.samples != n);
+                s = store.temperature.summary(n);
+                checks++;
+                failures += !same(s, temperature.brute(s.samples)) || (n <= store.temperature.heldSamples() && s.samples != n);
+                s = store.duty.summary(n);
+                checks++;
+                failures += !same(s, duty.brute(s.samples)) || (n <= store.duty.heldSamples() && s.samples != n);
+                s = store.motion.summary(n);
+                uint32_t ones = 0;
+                for (std::size_t k = motion.size() - s.samples; k < motion.size(); k++)
+                {
+                    ones += motion[k];
+                }
+                checks++;
+                failures += s.samples != n || s.mean != static_cast<float>(ones) / s.samples || s.max != (ones > 0 ? 1.0f : 0.0f) ||
+                            s.min != (ones == s.samples ? 1.0f : 0.0f);
+            }
+            auto replayed = [&](const auto &column, const History &h)
+            {
+                std::size_t k = h.q.size() - column.heldSamples();
+                bool match = true;
+                column.replay(column.heldSamples(), [&](float v)
+                              { match &= v == h.q[k++] * h.step; });
+                checks++;
+                failures += !match;
+            };
+            replayed(store.ppm, ppm);
+            replayed(store.temperature, temperature);
+            replayed(store.duty, duty);
+        }
+    }
+
+    std::printf("column;coded_bytes_per_sample;held_samples;held_hours;summary_hours;column_bytes_per_sample\n");
+    const uint32_t horizon = (TELEMETRY_BLOCKS - 1) * TELEMETRY_BLOCK_SAMPLES;
+    const double summaryHours = horizon * period / 3600.0;
+    auto columnRow = [&](const char *name, const auto &column)
+    {
+        std::printf("%s;%.3f;%lu;%.2f;%.2f;%.3f\n", name, static_cast<double>(column.heldBytes()) / column.heldSamples(),
+                    (unsigned long)column.heldSamples(), column.heldSamples() * period / 3600.0, summaryHours,
+                    static_cast<double>(sizeof(column)) / horizon);
+    };
+    columnRow("ppm", store.ppm);
+    columnRow("temperature", store.temperature);
+    columnRow("duty", store.duty);
+    uint32_t motionHeld = std::min<uint32_t>(day, horizon);
+    std::printf("motion;%.3f;%lu;%.2f;%.2f;%.3f\n", 1.0 / 8, (unsigned long)motionHeld, motionHeld * period / 3600.0, summaryHours,
+                static_cast<double>(sizeof(BitColumn)) / horizon);
+    std::printf("raw_bytes_per_sample;%.3f\n", static_cast<double>(sizeof(float)));
+    std::printf("store_bytes;%zu\n", sizeof(TelemetryStore));
+
+    // Query cost, store against a brute-force pass over the same samples
+    std::printf("window_s;summaries;ns_per_summary;brute_ns_per_summary\n");
+    for (double window : {60.0, 600.0, 3600.0, 14400.0})
+    {
+        const int repeats = 100000;
+        uint32_t n = store.samplesIn(window);
+        volatile float sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; r++)
+        {
+            sink = sink + store.ppm.summary(n + (r & 1)).mean;
+        }
+        auto middle = std::chrono::steady_clock::now();
+        const int bruteRepeats = 1000;
+        uint32_t covered = store.ppm.summary(n).samples;
+        for (int r = 0; r < bruteRepeats; r++)
+        {
+            sink = sink + ppm.brute(covered - (r & 1)).mean;
+        }
+        auto end = std::chrono::steady_clock::now();
+        std::printf("%.0f;%d;%.1f;%.1f\n", window, repeats,
+                    std::chrono::duration<double, std::nano>(middle - start).count() / repeats,
+                    std::chrono::duration<double, std::nano>(end - middle).count() / bruteRepeats);
+    }
+
+    std::printf("checks;%lu;failures;%lu\n", (unsigned long)checks, (unsigned long)failures);
+    return failures == 0 ? 0 : 1;
+}
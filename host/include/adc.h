@@ -0,0 +1,19 @@
+/* Host stand-in for the CubeMX adc.h */
+#ifndef HOST_ADC_H
+#define HOST_ADC_H
+
+#include "stm32h7xx_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern HAL_HOST_STATE ADC_HandleTypeDef hadc1;
+
+void MX_ADC1_Init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_ADC_H */
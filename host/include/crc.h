@@ -0,0 +1,19 @@
+/* Host stand-in for the CubeMX crc.h */
+#ifndef HOST_CRC_H
+#define HOST_CRC_H
+
+#include "stm32h7xx_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern HAL_HOST_STATE CRC_HandleTypeDef hcrc;
+
+void MX_CRC_Init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_CRC_H */
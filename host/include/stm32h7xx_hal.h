@@ -0,0 +1,432 @@
+/**
+ * Host stand-in for the subset of the STM32H7 HAL used by the DEVS models.
+ *
+ * Peripherals are plain structs in RAM with the same register layout as the
+ * device (GPIO, TIM, ADC, RCC), so register-level code behaves the same on the
+ * host. Sensor inputs are driven through the hal_host_* functions at the end of
+ * this file.
+ */
+
+#ifndef HOST_STM32H7XX_HAL_H
+#define HOST_STM32H7XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h> /* Pulled in by stm32h7xx_hal_def.h on the device */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Common ------------------------------------------------------------------*/
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum { RESET = 0U, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { DISABLE = 0U, ENABLE = !DISABLE } FunctionalState;
+
+#define HAL_MAX_DELAY      0xFFFFFFFFU
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+/* RCC ---------------------------------------------------------------------*/
+typedef struct
+{
+  volatile uint32_t AHB1ENR;
+  volatile uint32_t AHB2ENR;
+  volatile uint32_t AHB3ENR;
+  volatile uint32_t AHB4ENR;
+  volatile uint32_t APB1LENR;
+  volatile uint32_t APB1HENR;
+  volatile uint32_t APB2ENR;
+  volatile uint32_t APB4ENR;
+} RCC_TypeDef;
+
+/* Peripherals and sensor values are per thread when HAL_HOST_THREAD_LOCAL is
+   defined, so that independent simulations can run in parallel (batch runner) */
+#if defined(HAL_HOST_THREAD_LOCAL) && defined(__cplusplus)
+#define HAL_HOST_STATE thread_local
+#elif defined(HAL_HOST_THREAD_LOCAL)
+#define HAL_HOST_STATE _Thread_local
+#else
+#define HAL_HOST_STATE
+#endif
+
+extern HAL_HOST_STATE RCC_TypeDef hal_host_rcc;
+#define RCC (&hal_host_rcc)
+
+#define RCC_AHB4ENR_GPIOAEN (1U << 0)
+#define RCC_AHB4ENR_GPIOBEN (1U << 1)
+#define RCC_AHB4ENR_GPIOCEN (1U << 2)
+#define RCC_AHB4ENR_GPIODEN (1U << 3)
+#define RCC_AHB4ENR_GPIOEEN (1U << 4)
+#define RCC_AHB4ENR_GPIOFEN (1U << 5)
+#define RCC_AHB4ENR_GPIOGEN (1U << 6)
+
+#define __HAL_RCC_GPIOA_CLK_ENABLE() (RCC->AHB4ENR |= RCC_AHB4ENR_GPIOAEN)
+#define __HAL_RCC_GPIOB_CLK_ENABLE() (RCC->AHB4ENR |= RCC_AHB4ENR_GPIOBEN)
+#define __HAL_RCC_GPIOC_CLK_ENABLE() (RCC->AHB4ENR |= RCC_AHB4ENR_GPIOCEN)
+#define __HAL_RCC_GPIOD_CLK_ENABLE() (RCC->AHB4ENR |= RCC_AHB4ENR_GPIODEN)
+#define __HAL_RCC_GPIOE_CLK_ENABLE() (RCC->AHB4ENR |= RCC_AHB4ENR_GPIOEEN)
+#define __HAL_RCC_GPIOF_CLK_ENABLE() (RCC->AHB4ENR |= RCC_AHB4ENR_GPIOFEN)
+#define __HAL_RCC_GPIOG_CLK_ENABLE() (RCC->AHB4ENR |= RCC_AHB4ENR_GPIOGEN)
+
+/* GPIO --------------------------------------------------------------------*/
+typedef struct
+{
+  volatile uint32_t MODER;
+  volatile uint32_t OTYPER;
+  volatile uint32_t OSPEEDR;
+  volatile uint32_t PUPDR;
+  volatile uint32_t IDR;
+  volatile uint32_t ODR;
+  volatile uint32_t BSRR;
+  volatile uint32_t LCKR;
+  volatile uint32_t AFR[2];
+} GPIO_TypeDef;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0U,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+extern HAL_HOST_STATE GPIO_TypeDef hal_host_gpio[7];
+#define GPIOA (&hal_host_gpio[0])
+#define GPIOB (&hal_host_gpio[1])
+#define GPIOC (&hal_host_gpio[2])
+#define GPIOD (&hal_host_gpio[3])
+#define GPIOE (&hal_host_gpio[4])
+#define GPIOF (&hal_host_gpio[5])
+#define GPIOG (&hal_host_gpio[6])
+
+#define GPIO_PIN_0                 ((uint16_t)0x0001)
+#define GPIO_PIN_1                 ((uint16_t)0x0002)
+#define GPIO_PIN_2                 ((uint16_t)0x0004)
+#define GPIO_PIN_3                 ((uint16_t)0x0008)
+#define GPIO_PIN_4                 ((uint16_t)0x0010)
+#define GPIO_PIN_5                 ((uint16_t)0x0020)
+#define GPIO_PIN_6                 ((uint16_t)0x0040)
+#define GPIO_PIN_7                 ((uint16_t)0x0080)
+#define GPIO_PIN_8                 ((uint16_t)0x0100)
+#define GPIO_PIN_9                 ((uint16_t)0x0200)
+#define GPIO_PIN_10                ((uint16_t)0x0400)
+#define GPIO_PIN_11                ((uint16_t)0x0800)
+#define GPIO_PIN_12                ((uint16_t)0x1000)
+#define GPIO_PIN_13                ((uint16_t)0x2000)
+#define GPIO_PIN_14                ((uint16_t)0x4000)
+#define GPIO_PIN_15                ((uint16_t)0x8000)
+#define GPIO_PIN_All               ((uint16_t)0xFFFF)
+
+#define GPIO_MODE_INPUT            0x00000000U
+#define GPIO_MODE_OUTPUT_PP        0x00000001U
+#define GPIO_MODE_OUTPUT_OD        0x00000011U
+#define GPIO_MODE_AF_PP            0x00000002U
+#define GPIO_MODE_AF_OD            0x00000012U
+#define GPIO_MODE_ANALOG           0x00000003U
+
+#define GPIO_NOPULL                0x00000000U
+#define GPIO_PULLUP                0x00000001U
+#define GPIO_PULLDOWN              0x00000002U
+
+#define GPIO_SPEED_FREQ_LOW        0x00000000U
+#define GPIO_SPEED_FREQ_MEDIUM     0x00000001U
+#define GPIO_SPEED_FREQ_HIGH       0x00000002U
+#define GPIO_SPEED_FREQ_VERY_HIGH  0x00000003U
+
+#define GPIO_AF2_TIM4              ((uint8_t)0x02)
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+/* TIM ---------------------------------------------------------------------*/
+typedef struct
+{
+  volatile uint32_t CR1;
+  volatile uint32_t CR2;
+  volatile uint32_t SMCR;
+  volatile uint32_t DIER;
+  volatile uint32_t SR;
+  volatile uint32_t EGR;
+  volatile uint32_t CCMR1;
+  volatile uint32_t CCMR2;
+  volatile uint32_t CCER;
+  volatile uint32_t CNT;
+  volatile uint32_t PSC;
+  volatile uint32_t ARR;
+  volatile uint32_t RCR;
+  volatile uint32_t CCR1;
+  volatile uint32_t CCR2;
+  volatile uint32_t CCR3;
+  volatile uint32_t CCR4;
+} TIM_TypeDef;
+
+typedef struct
+{
+  uint32_t Prescaler;
+  uint32_t CounterMode;
+  uint32_t Period;
+  uint32_t ClockDivision;
+  uint32_t RepetitionCounter;
+  uint32_t AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef struct
+{
+  TIM_TypeDef *Instance;
+  TIM_Base_InitTypeDef Init;
+} TIM_HandleTypeDef;
+
+extern HAL_HOST_STATE TIM_TypeDef hal_host_tim[3];
+#define TIM2 (&hal_host_tim[0])
+#define TIM4 (&hal_host_tim[1])
+#define TIM6 (&hal_host_tim[2])
+
+#define TIM_CHANNEL_1              0x00000000U
+#define TIM_CHANNEL_2              0x00000004U
+#define TIM_CHANNEL_3              0x00000008U
+#define TIM_CHANNEL_4              0x0000000CU
+
+#define TIM_SR_CC1IF               (1U << 1)
+#define TIM_DIER_CC1IE             (1U << 1)
+
+/* Writes to the output pins and compare registers (HAL_GPIO_WritePin/TogglePin, __HAL_TIM_SET_COMPARE) */
+extern HAL_HOST_STATE unsigned long hal_host_output_writes;
+
+#define __HAL_TIM_SET_COMPARE(__HANDLE__, __CHANNEL__, __COMPARE__) \
+  do { hal_host_output_writes++; *(&((__HANDLE__)->Instance->CCR1) + ((__CHANNEL__) >> 2U)) = (__COMPARE__); } while (0)
+#define __HAL_TIM_GET_COMPARE(__HANDLE__, __CHANNEL__) \
+  (*(&((__HANDLE__)->Instance->CCR1) + ((__CHANNEL__) >> 2U)))
+#define __HAL_TIM_GET_AUTORELOAD(__HANDLE__)        ((__HANDLE__)->Instance->ARR)
+#define __HAL_TIM_GET_COUNTER(__HANDLE__)           ((__HANDLE__)->Instance->CNT)
+#define __HAL_TIM_SET_COUNTER(__HANDLE__, __COUNTER__) ((__HANDLE__)->Instance->CNT = (__COUNTER__))
+
+typedef struct
+{
+  uint32_t OCMode;
+  uint32_t Pulse;
+  uint32_t OCPolarity;
+  uint32_t OCNPolarity;
+  uint32_t OCFastMode;
+  uint32_t OCIdleState;
+  uint32_t OCNIdleState;
+} TIM_OC_InitTypeDef;
+
+#define TIM_OCMODE_PWM1            0x00000060U
+#define TIM_OCPOLARITY_HIGH        0x00000000U
+#define TIM_OCFAST_DISABLE         0x00000000U
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+
+/* ADC ---------------------------------------------------------------------*/
+typedef struct
+{
+  volatile uint32_t ISR;
+  volatile uint32_t IER;
+  volatile uint32_t CR;
+  volatile uint32_t CFGR;
+  volatile uint32_t DR;
+} ADC_TypeDef;
+
+typedef struct
+{
+  uint32_t Resolution;
+  uint32_t ScanConvMode;
+  uint32_t EOCSelection;
+  uint32_t ContinuousConvMode;
+  uint32_t NbrOfConversion;
+} ADC_InitTypeDef;
+
+typedef struct
+{
+  ADC_TypeDef *Instance;
+  ADC_InitTypeDef Init;
+} ADC_HandleTypeDef;
+
+typedef struct
+{
+  uint32_t Channel;
+  uint32_t Rank;
+  uint32_t SamplingTime;
+  uint32_t SingleDiff;
+  uint32_t OffsetNumber;
+  uint32_t Offset;
+} ADC_ChannelConfTypeDef;
+
+#define ADC_SCAN_DISABLE           0x00000000U
+#define ADC_SCAN_ENABLE            0x00000001U
+#define ADC_EOC_SINGLE_CONV        (1U << 2)
+#define ADC_SAMPLETIME_64CYCLES_5  0x00000005U
+#define ADC_SINGLE_ENDED           LL_ADC_SINGLE_ENDED
+#define ADC_OFFSET_NONE            0x00000005U
+#define ADC_CHANNEL_3              3U
+#define ADC_CHANNEL_4              4U
+#define ADC_CHANNEL_5              5U
+#define ADC_CHANNEL_7              7U
+#define ADC_CHANNEL_10             10U
+#define ADC_CHANNEL_13             13U
+#define ADC_CHANNEL_15             15U
+#define ADC_CHANNEL_16             16U
+/* Ranks are just the position in the sequence here */
+#define ADC_REGULAR_RANK_1         1U
+#define ADC_REGULAR_RANK_2         2U
+#define ADC_REGULAR_RANK_3         3U
+#define ADC_REGULAR_RANK_4         4U
+#define ADC_REGULAR_RANK_5         5U
+#define ADC_REGULAR_RANK_6         6U
+#define ADC_REGULAR_RANK_7         7U
+#define ADC_REGULAR_RANK_8         8U
+#define ADC_REGULAR_RANK_9         9U
+#define ADC_REGULAR_RANK_10        10U
+#define ADC_REGULAR_RANK_11        11U
+#define ADC_REGULAR_RANK_12        12U
+#define ADC_REGULAR_RANK_13        13U
+#define ADC_REGULAR_RANK_14        14U
+#define ADC_REGULAR_RANK_15        15U
+#define ADC_REGULAR_RANK_16        16U
+
+extern HAL_HOST_STATE ADC_TypeDef hal_host_adc1;
+#define ADC1 (&hal_host_adc1)
+
+#define ADC_CR_ADCAL               (1U << 31)
+#define LL_ADC_CALIB_OFFSET        0x00000000U
+#define LL_ADC_SINGLE_ENDED        0x00000000U
+
+/* Calibration completes immediately on the host */
+static inline void LL_ADC_StartCalibration(ADC_TypeDef *ADCx, uint32_t CalibrationMode, uint32_t SingleDiff)
+{
+  (void)CalibrationMode;
+  (void)SingleDiff;
+  ADCx->CR = ADCx->CR & ~ADC_CR_ADCAL;
+}
+
+static inline uint32_t LL_ADC_IsCalibrationOnGoing(const ADC_TypeDef *ADCx)
+{
+  return (ADCx->CR & ADC_CR_ADCAL) ? 1U : 0U;
+}
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, const ADC_ChannelConfTypeDef *sConfig);
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout);
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *hadc);
+
+/* CRC ---------------------------------------------------------------------*/
+/* Software CRC-32 with the reset configuration of the peripheral (polynomial
+   0x04C11DB7, initial value 0xFFFFFFFF, no reflection, no final XOR) */
+typedef struct
+{
+  uint8_t DefaultPolynomialUse;
+  uint8_t DefaultInitValueUse;
+  uint32_t InputDataInversionMode;
+  uint32_t OutputDataInversionMode;
+} CRC_InitTypeDef;
+
+typedef struct
+{
+  void *Instance;
+  CRC_InitTypeDef Init;
+  uint32_t InputDataFormat;
+} CRC_HandleTypeDef;
+
+#define CRC                               ((void *)0)
+#define DEFAULT_POLYNOMIAL_ENABLE         ((uint8_t)0x00U)
+#define DEFAULT_INIT_VALUE_ENABLE         ((uint8_t)0x00U)
+#define CRC_INPUTDATA_INVERSION_NONE      0x00000000U
+#define CRC_OUTPUTDATA_INVERSION_DISABLE  0x00000000U
+#define CRC_INPUTDATA_FORMAT_BYTES        0x00000001U
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc);
+/* BufferLength in bytes (CRC_INPUTDATA_FORMAT_BYTES) */
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+
+/* FLASH -------------------------------------------------------------------*/
+/* Bank 2 is a RAM array with the programming rules of the device: erase sets
+   a 128 KB sector to 0xFF, a 32-byte flash word is programmed once */
+extern uint8_t hal_host_flash_bank2[0x100000];
+#define FLASH_BANK2_BASE           ((uintptr_t)hal_host_flash_bank2)
+#define FLASH_SECTOR_SIZE          0x00020000UL
+#define FLASH_NB_32BITWORD_IN_FLASHWORD 8U
+#define FLASH_BANK_2               0x02U
+#define FLASH_SECTOR_6             6U
+#define FLASH_SECTOR_7             7U
+#define FLASH_TYPEERASE_SECTORS    0x00U
+#define FLASH_TYPEPROGRAM_FLASHWORD 0x01U
+#define FLASH_VOLTAGE_RANGE_3      0x00000020U
+
+typedef struct
+{
+  uint32_t TypeErase;
+  uint32_t Banks;
+  uint32_t Sector;
+  uint32_t NbSectors;
+  uint32_t VoltageRange;
+} FLASH_EraseInitTypeDef;
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+/* Addresses are pointers on the host */
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uintptr_t FlashAddress, uintptr_t DataAddress);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *SectorError);
+
+/* PWR / backup SRAM -------------------------------------------------------*/
+extern uint8_t hal_host_bkpsram[4096];
+#define D3_BKPSRAM_BASE            ((uintptr_t)hal_host_bkpsram)
+#define RCC_AHB4ENR_BKPRAMEN       (1U << 28)
+#define __HAL_RCC_BKPRAM_CLK_ENABLE() \
+  do { RCC->AHB4ENR = RCC->AHB4ENR | RCC_AHB4ENR_BKPRAMEN; (void)RCC->AHB4ENR; } while (0)
+
+void HAL_PWR_EnableBkUpAccess(void);
+HAL_StatusTypeDef HAL_PWREx_EnableBkUpReg(void);
+
+/* Stand-in control --------------------------------------------------------*/
+
+/* Value returned by the next ADC conversions */
+void hal_host_set_adc(uint16_t raw);
+/* Level seen on an input pin */
+void hal_host_set_input(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+/* Temperature (°C) and humidity (%) returned by the next DHT11 frames; valid = 0 simulates a checksum error */
+void hal_host_set_dht11(float temperature, float humidity, uint8_t valid);
+/* enable = 1: delays return at once (runs in virtual time) */
+void hal_host_set_virtual_time(uint8_t enable);
+
+/* Hardware read recorded on the board (same layout as HwRecord, main/include/hw_trace.hpp) */
+typedef struct
+{
+  uint32_t tick;
+  uint8_t kind;    /* 1 ADC (channel = rank), 2 GPIO (channel = port * 16 + pin), 3..5 DHT11 frame */
+  uint8_t channel;
+  uint16_t value;
+} HalHostRecord;
+
+/* Replay records (kept by the caller): ADC, GPIO and DHT11 reads return the
+   recorded values in order per channel; records = NULL stops the replay */
+void hal_host_replay(const HalHostRecord *records, size_t count);
+/* Reads that found no record left and returned the live value */
+unsigned long hal_host_replay_misses(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STM32H7XX_HAL_H */
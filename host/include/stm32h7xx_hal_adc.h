@@ -0,0 +1,7 @@
+/* Host stand-in: everything lives in stm32h7xx_hal.h */
+#ifndef HOST_STM32H7XX_HAL_ADC_H
+#define HOST_STM32H7XX_HAL_ADC_H
+
+#include "stm32h7xx_hal.h"
+
+#endif /* HOST_STM32H7XX_HAL_ADC_H */
@@ -0,0 +1,23 @@
+/* Host stand-in for the CubeMX tim.h */
+#ifndef HOST_TIM_H
+#define HOST_TIM_H
+
+#include "stm32h7xx_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern HAL_HOST_STATE TIM_HandleTypeDef htim2;
+extern HAL_HOST_STATE TIM_HandleTypeDef htim4;
+extern HAL_HOST_STATE TIM_HandleTypeDef htim6;
+
+void MX_TIM2_Init(void);
+void MX_TIM4_Init(void);
+void MX_TIM6_Init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_TIM_H */
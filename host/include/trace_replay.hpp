@@ -0,0 +1,268 @@
+/**
+ * Replay of recorded sensor traces in virtual time.
+ *
+ * A SensorTrace holds timestamped samples of the lab sensors: raw MG-811 ADC
+ * count, DHT11 temperature and PIR level. TraceReplayClock is a clock for
+ * HeapRootCoordinator: it never waits, and before each event it feeds the
+ * samples due by then to the HAL stand-in, so the unmodified models read them
+ * through the usual HAL/DHT11 calls. Between events it integrates what the
+ * models drive on the room's pins (CO2 LEDs, motion LED, servo duty cycle)
+ * into ReplayMetrics, together with the thermal discomfort: trace temperature
+ * above a comfort limit while the servo is idle.
+ *
+ * Traces are read from CSV ("time,co2,temperature,motion", one header line)
+ * or from the binary columnar format written by saveBinary().
+ */
+
+#ifndef HOST_TRACE_REPLAY_HPP
+#define HOST_TRACE_REPLAY_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "room.hpp"
+
+extern "C"
+{
+#include "stm32h7xx_hal.h"
+}
+
+namespace cadmium
+{
+
+    // Recorded sensor samples, one column per signal
+    struct SensorTrace
+    {
+        std::vector<double> time;        // Seconds from the start of the recording, increasing
+        std::vector<uint16_t> co2;       // Raw 10-bit ADC sample of the MG-811
+        std::vector<float> temperature;  // DHT11 temperature (°C)
+        std::vector<uint8_t> motion;     // PIR output level
+
+        [[nodiscard]] std::size_t size() const { return time.size(); }
+        [[nodiscard]] double duration() const { return time.empty() ? 0.0 : time.back(); }
+
+        void add(double t, uint16_t raw, float celsius, uint8_t level)
+        {
+            time.push_back(t);
+            co2.push_back(raw);
+            temperature.push_back(celsius);
+            motion.push_back(level);
+        }
+    };
+
+    static constexpr char TRACE_MAGIC[8] = {'R', 'T', 'T', 'R', 'A', 'C', 'E', '1'};
+
+    // Read a CSV trace; false (and a message on stderr) on error
+    inline bool loadCsv(const std::string &path, SensorTrace &trace)
+    {
+        FILE *file = std::fopen(path.c_str(), "r");
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "%s: cannot open\n", path.c_str());
+            return false;
+        }
+        char line[256];
+        unsigned long row = 0;
+        bool ok = true;
+        while (std::fgets(line, sizeof(line), file) != nullptr)
+        {
+            row++;
+            if (row == 1 || line[0] == '\n' || line[0] == '#')
+            {
+                continue; // Header, blank lines and comments
+            }
+            double t;
+            unsigned raw;
+            float celsius;
+            unsigned level;
+            if (std::sscanf(line, "%lf,%u,%f,%u", &t, &raw, &celsius, &level) != 4 ||
+                (!trace.time.empty() && t < trace.time.back()))
+            {
+                std::fprintf(stderr, "%s:%lu: expected time,co2,temperature,motion with increasing time\n", path.c_str(), row);
+                ok = false;
+                break;
+            }
+            trace.add(t, static_cast<uint16_t>(raw), celsius, static_cast<uint8_t>(level != 0));
+        }
+        std::fclose(file);
+        return ok;
+    }
+
+    // Binary columnar trace: magic, sample count (uint64), then each column in turn
+    inline bool saveBinary(const std::string &path, const SensorTrace &trace)
+    {
+        FILE *file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "%s: cannot create\n", path.c_str());
+            return false;
+        }
+        uint64_t count = trace.size();
+        bool ok = std::fwrite(TRACE_MAGIC, sizeof(TRACE_MAGIC), 1, file) == 1 &&
+                  std::fwrite(&count, sizeof(count), 1, file) == 1 &&
+                  std::fwrite(trace.time.data(), sizeof(double), count, file) == count &&
+                  std::fwrite(trace.co2.data(), sizeof(uint16_t), count, file) == count &&
+                  std::fwrite(trace.temperature.data(), sizeof(float), count, file) == count &&
+                  std::fwrite(trace.motion.data(), sizeof(uint8_t), count, file) == count;
+        ok = std::fclose(file) == 0 && ok;
+        if (!ok)
+        {
+            std::fprintf(stderr, "%s: write error\n", path.c_str());
+        }
+        return ok;
+    }
+
+    inline bool loadBinary(const std::string &path, SensorTrace &trace)
+    {
+        FILE *file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "%s: cannot open\n", path.c_str());
+            return false;
+        }
+        char magic[sizeof(TRACE_MAGIC)];
+        uint64_t count = 0;
+        bool ok = std::fread(magic, sizeof(magic), 1, file) == 1 && std::memcmp(magic, TRACE_MAGIC, sizeof(magic)) == 0 &&
+                  std::fread(&count, sizeof(count), 1, file) == 1;
+        if (ok)
+        {
+            trace.time.resize(count);
+            trace.co2.resize(count);
+            trace.temperature.resize(count);
+            trace.motion.resize(count);
+            ok = std::fread(trace.time.data(), sizeof(double), count, file) == count &&
+                 std::fread(trace.co2.data(), sizeof(uint16_t), count, file) == count &&
+                 std::fread(trace.temperature.data(), sizeof(float), count, file) == count &&
+                 std::fread(trace.motion.data(), sizeof(uint8_t), count, file) == count;
+        }
+        std::fclose(file);
+        if (!ok)
+        {
+            std::fprintf(stderr, "%s: not a binary trace or truncated\n", path.c_str());
+        }
+        return ok;
+    }
+
+    // Binary format for *.bin, CSV otherwise
+    inline bool loadTrace(const std::string &path, SensorTrace &trace)
+    {
+        bool binary = path.size() > 4 && path.compare(path.size() - 4, 4, ".bin") == 0;
+        return binary ? loadBinary(path, trace) : loadCsv(path, trace);
+    }
+
+    // Time integrals of the room outputs over a replay
+    struct ReplayMetrics
+    {
+        double goodSeconds = 0;      // CO2 "good" LED on
+        double averageSeconds = 0;   // CO2 "average" LED on
+        double badSeconds = 0;       // CO2 "bad" LED on
+        double motionSeconds = 0;    // Motion LED on
+        double servoDutySeconds = 0; // Integral of the servo duty cycle
+        double discomfort = 0;       // Integral of (temperature - comfort limit) while hot and the servo idle (K.s)
+        double observed = 0;         // Time covered by the integrals
+    };
+
+    /**
+     * Clock for HeapRootCoordinator replaying a trace into the HAL stand-in.
+     * Copies share the trace and the metrics. The integrals run to the end of
+     * the trace, or to until(time), even when the last event comes earlier.
+     */
+    class TraceReplayClock
+    {
+        std::shared_ptr<const SensorTrace> trace;
+        RoomHardware room;        // Pins observed for the metrics
+        ReplayMetrics *metrics;   // Owned by the caller
+        std::size_t next;         // First sample not yet applied
+        double timeLast;          // Time of the previous event
+        double horizon;           // End of the simulated interval
+        float comfortLimit;       // Temperature above which an idle servo counts as discomfort (°C)
+
+        // Apply every sample due at time
+        void feed(double time)
+        {
+            const SensorTrace &t = *trace;
+            std::size_t last = next;
+            while (next < t.size() && t.time[next] <= time)
+            {
+                next++;
+            }
+            if (next != last)
+            {
+                std::size_t i = next - 1; // Only the most recent sample is visible to the models
+                hal_host_set_adc(t.co2[i]);
+                hal_host_set_dht11(t.temperature[i], 50.0f, 1);
+                hal_host_set_input(room.motionPort, static_cast<uint16_t>(room.motion.Pin), t.motion[i] ? GPIO_PIN_SET : GPIO_PIN_RESET);
+            }
+        }
+
+        // Outputs hold their value between two events
+        void integrate(double time)
+        {
+            double dt = time - timeLast;
+            if (metrics == nullptr || dt <= 0)
+            {
+                return;
+            }
+            metrics->goodSeconds += (room.goodPort->ODR & room.good.Pin) ? dt : 0;
+            metrics->averageSeconds += (room.averagePort->ODR & room.average.Pin) ? dt : 0;
+            metrics->badSeconds += (room.badPort->ODR & room.bad.Pin) ? dt : 0;
+            metrics->motionSeconds += (room.motionLedPort->ODR & room.motionLed.Pin) ? dt : 0;
+            double period = __HAL_TIM_GET_AUTORELOAD(room.servoTimer);
+            double duty = period > 0 ? __HAL_TIM_GET_COMPARE(room.servoTimer, room.servoChannel) / period : 0;
+            metrics->servoDutySeconds += duty * dt;
+            float temperature = next > 0 ? trace->temperature[next - 1] : comfortLimit;
+            if (duty == 0 && temperature > comfortLimit)
+            {
+                metrics->discomfort += (temperature - comfortLimit) * dt;
+            }
+            metrics->observed += dt;
+        }
+
+    public:
+        TraceReplayClock(std::shared_ptr<const SensorTrace> samples, const RoomHardware &hw, ReplayMetrics *out, float comfort = 24.0f)
+            : trace(std::move(samples)), room(hw), metrics(out), next(0), timeLast(0), horizon(trace->duration()), comfortLimit(comfort) {}
+
+        // Simulated interval when it is not the trace length (pass the same time as to simulate())
+        TraceReplayClock &until(double time)
+        {
+            horizon = time;
+            return *this;
+        }
+
+        void start(double time)
+        {
+            feed(time);
+            timeLast = time;
+        }
+
+        // Integrate past the last event up to the end of the interval: outputs hold, the trace keeps moving
+        void stop(double time)
+        {
+            double end = std::max(time, horizon);
+            while (next < trace->size() && trace->time[next] <= end)
+            {
+                double sample = trace->time[next];
+                integrate(sample);
+                feed(sample);
+                timeLast = std::max(timeLast, sample);
+            }
+            integrate(end);
+            timeLast = end;
+        }
+
+        double waitUntil(double timeNext)
+        {
+            integrate(timeNext);
+            feed(timeNext);
+            timeLast = timeNext;
+            return timeNext;
+        }
+    };
+
+} // namespace cadmium
+
+#endif // HOST_TRACE_REPLAY_HPP
@@ -0,0 +1,120 @@
+/**
+ * Work-stealing thread pool for batches of independent host runs.
+ *
+ * run(count, task) deals the indices 0..count-1 round-robin to one deque per
+ * worker. A worker takes its own tasks from the back of its deque and, once
+ * it is empty, steals from the front of the others', so long scenarios do
+ * not leave the other cores idle at the end of a batch.
+ */
+
+#ifndef HOST_WORK_STEALING_POOL_HPP
+#define HOST_WORK_STEALING_POOL_HPP
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cadmium
+{
+
+    class WorkStealingPool
+    {
+        struct Queue
+        {
+            std::mutex lock;
+            std::deque<std::size_t> tasks;
+        };
+
+        unsigned workers;
+        unsigned long steals; // Tasks run by a worker other than the one they were dealt to
+
+        static bool popBack(Queue &queue, std::size_t &task)
+        {
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (queue.tasks.empty())
+            {
+                return false;
+            }
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+            return true;
+        }
+
+        static bool popFront(Queue &queue, std::size_t &task)
+        {
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (queue.tasks.empty())
+            {
+                return false;
+            }
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+            return true;
+        }
+
+    public:
+        explicit WorkStealingPool(unsigned threads) : workers(std::max(1U, threads)), steals(0) {}
+
+        // Call task(i) for every i in [0, count) on the pool's threads; returns when all are done
+        template <typename F>
+        void run(std::size_t count, F &&task)
+        {
+            unsigned n = static_cast<unsigned>(std::min<std::size_t>(workers, std::max<std::size_t>(count, 1)));
+            std::vector<std::unique_ptr<Queue>> queues;
+            for (unsigned w = 0; w < n; w++)
+            {
+                queues.push_back(std::make_unique<Queue>());
+            }
+            for (std::size_t i = 0; i < count; i++)
+            {
+                queues[i % n]->tasks.push_back(i);
+            }
+
+            std::vector<unsigned long> stolen(n, 0);
+            std::vector<std::thread> threads;
+            for (unsigned w = 0; w < n; w++)
+            {
+                threads.emplace_back([&, w]
+                                     {
+                    std::size_t index;
+                    for (;;)
+                    {
+                        if (popBack(*queues[w], index))
+                        {
+                            task(index);
+                            continue;
+                        }
+                        // Own deque empty: steal the oldest task of another worker, stop when all are empty
+                        bool found = false;
+                        for (unsigned k = 1; k < n && !found; k++)
+                        {
+                            found = popFront(*queues[(w + k) % n], index);
+                        }
+                        if (!found)
+                        {
+                            break;
+                        }
+                        stolen[w]++;
+                        task(index);
+                    } });
+            }
+            for (auto &thread : threads)
+            {
+                thread.join();
+            }
+            for (unsigned long s : stolen)
+            {
+                steals += s;
+            }
+        }
+
+        [[nodiscard]] unsigned size() const { return workers; }
+        [[nodiscard]] unsigned long stealCount() const { return steals; }
+    };
+
+} // namespace cadmium
+
+#endif // HOST_WORK_STEALING_POOL_HPP
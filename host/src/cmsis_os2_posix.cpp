@@ -0,0 +1,231 @@
+/**
+ * Minimal CMSIS-RTOS2 implementation on std::thread for host builds.
+ *
+ * Covers what main/include/rtos_runtime.hpp uses: kernel start/tick, threads,
+ * delays and message queues. Priorities are ignored and osKernelLock() is a
+ * no-op, so this checks the threading structure, not the timing. Threads
+ * created before osKernelStart() wait on a start gate like they would before
+ * the scheduler runs; osKernelStart() returns once every joinable thread has
+ * finished (on the board it never returns).
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+#include "cmsis_os2.h"
+}
+
+namespace
+{
+    using SteadyClock = std::chrono::steady_clock;
+
+    // Kernel state shared by all threads
+    struct Kernel
+    {
+        std::mutex lock;
+        std::condition_variable started;
+        osKernelState_t state = osKernelInactive;
+        SteadyClock::time_point origin = SteadyClock::now();
+        std::vector<std::thread *> joinable;
+    };
+
+    Kernel &kernel()
+    {
+        static Kernel *instance = new Kernel(); // Never destroyed: detached threads may outlive main()
+        return *instance;
+    }
+
+    // Fixed-size message queue
+    struct MessageQueue
+    {
+        std::mutex lock;
+        std::condition_variable notEmpty;
+        std::condition_variable notFull;
+        std::deque<std::vector<uint8_t>> messages;
+        uint32_t capacity;
+        uint32_t size;
+    };
+
+    SteadyClock::time_point deadlineAfter(uint32_t ticks)
+    {
+        return SteadyClock::now() + std::chrono::milliseconds(ticks);
+    }
+
+    // Wait on cv until pred() holds or the timeout (in ticks) expires
+    template <typename Pred>
+    bool waitFor(std::condition_variable &cv, std::unique_lock<std::mutex> &guard, uint32_t timeout, Pred pred)
+    {
+        if (timeout == osWaitForever)
+        {
+            cv.wait(guard, pred);
+            return true;
+        }
+        return cv.wait_until(guard, deadlineAfter(timeout), pred);
+    }
+} // namespace
+
+extern "C"
+{
+
+    osStatus_t osKernelInitialize(void)
+    {
+        std::lock_guard<std::mutex> guard(kernel().lock);
+        kernel().state = osKernelReady;
+        kernel().origin = SteadyClock::now();
+        return osOK;
+    }
+
+    osKernelState_t osKernelGetState(void)
+    {
+        std::lock_guard<std::mutex> guard(kernel().lock);
+        return kernel().state;
+    }
+
+    osStatus_t osKernelStart(void)
+    {
+        std::vector<std::thread *> toJoin;
+        {
+            std::lock_guard<std::mutex> guard(kernel().lock);
+            if (kernel().state != osKernelReady)
+            {
+                return osError;
+            }
+            kernel().state = osKernelRunning;
+            toJoin.swap(kernel().joinable);
+        }
+        kernel().started.notify_all();
+        for (std::thread *thread : toJoin)
+        {
+            thread->join();
+            delete thread;
+        }
+        return osOK;
+    }
+
+    int32_t osKernelLock(void)
+    {
+        return 0;
+    }
+
+    int32_t osKernelUnlock(void)
+    {
+        return 0;
+    }
+
+    int32_t osKernelRestoreLock(int32_t lock)
+    {
+        return lock;
+    }
+
+    uint32_t osKernelGetTickCount(void)
+    {
+        auto elapsed = SteadyClock::now() - kernel().origin;
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    }
+
+    uint32_t osKernelGetTickFreq(void)
+    {
+        return 1000U;
+    }
+
+    osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+    {
+        auto body = [func, argument]()
+        {
+            {
+                std::unique_lock<std::mutex> guard(kernel().lock);
+                kernel().started.wait(guard, []
+                                      { return kernel().state == osKernelRunning; });
+            }
+            func(argument);
+        };
+        auto *thread = new std::thread(body);
+        if (attr != nullptr && (attr->attr_bits & osThreadJoinable))
+        {
+            std::lock_guard<std::mutex> guard(kernel().lock);
+            kernel().joinable.push_back(thread);
+        }
+        else
+        {
+            thread->detach();
+        }
+        return thread;
+    }
+
+    osStatus_t osDelay(uint32_t ticks)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+        return osOK;
+    }
+
+    osStatus_t osDelayUntil(uint32_t ticks)
+    {
+        std::this_thread::sleep_until(kernel().origin + std::chrono::milliseconds(ticks));
+        return osOK;
+    }
+
+    osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr)
+    {
+        (void)attr;
+        auto *queue = new MessageQueue();
+        queue->capacity = msg_count;
+        queue->size = msg_size;
+        return queue;
+    }
+
+    osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+    {
+        (void)msg_prio;
+        auto *queue = static_cast<MessageQueue *>(mq_id);
+        std::unique_lock<std::mutex> guard(queue->lock);
+        if (!waitFor(queue->notFull, guard, timeout, [queue]
+                     { return queue->messages.size() < queue->capacity; }))
+        {
+            return timeout == 0 ? osErrorResource : osErrorTimeout;
+        }
+        const auto *bytes = static_cast<const uint8_t *>(msg_ptr);
+        queue->messages.emplace_back(bytes, bytes + queue->size);
+        queue->notEmpty.notify_one();
+        return osOK;
+    }
+
+    osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+    {
+        auto *queue = static_cast<MessageQueue *>(mq_id);
+        std::unique_lock<std::mutex> guard(queue->lock);
+        if (!waitFor(queue->notEmpty, guard, timeout, [queue]
+                     { return !queue->messages.empty(); }))
+        {
+            return timeout == 0 ? osErrorResource : osErrorTimeout;
+        }
+        std::memcpy(msg_ptr, queue->messages.front().data(), queue->size);
+        queue->messages.pop_front();
+        if (msg_prio != nullptr)
+        {
+            *msg_prio = 0;
+        }
+        queue->notFull.notify_one();
+        return osOK;
+    }
+
+    uint32_t osMessageQueueGetCount(osMessageQueueId_t mq_id)
+    {
+        auto *queue = static_cast<MessageQueue *>(mq_id);
+        std::lock_guard<std::mutex> guard(queue->lock);
+        return static_cast<uint32_t>(queue->messages.size());
+    }
+
+    osStatus_t osMessageQueueDelete(osMessageQueueId_t mq_id)
+    {
+        delete static_cast<MessageQueue *>(mq_id);
+        return osOK;
+    }
+
+} // extern "C"
@@ -0,0 +1,453 @@
+/**
+ * Host implementation of the HAL stand-in (host/include/stm32h7xx_hal.h) and of
+ * the DHT11 driver (main/include/DHT_11/DHT.h).
+ *
+ * Register blocks are plain RAM, time comes from CLOCK_MONOTONIC, and sensor
+ * values are whatever was last set through the hal_host_* functions, or the
+ * next recorded read while hal_host_replay() is active.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+#include <time.h>
+#include "stm32h7xx_hal.h"
+#include "adc.h"
+#include "tim.h"
+#include "crc.h"
+#include "DHT.h"
+
+HAL_HOST_STATE RCC_TypeDef hal_host_rcc;
+HAL_HOST_STATE GPIO_TypeDef hal_host_gpio[7];
+HAL_HOST_STATE TIM_TypeDef hal_host_tim[3];
+HAL_HOST_STATE ADC_TypeDef hal_host_adc1;
+
+HAL_HOST_STATE ADC_HandleTypeDef hadc1;
+HAL_HOST_STATE TIM_HandleTypeDef htim2;
+HAL_HOST_STATE TIM_HandleTypeDef htim4;
+HAL_HOST_STATE TIM_HandleTypeDef htim6;
+HAL_HOST_STATE CRC_HandleTypeDef hcrc;
+
+static HAL_HOST_STATE uint16_t adcValue = 512;
+static HAL_HOST_STATE uint8_t virtualTime = 0;
+static HAL_HOST_STATE DHT11_Frame dht11Frame = {22, 0, 21, 5, 48, 1};
+HAL_HOST_STATE unsigned long hal_host_output_writes = 0;
+
+/* Replay --------------------------------------------------------------------*/
+enum
+{
+  REPLAY_ADC = 1,
+  REPLAY_GPIO = 2,
+  REPLAY_DHT_HUMIDITY = 3,
+  REPLAY_DHT_TEMPERATURE = 4,
+  REPLAY_DHT_CHECK = 5,
+  REPLAY_KINDS = 6
+};
+
+static HAL_HOST_STATE const HalHostRecord *replayRecords = NULL;
+static HAL_HOST_STATE size_t replayCount = 0;
+static HAL_HOST_STATE size_t replayCursor[REPLAY_KINDS][256]; /* Next record to look at, per kind and channel */
+static HAL_HOST_STATE unsigned long replayMisses = 0;
+static HAL_HOST_STATE uint8_t adcRank = 0; /* Rank of the next HAL_ADC_GetValue() since HAL_ADC_Start() */
+
+/* Next recorded value of (kind, channel); live when the record is exhausted */
+static uint16_t replayNext(uint8_t kind, uint8_t channel, uint16_t live)
+{
+  if (replayRecords == NULL)
+  {
+    return live;
+  }
+  size_t *cursor = &replayCursor[kind][channel];
+  while (*cursor < replayCount)
+  {
+    const HalHostRecord *r = &replayRecords[(*cursor)++];
+    if (r->kind == kind && r->channel == channel)
+    {
+      return r->value;
+    }
+  }
+  replayMisses++;
+  return live;
+}
+
+/* Time ----------------------------------------------------------------------*/
+static uint64_t nowMicros(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U;
+}
+
+static void sleepMicros(uint64_t us)
+{
+  if (virtualTime)
+  {
+    return;
+  }
+  struct timespec ts = {(time_t)(us / 1000000U), (long)(us % 1000000U) * 1000L};
+  nanosleep(&ts, NULL);
+}
+
+uint32_t HAL_GetTick(void)
+{
+  static HAL_HOST_STATE uint64_t origin = 0;
+  if (origin == 0)
+  {
+    origin = nowMicros();
+  }
+  return (uint32_t)((nowMicros() - origin) / 1000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  sleepMicros((uint64_t)Delay * 1000U);
+}
+
+/* GPIO ----------------------------------------------------------------------*/
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  for (uint32_t pin = 0; pin < 16; pin++)
+  {
+    if (GPIO_Init->Pin & (1U << pin))
+    {
+      GPIOx->MODER = (GPIOx->MODER & ~(3U << (2 * pin))) | ((GPIO_Init->Mode & 3U) << (2 * pin));
+      GPIOx->OTYPER = (GPIOx->OTYPER & ~(1U << pin)) | (((GPIO_Init->Mode >> 4) & 1U) << pin);
+      GPIOx->OSPEEDR = (GPIOx->OSPEEDR & ~(3U << (2 * pin))) | ((GPIO_Init->Speed & 3U) << (2 * pin));
+      GPIOx->PUPDR = (GPIOx->PUPDR & ~(3U << (2 * pin))) | ((GPIO_Init->Pull & 3U) << (2 * pin));
+    }
+  }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  GPIO_PinState level = (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+  if (replayRecords != NULL && GPIO_Pin != 0)
+  {
+    uint8_t channel = (uint8_t)((GPIOx - hal_host_gpio) * 16 + __builtin_ctz(GPIO_Pin));
+    level = replayNext(REPLAY_GPIO, channel, (uint16_t)level) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+  }
+  return level;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  hal_host_output_writes++;
+  if (PinState != GPIO_PIN_RESET)
+  {
+    GPIOx->ODR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+  }
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  hal_host_output_writes++;
+  GPIOx->ODR ^= GPIO_Pin;
+}
+
+/* TIM -----------------------------------------------------------------------*/
+void MX_TIM2_Init(void)
+{
+  htim2.Instance = TIM2;
+  htim2.Init.Prescaler = 239;
+  htim2.Init.Period = 0xFFFFFFFFU;
+  TIM2->PSC = htim2.Init.Prescaler;
+  TIM2->ARR = htim2.Init.Period;
+}
+
+void MX_TIM4_Init(void)
+{
+  htim4.Instance = TIM4;
+  htim4.Init.Prescaler = 3999;
+  htim4.Init.Period = 199;
+  TIM4->PSC = htim4.Init.Prescaler;
+  TIM4->ARR = htim4.Init.Period;
+}
+
+void MX_TIM6_Init(void)
+{
+  htim6.Instance = TIM6;
+  htim6.Init.Prescaler = 239;
+  htim6.Init.Period = 0xFFFFU;
+  TIM6->PSC = htim6.Init.Prescaler;
+  TIM6->ARR = htim6.Init.Period;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+  htim->Instance->CR1 |= 1U;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig, uint32_t Channel)
+{
+  __HAL_TIM_SET_COMPARE(htim, Channel, sConfig->Pulse);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+  htim->Instance->CCER |= 1U << Channel;
+  htim->Instance->CR1 |= 1U;
+  return HAL_OK;
+}
+
+/* ADC -----------------------------------------------------------------------*/
+void MX_ADC1_Init(void)
+{
+  hadc1.Instance = ADC1;
+  hadc1.Init.ScanConvMode = ADC_SCAN_DISABLE;
+  hadc1.Init.EOCSelection = ADC_EOC_SINGLE_CONV;
+  hadc1.Init.NbrOfConversion = 1;
+}
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc)
+{
+  (void)hadc;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, const ADC_ChannelConfTypeDef *sConfig)
+{
+  (void)hadc;
+  (void)sConfig;
+  return HAL_OK;
+}
+
+/* Every channel of a scan sequence converts to the same value */
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *hadc)
+{
+  hadc->Instance->DR = adcValue;
+  hadc->Instance->ISR |= ADC_EOC_SINGLE_CONV;
+  adcRank = 0;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef *hadc)
+{
+  (void)hadc;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout)
+{
+  (void)Timeout;
+  return (hadc->Instance->ISR & ADC_EOC_SINGLE_CONV) ? HAL_OK : HAL_TIMEOUT;
+}
+
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *hadc)
+{
+  uint32_t value = replayNext(REPLAY_ADC, adcRank++, (uint16_t)hadc->Instance->DR);
+  if (hadc->Init.ScanConvMode == ADC_SCAN_DISABLE)
+  {
+    hadc->Instance->ISR &= ~ADC_EOC_SINGLE_CONV;
+  }
+  return value;
+}
+
+/* CRC -----------------------------------------------------------------------*/
+void MX_CRC_Init(void)
+{
+  hcrc.Instance = CRC;
+  hcrc.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_ENABLE;
+  hcrc.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_ENABLE;
+  hcrc.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_NONE;
+  hcrc.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE;
+  hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_BYTES;
+}
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc)
+{
+  (void)hcrc;
+  return HAL_OK;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  (void)hcrc;
+  const uint8_t *bytes = (const uint8_t *)pBuffer;
+  uint32_t crc = 0xFFFFFFFFU;
+  for (uint32_t i = 0; i < BufferLength; i++)
+  {
+    crc ^= (uint32_t)bytes[i] << 24;
+    for (int bit = 0; bit < 8; bit++)
+    {
+      crc = (crc & 0x80000000U) ? (crc << 1) ^ 0x04C11DB7U : crc << 1;
+    }
+  }
+  return crc;
+}
+
+/* FLASH and backup SRAM -----------------------------------------------------*/
+/* Shared by every thread: non-volatile memories outlive the simulations */
+uint8_t hal_host_flash_bank2[0x100000];
+uint8_t hal_host_bkpsram[4096];
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uintptr_t FlashAddress, uintptr_t DataAddress)
+{
+  const size_t word = FLASH_NB_32BITWORD_IN_FLASHWORD * 4U;
+  uint8_t *flash = (uint8_t *)FlashAddress;
+  if (TypeProgram != FLASH_TYPEPROGRAM_FLASHWORD || FlashAddress % word != 0 ||
+      flash < hal_host_flash_bank2 || flash + word > hal_host_flash_bank2 + sizeof(hal_host_flash_bank2))
+  {
+    return HAL_ERROR;
+  }
+  for (size_t i = 0; i < word; i++)
+  {
+    if (flash[i] != 0xFF)
+    {
+      return HAL_ERROR; /* Flash word already programmed */
+    }
+  }
+  memcpy(flash, (const void *)DataAddress, word);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *SectorError)
+{
+  *SectorError = 0xFFFFFFFFU;
+  if (pEraseInit->Banks != FLASH_BANK_2 || pEraseInit->Sector + pEraseInit->NbSectors > 8)
+  {
+    *SectorError = pEraseInit->Sector;
+    return HAL_ERROR;
+  }
+  memset(hal_host_flash_bank2 + pEraseInit->Sector * FLASH_SECTOR_SIZE, 0xFF, pEraseInit->NbSectors * FLASH_SECTOR_SIZE);
+  return HAL_OK;
+}
+
+void HAL_PWR_EnableBkUpAccess(void)
+{
+}
+
+HAL_StatusTypeDef HAL_PWREx_EnableBkUpReg(void)
+{
+  return HAL_OK;
+}
+
+/* DHT11 ---------------------------------------------------------------------*/
+void DHT11_Select(GPIO_TypeDef *port, uint16_t pin)
+{
+  /* Every room reads the same simulated sensor */
+  (void)port;
+  (void)pin;
+}
+
+void microDelay(uint16_t delay)
+{
+  sleepMicros(delay);
+}
+
+void milliDelay(uint16_t ms)
+{
+  sleepMicros((uint64_t)ms * 1000U);
+}
+
+void DHT11_PullLow(void)
+{
+  HAL_GPIO_WritePin(DHT11_PORT, DHT11_PIN, GPIO_PIN_RESET);
+}
+
+uint8_t DHT11_Handshake(void)
+{
+  HAL_GPIO_WritePin(DHT11_PORT, DHT11_PIN, GPIO_PIN_SET);
+  return dht11Frame.valid;
+}
+
+uint8_t DHT11_Start(void)
+{
+  DHT11_PullLow();
+  milliDelay(20);
+  return DHT11_Handshake();
+}
+
+uint8_t DHT11_Read(void)
+{
+  /* Bytes come out in frame order: RHI, RHD, TCI, TCD, SUM */
+  static HAL_HOST_STATE unsigned next = 0;
+  const uint8_t *bytes = &dht11Frame.RHI;
+  uint8_t value = bytes[next];
+  next = (next + 1) % 5;
+  return value;
+}
+
+uint8_t DHT11_ReadFrame(DHT11_Frame *frame)
+{
+  microDelay(4000); /* Duration of handshake + 40 bits on the wire */
+  *frame = dht11Frame;
+  if (replayRecords != NULL)
+  {
+    uint16_t humidity = replayNext(REPLAY_DHT_HUMIDITY, 0, (uint16_t)(frame->RHI << 8 | frame->RHD));
+    uint16_t temperature = replayNext(REPLAY_DHT_TEMPERATURE, 0, (uint16_t)(frame->TCI << 8 | frame->TCD));
+    uint16_t check = replayNext(REPLAY_DHT_CHECK, 0, (uint16_t)(frame->SUM << 8 | frame->valid));
+    frame->RHI = (uint8_t)(humidity >> 8);
+    frame->RHD = (uint8_t)humidity;
+    frame->TCI = (uint8_t)(temperature >> 8);
+    frame->TCD = (uint8_t)temperature;
+    frame->SUM = (uint8_t)(check >> 8);
+    frame->valid = (uint8_t)check;
+  }
+  return frame->valid;
+}
+
+/* Stand-in control ----------------------------------------------------------*/
+void hal_host_set_adc(uint16_t raw)
+{
+  adcValue = raw;
+}
+
+void hal_host_set_input(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  if (PinState != GPIO_PIN_RESET)
+  {
+    GPIOx->IDR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->IDR &= ~(uint32_t)GPIO_Pin;
+  }
+}
+
+void hal_host_set_dht11(float temperature, float humidity, uint8_t valid)
+{
+  dht11Frame.TCI = (uint8_t)temperature;
+  dht11Frame.TCD = (uint8_t)((temperature - dht11Frame.TCI) * 10.0f);
+  dht11Frame.RHI = (uint8_t)humidity;
+  dht11Frame.RHD = 0;
+  dht11Frame.SUM = (uint8_t)(dht11Frame.RHI + dht11Frame.RHD + dht11Frame.TCI + dht11Frame.TCD);
+  dht11Frame.valid = valid;
+  if (!valid)
+  {
+    dht11Frame.SUM++;
+  }
+}
+
+void hal_host_set_virtual_time(uint8_t enable)
+{
+  virtualTime = enable;
+}
+
+void hal_host_replay(const HalHostRecord *records, size_t count)
+{
+  replayRecords = records;
+  replayCount = records != NULL ? count : 0;
+  memset(replayCursor, 0, sizeof(replayCursor));
+  replayMisses = 0;
+}
+
+unsigned long hal_host_replay_misses(void)
+{
+  return replayMisses;
+}
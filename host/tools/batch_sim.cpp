@@ -0,0 +1,240 @@
+/**
+ * Batch runner: the lab model (top_coupled) replayed over recorded sensor
+ * traces in virtual time, as fast as the CPU allows, scenarios in parallel.
+ *
+ * Every scenario runs on its own worker thread with its own HAL stand-in
+ * (built with HAL_HOST_THREAD_LOCAL) and HeapRootCoordinator<TraceReplayClock>,
+ * dealt by a WorkStealingPool.
+ *
+ * Usage:
+ *   batch_sim [-j jobs] [-r repeat] [-d seconds] trace...   replay (duration: trace length)
+ *   batch_sim --synth file days                             write a synthetic trace
+ *   batch_sim --convert in.csv out.bin                      CSV to binary columnar
+ *
+ * Output: one line per scenario
+ * "scenario;trace;sim_days;events;wall_s;speedup;good_s;average_s;bad_s;motion_s;servo_duty",
+ * then "batch;scenarios;sim_days;wall_s;sim_days_per_hour".
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "top.hpp"
+#include "heap_coordinator.hpp"
+#include "trace_replay.hpp"
+#include "work_stealing_pool.hpp"
+
+extern "C"
+{
+#include "adc.h"
+#include "tim.h"
+}
+
+using namespace cadmium;
+
+static constexpr double DAY = 86400.0;
+
+// Model construction goes through BootSequencer's static pin queue: one thread at a time
+static std::mutex constructionMutex;
+
+struct Scenario
+{
+    std::string path;
+    std::shared_ptr<const SensorTrace> trace;
+    double duration;
+
+    unsigned long events = 0;
+    double wall = 0;
+    ReplayMetrics metrics;
+};
+
+static void runScenario(Scenario &scenario)
+{
+    // Peripherals of this thread, as main() sets them up on the board
+    hal_host_set_virtual_time(1);
+    MX_ADC1_Init();
+    MX_TIM2_Init();
+    HAL_TIM_Base_Start(&htim2);
+    MX_TIM4_Init();
+    HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_1);
+    MX_TIM6_Init();
+    HAL_TIM_Base_Start(&htim6);
+
+    std::shared_ptr<top_coupled> model;
+    {
+        std::lock_guard<std::mutex> lock(constructionMutex);
+        model = std::make_shared<top_coupled>("top_coupled");
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    HeapRootCoordinator<TraceReplayClock> coordinator(model, TraceReplayClock(scenario.trace, LabRoom::hardware(0), &scenario.metrics).until(scenario.duration));
+    coordinator.start();
+    coordinator.simulate(scenario.duration);
+    coordinator.stop();
+    scenario.wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    scenario.events = coordinator.getEventCount();
+}
+
+/**
+ * Office-like days. From 8:00 to 18:00 the room holds 0 to 4 people, drawn
+ * every 30 minutes (PIR motion while occupied). co2Update reads the MG-811
+ * voltage against its 21-sample running mean, so a CO2 level shows as a
+ * steady slope of the raw count: it falls by 2.5 counts/s per person while
+ * CO2 builds up (average band from one person, bad band from three) until the
+ * window is opened, then climbs back at 1 count/s while the room airs out
+ * (good band). The temperature swings daily by 4 °C around a mean drawn per
+ * day, plus 0.4 °C per person, and crosses the 25 °C trigger on warm
+ * afternoons.
+ */
+static SensorTrace synthesize(double days, unsigned seed)
+{
+    SensorTrace trace;
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    std::uniform_int_distribution<int> headcount(0, 4);
+    std::bernoulli_distribution moving(0.3);
+    const double step = 1.0;    // Trace period (s)
+    const double slot = 1800.0; // Time between two headcount draws (s)
+    const float clean = 900.0f; // Raw count with the room aired out
+    const float stale = 150.0f; // Raw count at which the window is opened
+    float level = clean;        // Raw count without noise
+    bool airing = false;
+    int people = 0;
+    float dayMean = 0.0f;
+    for (double t = 0; t <= days * DAY; t += step)
+    {
+        double hour = std::fmod(t, DAY) / 3600.0;
+        if (std::fmod(t, DAY) < step)
+        {
+            dayMean = 21.5f + noise(rng);
+        }
+        if (std::fmod(t, slot) < step)
+        {
+            people = hour >= 8.0 && hour < 18.0 ? headcount(rng) : 0;
+        }
+        if (people > 0 && !airing)
+        {
+            level -= 2.5f * static_cast<float>(people * step);
+            airing = level <= stale;
+        }
+        else if (level < clean)
+        {
+            level = std::min(clean, level + static_cast<float>(step));
+            airing = level < clean;
+        }
+        float raw = level + noise(rng);
+        float celsius = dayMean + 4.0f * static_cast<float>(std::sin((hour - 9.0) * M_PI / 12.0)) + 0.4f * static_cast<float>(people) + noise(rng) * 0.3f;
+        trace.add(t, static_cast<uint16_t>(raw), celsius, people > 0 && moving(rng));
+    }
+    return trace;
+}
+
+static int usage()
+{
+    std::fprintf(stderr, "usage: batch_sim [-j jobs] [-r repeat] [-d seconds] trace...\n"
+                         "       batch_sim --synth file days\n"
+                         "       batch_sim --convert in.csv out.bin\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 4 && std::string(argv[1]) == "--synth")
+    {
+        SensorTrace trace = synthesize(std::atof(argv[3]), 42);
+        std::string path = argv[2];
+        if (path.size() > 4 && path.compare(path.size() - 4, 4, ".bin") == 0)
+        {
+            return saveBinary(path, trace) ? 0 : 1;
+        }
+        FILE *file = std::fopen(path.c_str(), "w");
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "%s: cannot create\n", path.c_str());
+            return 1;
+        }
+        std::fprintf(file, "time,co2,temperature,motion\n");
+        for (std::size_t i = 0; i < trace.size(); i++)
+        {
+            std::fprintf(file, "%.1f,%u,%.1f,%u\n", trace.time[i], trace.co2[i], trace.temperature[i], trace.motion[i]);
+        }
+        return std::fclose(file) == 0 ? 0 : 1;
+    }
+    if (argc == 4 && std::string(argv[1]) == "--convert")
+    {
+        SensorTrace trace;
+        return loadCsv(argv[2], trace) && saveBinary(argv[3], trace) ? 0 : 1;
+    }
+
+    unsigned jobs = std::max(1U, std::thread::hardware_concurrency());
+    unsigned repeat = 1;
+    double duration = 0;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if ((arg == "-j" || arg == "-r" || arg == "-d") && i + 1 < argc)
+        {
+            const char *value = argv[++i];
+            if (arg == "-j")
+                jobs = std::max(1, std::atoi(value));
+            else if (arg == "-r")
+                repeat = std::max(1, std::atoi(value));
+            else
+                duration = std::atof(value);
+        }
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            return usage();
+        }
+        else
+        {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.empty())
+    {
+        return usage();
+    }
+
+    std::vector<Scenario> scenarios;
+    for (const std::string &path : paths)
+    {
+        auto trace = std::make_shared<SensorTrace>();
+        if (!loadTrace(path, *trace))
+        {
+            return 1;
+        }
+        for (unsigned r = 0; r < repeat; r++)
+        {
+            scenarios.push_back({path, trace, duration > 0 ? duration : trace->duration()});
+        }
+    }
+
+    WorkStealingPool pool(jobs);
+    auto begin = std::chrono::steady_clock::now();
+    pool.run(scenarios.size(), [&](std::size_t i)
+             { runScenario(scenarios[i]); });
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    std::printf("scenario;trace;sim_days;events;wall_s;speedup;good_s;average_s;bad_s;motion_s;servo_duty\n");
+    double simulated = 0;
+    for (std::size_t i = 0; i < scenarios.size(); i++)
+    {
+        const Scenario &s = scenarios[i];
+        const ReplayMetrics &m = s.metrics;
+        simulated += s.duration;
+        std::printf("%zu;%s;%.3f;%lu;%.3f;%.0f;%.0f;%.0f;%.0f;%.0f;%.4f\n", i, s.path.c_str(), s.duration / DAY, s.events,
+                    s.wall, s.wall > 0 ? s.duration / s.wall : 0.0, m.goodSeconds, m.averageSeconds, m.badSeconds,
+                    m.motionSeconds, m.observed > 0 ? m.servoDutySeconds / m.observed : 0.0);
+    }
+    std::printf("batch;%zu;%.3f;%.3f;%.0f\n", scenarios.size(), simulated / DAY, wall, wall > 0 ? simulated / DAY / wall * 3600.0 : 0.0);
+    return 0;
+}
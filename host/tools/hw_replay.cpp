@@ -0,0 +1,136 @@
+/**
+ * Hardware-read replay: reruns the lab model (top_coupled) on the host with
+ * every ADC, GPIO and DHT11 read answered from the "hw;" lines of a log
+ * recorded with DEVS_HW_RECORD (main/include/hw_trace.hpp), in virtual time.
+ *
+ * The stand-in's live sensor values are set to values the lab never reads
+ * (ADC 0, invalid DHT11 frame, inputs low), so a read missing from the record
+ * shows up in the log as well as in the miss count.
+ *
+ * Usage:
+ *   hw_replay [-d seconds] recorded.log > replayed.log
+ *
+ * The replayed log then matches the recorded one without its hw; lines:
+ *   grep -v '^hw;' recorded.log | diff - replayed.log
+ * Duration defaults to just past the time of the last log line of the
+ * recording; pass the recorded SIM_DURATION with -d to be exact.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "top.hpp"
+#include "heap_coordinator.hpp"
+#include "cadmium/simulation/logger/stdout.hpp"
+
+extern "C"
+{
+#include "adc.h"
+#include "tim.h"
+}
+
+using namespace cadmium;
+
+// hw; records and last log time of a recorded run
+static bool loadRecording(const char *path, std::vector<HalHostRecord> &records, double &lastTime)
+{
+    FILE *file = std::strcmp(path, "-") == 0 ? stdin : std::fopen(path, "r");
+    if (file == nullptr)
+    {
+        std::fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    char line[512];
+    unsigned long dropped = 0;
+    while (std::fgets(line, sizeof(line), file) != nullptr)
+    {
+        unsigned long tick;
+        unsigned kind, channel, value;
+        double time;
+        if (std::strncmp(line, "hw;dropped;", 11) == 0)
+        {
+            dropped = std::strtoul(line + 11, nullptr, 10);
+        }
+        else if (std::sscanf(line, "hw;%lu;%u;%u;%u", &tick, &kind, &channel, &value) == 4)
+        {
+            records.push_back({static_cast<uint32_t>(tick), static_cast<uint8_t>(kind), static_cast<uint8_t>(channel), static_cast<uint16_t>(value)});
+        }
+        else if (std::sscanf(line, "%lf;", &time) == 1)
+        {
+            lastTime = time;
+        }
+    }
+    if (file != stdin)
+    {
+        std::fclose(file);
+    }
+    if (dropped != 0)
+    {
+        std::fprintf(stderr, "%s: %lu reads were dropped while recording, the replay diverges from there\n", path, dropped);
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    double duration = 0;
+    const char *path = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+        {
+            duration = std::atof(argv[++i]);
+        }
+        else if (path == nullptr)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            path = nullptr;
+            break;
+        }
+    }
+    if (path == nullptr)
+    {
+        std::fprintf(stderr, "usage: hw_replay [-d seconds] recorded.log\n");
+        return 2;
+    }
+
+    std::vector<HalHostRecord> records;
+    double lastTime = 0;
+    if (!loadRecording(path, records, lastTime))
+    {
+        return 1;
+    }
+
+    // Peripherals as main() sets them up on the board
+    hal_host_set_virtual_time(1);
+    MX_ADC1_Init();
+    MX_TIM2_Init();
+    HAL_TIM_Base_Start(&htim2);
+    MX_TIM4_Init();
+    HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_1);
+    MX_TIM6_Init();
+    HAL_TIM_Base_Start(&htim6);
+
+    hal_host_set_adc(0);
+    hal_host_set_dht11(0.0f, 0.0f, 0);
+    hal_host_replay(records.data(), records.size());
+
+    auto model = std::make_shared<top_coupled>("top_coupled");
+    HeapRootCoordinator<VirtualClock> coordinator(model);
+    coordinator.setLogger<STDOUTLogger>(";");
+    coordinator.start();
+    coordinator.simulate(duration > 0 ? duration : lastTime + 1e-3); // Log times are rounded, keep the events of the last line
+    coordinator.stop();
+    std::fflush(stdout);
+
+    unsigned long misses = hal_host_replay_misses();
+    std::fprintf(stderr, "hw_replay: %zu records, %lu reads not in the recording\n", records.size(), misses);
+    hal_host_replay(nullptr, 0);
+    return misses == 0 ? 0 : 1;
+}
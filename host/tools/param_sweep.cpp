@@ -0,0 +1,306 @@
+/**
+ * Parameter sweep: the lab model replayed over recorded traces (see
+ * batch_sim.cpp) for every combination of the tunable room parameters
+ * (RoomParameters: CO2 bands, temperature trigger, servo command table), on a
+ * work-stealing thread pool.
+ *
+ * Each configuration is scored over all traces on
+ *  - discomfort: temperature above the comfort limit while the servo is idle (K.h),
+ *  - energy: integral of the servo duty cycle (duty.h),
+ * and the configurations that no other one beats on both are printed as a
+ * Pareto table, by increasing energy.
+ *
+ * Usage: param_sweep [-j jobs] [-a list] [-b list] [-t list] [-s tables] [-c comfort] [-o all.csv] trace...
+ *   -a  lower bound of the average CO2 band (ppm), default 500
+ *   -b  lower bound of the bad CO2 band (ppm), default 1000
+ *   -t  temperature trigger (°C), default 25
+ *   -s  servo command tables "c0,c1,c2;c0,c1,c2...", default "0.25,0.5,0.75"
+ *   -c  comfort limit (°C), default 24
+ * A list is "v1,v2,..." or a range "first:last:step".
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "top.hpp"
+#include "heap_coordinator.hpp"
+#include "trace_replay.hpp"
+#include "work_stealing_pool.hpp"
+
+extern "C"
+{
+#include "adc.h"
+#include "tim.h"
+}
+
+using namespace cadmium;
+
+// Model construction goes through BootSequencer's static pin queue: one thread at a time
+static std::mutex constructionMutex;
+
+// One replay: configuration index and trace index
+struct Run
+{
+    std::size_t config;
+    std::size_t trace;
+    ReplayMetrics metrics;
+};
+
+static void replay(const RoomParameters &params, std::shared_ptr<const SensorTrace> trace, float comfort, ReplayMetrics &metrics)
+{
+    hal_host_set_virtual_time(1);
+    MX_ADC1_Init();
+    MX_TIM2_Init();
+    HAL_TIM_Base_Start(&htim2);
+    MX_TIM4_Init();
+    HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_1);
+    MX_TIM6_Init();
+    HAL_TIM_Base_Start(&htim6);
+
+    std::shared_ptr<top_coupled> model;
+    {
+        std::lock_guard<std::mutex> lock(constructionMutex);
+        model = std::make_shared<top_coupled>("top_coupled", params);
+    }
+    double duration = trace->duration();
+    HeapRootCoordinator<TraceReplayClock> coordinator(model, TraceReplayClock(std::move(trace), LabRoom::hardware(0), &metrics, comfort));
+    coordinator.start();
+    coordinator.simulate(duration);
+    coordinator.stop();
+}
+
+// "v1,v2,..." or "first:last:step"
+static bool parseList(const std::string &text, std::vector<double> &values)
+{
+    values.clear();
+    double first, last, step;
+    char c1, c2;
+    std::istringstream range(text);
+    if (text.find(':') != std::string::npos)
+    {
+        if (!(range >> first >> c1 >> last >> c2 >> step) || c1 != ':' || c2 != ':' || step <= 0)
+        {
+            return false;
+        }
+        for (double v = first; v <= last + step * 1e-9; v += step)
+        {
+            values.push_back(v);
+        }
+        return !values.empty();
+    }
+    std::istringstream list(text);
+    std::string item;
+    while (std::getline(list, item, ','))
+    {
+        char *end;
+        values.push_back(std::strtod(item.c_str(), &end));
+        if (end == item.c_str())
+        {
+            return false;
+        }
+    }
+    return !values.empty();
+}
+
+static bool parseTables(const std::string &text, std::vector<std::array<double, 3>> &tables)
+{
+    tables.clear();
+    std::istringstream list(text);
+    std::string item;
+    while (std::getline(list, item, ';'))
+    {
+        std::vector<double> values;
+        if (!parseList(item, values) || values.size() != 3)
+        {
+            return false;
+        }
+        tables.push_back({values[0], values[1], values[2]});
+    }
+    return !tables.empty();
+}
+
+static int usage()
+{
+    std::fprintf(stderr, "usage: param_sweep [-j jobs] [-a list] [-b list] [-t list] [-s tables] [-c comfort] [-o all.csv] trace...\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned jobs = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<double> averages = {500}, bads = {1000}, triggers = {25};
+    std::vector<std::array<double, 3>> tables = {{0.25, 0.5, 0.75}};
+    float comfort = 24.0f;
+    std::string allPath;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg.size() == 2 && arg[0] == '-' && i + 1 < argc)
+        {
+            std::string value = argv[++i];
+            bool ok = true;
+            switch (arg[1])
+            {
+            case 'j':
+                jobs = std::max(1, std::atoi(value.c_str()));
+                break;
+            case 'a':
+                ok = parseList(value, averages);
+                break;
+            case 'b':
+                ok = parseList(value, bads);
+                break;
+            case 't':
+                ok = parseList(value, triggers);
+                break;
+            case 's':
+                ok = parseTables(value, tables);
+                break;
+            case 'c':
+                comfort = std::strtof(value.c_str(), nullptr);
+                break;
+            case 'o':
+                allPath = value;
+                break;
+            default:
+                ok = false;
+            }
+            if (!ok)
+            {
+                return usage();
+            }
+        }
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            return usage();
+        }
+        else
+        {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.empty())
+    {
+        return usage();
+    }
+
+    std::vector<std::shared_ptr<const SensorTrace>> traces;
+    double traceSeconds = 0;
+    for (const std::string &path : paths)
+    {
+        auto trace = std::make_shared<SensorTrace>();
+        if (!loadTrace(path, *trace))
+        {
+            return 1;
+        }
+        traceSeconds += trace->duration();
+        traces.push_back(trace);
+    }
+
+    // Grid of configurations (bands with average >= bad are skipped)
+    std::vector<RoomParameters> configs;
+    for (double average : averages)
+        for (double bad : bads)
+            for (double trigger : triggers)
+                for (const auto &table : tables)
+                {
+                    if (average >= bad)
+                    {
+                        continue;
+                    }
+                    RoomParameters params;
+                    params.co2.averageThreshold = static_cast<float>(average);
+                    params.co2.badThreshold = static_cast<float>(bad);
+                    params.temperature.threshold = static_cast<float>(trigger);
+                    params.servo.commands = table;
+                    configs.push_back(params);
+                }
+
+    std::vector<Run> runs;
+    for (std::size_t c = 0; c < configs.size(); c++)
+    {
+        for (std::size_t t = 0; t < traces.size(); t++)
+        {
+            runs.push_back({c, t, {}});
+        }
+    }
+
+    WorkStealingPool pool(jobs);
+    auto begin = std::chrono::steady_clock::now();
+    pool.run(runs.size(), [&](std::size_t i)
+             { replay(configs[runs[i].config], traces[runs[i].trace], comfort, runs[i].metrics); });
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    // Scores summed over the traces
+    struct Score
+    {
+        double discomfort = 0; // K.h
+        double energy = 0;     // duty.h
+        double badHours = 0;   // Bad CO2 LED on
+    };
+    std::vector<Score> scores(configs.size());
+    for (const Run &run : runs)
+    {
+        Score &score = scores[run.config];
+        score.discomfort += run.metrics.discomfort / 3600.0;
+        score.energy += run.metrics.servoDutySeconds / 3600.0;
+        score.badHours += run.metrics.badSeconds / 3600.0;
+    }
+
+    auto describe = [&](std::size_t c, FILE *out)
+    {
+        const RoomParameters &p = configs[c];
+        std::fprintf(out, "%zu;%.0f;%.0f;%.2f;%g,%g,%g;%.4f;%.4f;%.2f\n", c, p.co2.averageThreshold, p.co2.badThreshold,
+                     p.temperature.threshold, p.servo.commands[0], p.servo.commands[1], p.servo.commands[2],
+                     scores[c].discomfort, scores[c].energy, scores[c].badHours);
+    };
+    const char *header = "config;co2_average;co2_bad;temp_trigger;servo_commands;discomfort_Kh;energy_duty_h;co2_bad_h\n";
+
+    if (!allPath.empty())
+    {
+        FILE *all = std::fopen(allPath.c_str(), "w");
+        if (all == nullptr)
+        {
+            std::fprintf(stderr, "%s: cannot create\n", allPath.c_str());
+            return 1;
+        }
+        std::fputs(header, all);
+        for (std::size_t c = 0; c < configs.size(); c++)
+        {
+            describe(c, all);
+        }
+        std::fclose(all);
+    }
+
+    // Pareto front on (discomfort, energy): sort by energy, keep strictly decreasing discomfort
+    std::vector<std::size_t> order(configs.size());
+    for (std::size_t c = 0; c < order.size(); c++)
+    {
+        order[c] = c;
+    }
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+              { return scores[a].energy < scores[b].energy ||
+                       (scores[a].energy == scores[b].energy && scores[a].discomfort < scores[b].discomfort); });
+    std::fputs(header, stdout);
+    double best = std::numeric_limits<double>::infinity();
+    for (std::size_t c : order)
+    {
+        if (scores[c].discomfort < best)
+        {
+            best = scores[c].discomfort;
+            describe(c, stdout);
+        }
+    }
+    std::printf("sweep;configs;%zu;runs;%zu;sim_days;%.1f;wall_s;%.2f;threads;%u;steals;%lu\n", configs.size(), runs.size(),
+                traceSeconds * configs.size() / 86400.0, wall, pool.size(), pool.stealCount());
+    return 0;
+}
@@ -0,0 +1,282 @@
+/**
+ * Sampling policy comparison: the lab model replayed over recorded traces
+ * (see batch_sim.cpp) with three sets of sampling periods (RoomSampling,
+ * adaptive_sampling.hpp):
+ *  - reference: every model polled at the shortest adaptive period
+ *    (CO2 0.4 s, DHT11 1 s, motion 0.25 s, classifier 0.1 s),
+ *  - fixed: the default periods (0.8 s, 2 s, 0.5 s, 0.1 s),
+ *  - adaptive: RoomSampling::adaptive().
+ *
+ * The pins the room drives (CO2 LEDs, motion LED, servo compare register) are
+ * watched after every event. Each change in the reference run is a detection
+ * to make; a policy detects it when its own output reaches the same value,
+ * and the delay is its detection latency. A change the policy never shows
+ * before the reference moves on is missed.
+ *
+ * Usage: rate_compare [-j jobs] trace...
+ * Output: policy;events_per_h;transitions_per_h;output_changes_per_h;detections;missed;mean_latency_s;p95_latency_s;max_latency_s
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "top.hpp"
+#include "heap_coordinator.hpp"
+#include "trace_replay.hpp"
+#include "work_stealing_pool.hpp"
+
+extern "C"
+{
+#include "adc.h"
+#include "tim.h"
+}
+
+using namespace cadmium;
+
+// Model construction goes through BootSequencer's static pin queue: one thread at a time
+static std::mutex constructionMutex;
+
+constexpr std::size_t OUTPUTS = 5; // Good, average and bad LEDs, motion LED, servo compare
+
+// Time and new value of every change of the room outputs
+struct OutputLog
+{
+    std::array<std::vector<std::pair<double, uint32_t>>, OUTPUTS> changes;
+
+    // Value of output k at time (after the events of that time)
+    [[nodiscard]] uint32_t at(std::size_t k, double time) const
+    {
+        const auto &c = changes[k];
+        auto it = std::upper_bound(c.begin(), c.end(), time, [](double t, const std::pair<double, uint32_t> &change)
+                                   { return t < change.first; });
+        return it == c.begin() ? 0 : std::prev(it)->second;
+    }
+};
+
+/**
+ * TraceReplayClock that also logs the room outputs: before waiting for the
+ * next event, the pins left by the previous one are compared with the last
+ * values seen.
+ */
+class WatchingClock
+{
+    TraceReplayClock replay;
+    RoomHardware room;
+    OutputLog *log;
+    std::array<uint32_t, OUTPUTS> last;
+    double timeLast;
+
+    void watch()
+    {
+        std::array<uint32_t, OUTPUTS> now = {(room.goodPort->ODR & room.good.Pin) != 0,
+                                             (room.averagePort->ODR & room.average.Pin) != 0,
+                                             (room.badPort->ODR & room.bad.Pin) != 0,
+                                             (room.motionLedPort->ODR & room.motionLed.Pin) != 0,
+                                             __HAL_TIM_GET_COMPARE(room.servoTimer, room.servoChannel)};
+        for (std::size_t k = 0; k < OUTPUTS; k++)
+        {
+            if (now[k] == last[k])
+            {
+                continue;
+            }
+            auto &changes = log->changes[k];
+            if (!changes.empty() && changes.back().first == timeLast)
+            {
+                changes.pop_back(); // Several waits at one time: only the value left at its end counts
+            }
+            uint32_t before = changes.empty() ? 0 : changes.back().second;
+            if (now[k] != before)
+            {
+                changes.push_back({timeLast, now[k]});
+            }
+            last[k] = now[k];
+        }
+    }
+
+public:
+    WatchingClock(std::shared_ptr<const SensorTrace> trace, const RoomHardware &hw, ReplayMetrics *metrics, OutputLog *out)
+        : replay(std::move(trace), hw, metrics), room(hw), log(out), last{}, timeLast(0) {}
+
+    void start(double time)
+    {
+        replay.start(time);
+        timeLast = time;
+    }
+
+    void stop(double time)
+    {
+        watch();
+        replay.stop(time);
+    }
+
+    double waitUntil(double timeNext)
+    {
+        watch();
+        timeLast = replay.waitUntil(timeNext);
+        return timeLast;
+    }
+};
+
+// One replay: policy index and trace index
+struct Run
+{
+    std::size_t policy;
+    std::size_t trace;
+    unsigned long events = 0;
+    unsigned long transitions = 0;
+    ReplayMetrics metrics;
+    OutputLog outputs;
+};
+
+static void replay(const RoomSampling &sampling, std::shared_ptr<const SensorTrace> trace, Run &run)
+{
+    hal_host_set_virtual_time(1);
+    MX_ADC1_Init();
+    MX_TIM2_Init();
+    HAL_TIM_Base_Start(&htim2);
+    MX_TIM4_Init();
+    HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_1);
+    MX_TIM6_Init();
+    HAL_TIM_Base_Start(&htim6);
+
+    RoomParameters params;
+    params.sampling = sampling;
+    std::shared_ptr<top_coupled> model;
+    {
+        std::lock_guard<std::mutex> lock(constructionMutex);
+        model = std::make_shared<top_coupled>("top_coupled", params);
+    }
+    double duration = trace->duration();
+    HeapRootCoordinator<WatchingClock> coordinator(model, WatchingClock(std::move(trace), LabRoom::hardware(0), &run.metrics, &run.outputs));
+    coordinator.start();
+    coordinator.simulate(duration);
+    coordinator.stop();
+    run.events = coordinator.getEventCount();
+    run.transitions = coordinator.getTransitionCount();
+}
+
+// Detection latencies of a run against the reference run of the same trace
+static void detect(const OutputLog &reference, const OutputLog &policy, std::vector<double> &latencies, unsigned long &missed)
+{
+    for (std::size_t k = 0; k < OUTPUTS; k++)
+    {
+        const auto &changes = reference.changes[k];
+        const auto &own = policy.changes[k];
+        for (std::size_t i = 0; i < changes.size(); i++)
+        {
+            double from = changes[i].first;
+            double until = i + 1 < changes.size() ? changes[i + 1].first : 1e300;
+            uint32_t value = changes[i].second;
+            if (policy.at(k, from) == value)
+            {
+                latencies.push_back(0.0);
+                continue;
+            }
+            auto it = std::upper_bound(own.begin(), own.end(), from, [](double t, const std::pair<double, uint32_t> &change)
+                                       { return t < change.first; });
+            while (it != own.end() && it->first < until && it->second != value)
+            {
+                ++it;
+            }
+            if (it != own.end() && it->first < until)
+            {
+                latencies.push_back(it->first - from);
+            }
+            else
+            {
+                missed++;
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned jobs = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "-j" && i + 1 < argc)
+        {
+            jobs = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            paths.clear();
+            break;
+        }
+        else
+        {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.empty())
+    {
+        std::fprintf(stderr, "usage: rate_compare [-j jobs] trace...\n");
+        return 2;
+    }
+
+    std::vector<std::shared_ptr<const SensorTrace>> traces;
+    double hours = 0;
+    for (const std::string &path : paths)
+    {
+        auto trace = std::make_shared<SensorTrace>();
+        if (!loadTrace(path, *trace))
+        {
+            return 1;
+        }
+        hours += trace->duration() / 3600.0;
+        traces.push_back(trace);
+    }
+
+    const RoomSampling adaptive = RoomSampling::adaptive();
+    const RoomSampling reference = {SamplingPolicy::fixed(adaptive.co2.minPeriod), SamplingPolicy::fixed(adaptive.temperature.minPeriod),
+                                    SamplingPolicy::fixed(adaptive.motion.minPeriod), SamplingPolicy::fixed(adaptive.classifier.minPeriod)};
+    const std::array<std::pair<const char *, RoomSampling>, 3> policies = {{{"reference", reference}, {"fixed", RoomSampling()}, {"adaptive", adaptive}}};
+
+    std::vector<Run> runs(policies.size() * traces.size());
+    for (std::size_t i = 0; i < runs.size(); i++)
+    {
+        runs[i].policy = i / traces.size();
+        runs[i].trace = i % traces.size();
+    }
+    WorkStealingPool pool(jobs);
+    pool.run(runs.size(), [&](std::size_t i)
+             { replay(policies[runs[i].policy].second, traces[runs[i].trace], runs[i]); });
+
+    std::printf("policy;events_per_h;transitions_per_h;output_changes_per_h;detections;missed;mean_latency_s;p95_latency_s;max_latency_s\n");
+    for (std::size_t p = 0; p < policies.size(); p++)
+    {
+        unsigned long events = 0, transitions = 0, changes = 0, missed = 0;
+        std::vector<double> latencies;
+        for (std::size_t t = 0; t < traces.size(); t++)
+        {
+            const Run &run = runs[p * traces.size() + t];
+            events += run.events;
+            transitions += run.transitions;
+            for (const auto &c : run.outputs.changes)
+            {
+                changes += c.size();
+            }
+            detect(runs[t].outputs, run.outputs, latencies, missed);
+        }
+        std::sort(latencies.begin(), latencies.end());
+        double mean = 0;
+        for (double l : latencies)
+        {
+            mean += l;
+        }
+        mean = latencies.empty() ? 0 : mean / latencies.size();
+        double p95 = latencies.empty() ? 0 : latencies[latencies.size() * 95 / 100];
+        double max = latencies.empty() ? 0 : latencies.back();
+        std::printf("%s;%.0f;%.0f;%.1f;%zu;%lu;%.3f;%.3f;%.3f\n", policies[p].first, events / hours, transitions / hours, changes / hours,
+                    latencies.size(), missed, mean, p95, max);
+    }
+    return 0;
+}
@@ -9,6 +9,11 @@ extern "C"
 {
 #include "adc.h"
 }
+#include "hw_trace.hpp"
+#include "adaptive_sampling.hpp"
+#ifdef DEVS_RTOS_RUNTIME
+#include "rtos_runtime.hpp"
+#endif
 
 using namespace std;
 
@@ -22,73 +27,114 @@ namespace cadmium
         double sigma;           // Time until next internal transition
         float tab[21] = {0.0f}; // Circular buffer for smoothing
         int index = 0;          // Current index in the buffer
-        AnalogInputState() : output(0.0), sigma(1.0) {}
+        uint16_t raw = 0;       // Last raw ADC sample
+        SamplingTracker rate = {}; // Sampling period (AnalogInput)
+        bool occupied = false;     // Last level of the occupied port
+        bool stale = false;        // No fresh ADC result at the last reading: output kept from the one before
+        constexpr AnalogInputState() : output(0.0), sigma(1.0) {}
     };
 
     // Logging state information to the output stream
     std::ostream &operator<<(std::ostream &out, const AnalogInputState &state)
     {
         out << "Analog value: " << state.output;
+        if (state.stale)
+        {
+            out << " (stale)";
+        }
         return out;
     }
 
+    /**
+     * Convert a raw ADC sample of the CO2 sensor to ppm and update the
+     * smoothing buffer and output of state (shared by AnalogInput and the
+     * scan-fed ScanChannelInput).
+     */
+    inline void co2Update(AnalogInputState &state, uint16_t raw)
+    {
+        // Convert raw value to voltage (assuming 10-bit ADC and 5V reference)
+        float voltage = (raw / 1024.0f) * 5.0f;
+
+        // Adjust based on sensor output ratio (e.g., voltage divider or amplifier gain)
+        float Vout = voltage / 8.5f;
+
+        // Store value in circular buffer
+        state.tab[state.index] = Vout;
+        state.index = (state.index + 1) % 21;
+
+        // Compute average value (Vref) for smoothing
+        float sum = 0.0f;
+        for (int i = 0; i < 21; i++)
+        {
+            sum += state.tab[i];
+        }
+        float Vref = sum / 21;
+
+        // Convert voltage to CO₂ ppm using sensor's response curve
+        float ppm = 0.0f;
+        float slope = 0.030f / (2.602f - 3.0f);              // Example calibration slope
+        ppm = powf(10.0f, ((Vout - Vref) / slope + 2.602f)); // Logarithmic formula
+
+        state.output = ppm;
+    }
+
     // AnalogInput atomic model class
     class AnalogInput : public Atomic<AnalogInputState>
     {
     public:
-        Port<float> out; // Output port
+        Port<float> out;     // Output port
+        Port<bool> occupied; // Room occupancy (motion input), only coupled with an adaptive policy
 
         // Constructor: initializes the model with GPIO and ADC handles
-        AnalogInput(const std::string &id, GPIO_TypeDef *selectedPort, ADC_HandleTypeDef *pin)
-            : Atomic<AnalogInputState>(id, AnalogInputState()), port(selectedPort), analogPin(pin), pollingRate(1.0)
+        AnalogInput(const std::string &id, GPIO_TypeDef *selectedPort, ADC_HandleTypeDef *pin,
+                    const SamplingPolicy &policy = SamplingPolicy::fixed(0.8))
+            : Atomic<AnalogInputState>(id, AnalogInputState()), port(selectedPort), analogPin(pin), pollingRate(1.0), sampling(policy)
         {
             out = addOutPort<float>("out");
+            occupied = addInPort<bool>("occupied");
         }
 
         GPIO_TypeDef *port;           // GPIO port (not used in logic, but kept for completeness)
         ADC_HandleTypeDef *analogPin; // Pointer to ADC peripheral
         double pollingRate;           // Time interval between ADC readings (not currently used)
+        SamplingPolicy sampling;      // Period between ADC readings (adaptive_sampling.hpp)
 
         // Internal transition: read analog value, convert to voltage, compute ppm
         void internalTransition(AnalogInputState &state) const override
         {
+#ifdef DEVS_RTOS_RUNTIME
+            // Collect the conversion requested at the previous transition (done by the ADC worker thread);
+            // on a timeout keep the last ppm rather than feeding the old sample to the smoothing buffer again
+            bool fresh = RtosRuntime::adc().exchange(state.raw, RTOS_ADC_TIMEOUT_TICKS);
+#else
             // Start ADC conversion
             HAL_ADC_Start(analogPin);
-            HAL_ADC_PollForConversion(analogPin, 20);   // Wait for conversion to complete (timeout = 20ms)
-            uint16_t raw = HAL_ADC_GetValue(analogPin); // Get raw ADC value
-
-            // Convert raw value to voltage (assuming 10-bit ADC and 5V reference)
-            float voltage = (raw / 1024.0f) * 5.0f;
-
-            // Adjust based on sensor output ratio (e.g., voltage divider or amplifier gain)
-            float Vout = voltage / 8.5f;
-
-            // Store value in circular buffer
-            state.tab[state.index] = Vout;
-            state.index = (state.index + 1) % 21;
-
-            // Compute average value (Vref) for smoothing
-            float sum = 0.0f;
-            for (int i = 0; i < 21; i++)
+            HAL_ADC_PollForConversion(analogPin, 20); // Wait for conversion to complete (timeout = 20ms)
+            state.raw = HwTrace::adc(0, HAL_ADC_GetValue(analogPin)); // Get raw ADC value
+            bool fresh = true;
+#endif
+            state.stale = !fresh;
+            if (fresh)
             {
-                sum += state.tab[i];
+                co2Update(state, state.raw);
             }
-            float Vref = sum / 21;
-
-            // Convert voltage to CO₂ ppm using sensor's response curve
-            float ppm = 0.0f;
-            float slope = 0.030f / (2.602f - 3.0f);              // Example calibration slope
-            ppm = powf(10.0f, ((Vout - Vref) / slope + 2.602f)); // Logarithmic formula
-
-            // Update state
-            state.output = ppm;
-            state.sigma = 0.8; // Wait 0.8s before next reading
+            // 0.8 s before next reading, or adapted to how the raw signal moves
+            state.sigma = state.rate.next(state.raw, state.rate.sinceSample + state.sigma, state.occupied, sampling);
         }
 
-        // External transition: not used (no input port in this model)
+        // External transition: occupancy changes; the room becoming occupied brings the next reading closer
         void externalTransition(AnalogInputState &state, double e) const override
         {
-            // No input to process, model is purely time-driven
+            state.sigma -= e;
+            state.rate.sinceSample += e;
+            for (const auto level : occupied->getBag())
+            {
+                if (level && !state.occupied)
+                {
+                    state.sigma = state.rate.occupiedRemaining(state.sigma, sampling);
+                }
+                state.occupied = level;
+            }
         }
 
         // Output function: send current ppm value through output port
@@ -1,10 +1,11 @@
-#ifndef RT_CO2reception
+#ifndef RT_CO2reception_HPP
 #define RT_CO2reception_HPP
 
 #include "cadmium/modeling/devs/atomic.hpp"
 #include "stm32h7xx_hal_dma.h"
 #include "stm32h7xx_hal_adc.h"
 #include "stm32h7xx_hal_dac.h"
+#include "adaptive_sampling.hpp"
 extern "C"
 {
 #include "adc.h"
@@ -23,8 +24,16 @@ namespace cadmium
         bool output_bad;    // Flag if CO₂ level is considered bad
         bool output_avrege; // Flag if CO₂ level is considered average
         double sigma;       // Time until next internal transition
+        SamplingTracker rate; // Evaluation period
 
-        ReceptionState() : input(0.0), output_good(false), output_bad(false), output_avrege(false), sigma(0) {}
+        constexpr ReceptionState() : input(0.0), output_good(false), output_bad(false), output_avrege(false), sigma(0), rate{} {}
+    };
+
+    // CO2 bands of the Reception model (ppm)
+    struct ReceptionConfig
+    {
+        float averageThreshold = 500.0f; // Lower bound of the average band
+        float badThreshold = 1000.0f;    // Lower bound of the bad band
     };
 
     // Optional: print state to log (not used here)
@@ -42,11 +51,14 @@ namespace cadmium
         Port<bool> out_bad;    // Output port: CO₂ level is bad
         Port<float> in;        // Input port: receives CO₂ value
 
-        double pollingRate; // Unused, reserved for future extension
+        double pollingRate;      // Unused, reserved for future extension
+        ReceptionConfig config;  // CO2 bands
+        SamplingPolicy sampling; // Evaluation period (adaptive_sampling.hpp)
 
         // Constructor: define ports and initialize state
-        Reception(const std::string &id)
-            : Atomic<ReceptionState>(id, ReceptionState())
+        Reception(const std::string &id, const ReceptionConfig &bands = ReceptionConfig(),
+                  const SamplingPolicy &policy = SamplingPolicy::fixed(0.1))
+            : Atomic<ReceptionState>(id, ReceptionState()), config(bands), sampling(policy)
         {
             out_good = addOutPort<bool>("out_good");
             out_avrege = addOutPort<bool>("out_avrege");
@@ -57,14 +69,14 @@ namespace cadmium
         // Internal transition: evaluate CO₂ level and update output flags
         void internalTransition(ReceptionState &state) const override
         {
-            if (state.input >= 1000.0)
+            if (state.input >= config.badThreshold)
             {
                 // High CO₂ level: considered bad
                 state.output_bad = true;
                 state.output_good = false;
                 state.output_avrege = false;
             }
-            else if (state.input < 1000 && state.input >= 500)
+            else if (state.input < config.badThreshold && state.input >= config.averageThreshold)
             {
                 // Medium CO₂ level: considered average
                 state.output_avrege = true;
@@ -79,18 +91,24 @@ namespace cadmium
                 state.output_bad = false;
             }
 
-            state.sigma = 0.1; // Schedule next evaluation shortly
+            // Schedule next evaluation shortly; an adaptive policy backs off to a heartbeat while the input is steady
+            state.sigma = state.rate.next(state.input, state.rate.sinceSample + state.sigma, false, sampling);
         }
 
         // External transition: receive new CO₂ input
         void externalTransition(ReceptionState &state, double e) const override
         {
+            state.rate.sinceSample += e;
             if (!in->empty())
             {
                 for (const auto value : in->getBag())
                 {
                     state.input = value; // Take latest input value
                 }
+                if (sampling.adaptive())
+                {
+                    state.sigma = sampling.minPeriod; // Evaluate the new value now rather than at the next heartbeat
+                }
             }
         }
 
@@ -2,6 +2,15 @@
 
 extern TIM_HandleTypeDef htim6;
 uint32_t pMillis, cMillis;
+static GPIO_TypeDef *dht11Port = DHT11_PORT;
+static uint16_t dht11Pin = DHT11_PIN;
+
+void DHT11_Select (GPIO_TypeDef *port, uint16_t pin)
+{
+  dht11Port = port;
+  dht11Pin = pin;
+}
+
 void microDelay (uint16_t delay)
 {
   __HAL_TIM_SET_COUNTER(&htim6, 0);
@@ -14,31 +23,44 @@ void milliDelay(uint16_t ms)
         microDelay(1000);  // 1 ms = 1000 us
     }
 }
-uint8_t DHT11_Start (void)
+void DHT11_PullLow (void)
 {
-  uint8_t Response = 0;
   GPIO_InitTypeDef GPIO_InitStructPrivate = {0};
-  GPIO_InitStructPrivate.Pin = DHT11_PIN;
+  GPIO_InitStructPrivate.Pin = dht11Pin;
   GPIO_InitStructPrivate.Mode = GPIO_MODE_OUTPUT_PP;
   GPIO_InitStructPrivate.Speed = GPIO_SPEED_FREQ_LOW;
   GPIO_InitStructPrivate.Pull = GPIO_NOPULL;
-  HAL_GPIO_Init(DHT11_PORT, &GPIO_InitStructPrivate); // set the pin as output
-  HAL_GPIO_WritePin (DHT11_PORT, DHT11_PIN, 0);   // pull the pin low
+  HAL_GPIO_Init(dht11Port, &GPIO_InitStructPrivate); // set the pin as output
+  HAL_GPIO_WritePin (dht11Port, dht11Pin, 0);   // pull the pin low
+}
+
+uint8_t DHT11_Start (void)
+{
+  DHT11_PullLow();
   milliDelay(20);   // wait for 20ms
-  HAL_GPIO_WritePin (DHT11_PORT, DHT11_PIN, 1);   // pull the pin high
+  return DHT11_Handshake();
+}
+
+uint8_t DHT11_Handshake (void)
+{
+  uint8_t Response = 0;
+  GPIO_InitTypeDef GPIO_InitStructPrivate = {0};
+  GPIO_InitStructPrivate.Pin = dht11Pin;
+  GPIO_InitStructPrivate.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_WritePin (dht11Port, dht11Pin, 1);   // pull the pin high
   microDelay (30);   // wait for 30us
   GPIO_InitStructPrivate.Mode = GPIO_MODE_INPUT;
   GPIO_InitStructPrivate.Pull = GPIO_PULLUP;
-  HAL_GPIO_Init(DHT11_PORT, &GPIO_InitStructPrivate); // set the pin as input
+  HAL_GPIO_Init(dht11Port, &GPIO_InitStructPrivate); // set the pin as input
   microDelay (40);
-   if (!(HAL_GPIO_ReadPin (DHT11_PORT, DHT11_PIN)))
+   if (!(HAL_GPIO_ReadPin (dht11Port, dht11Pin)))
    {
      microDelay (80);
-    if ((HAL_GPIO_ReadPin (DHT11_PORT, DHT11_PIN))) Response = 1;
+    if ((HAL_GPIO_ReadPin (dht11Port, dht11Pin))) Response = 1;
    }
   pMillis = HAL_GetTick();
   cMillis = HAL_GetTick();
-   while ((HAL_GPIO_ReadPin (DHT11_PORT, DHT11_PIN)) && pMillis + 2 > cMillis)
+   while ((HAL_GPIO_ReadPin (dht11Port, dht11Pin)) && pMillis + 2 > cMillis)
    {
     cMillis = HAL_GetTick();
   }
@@ -52,21 +74,36 @@ uint8_t DHT11_Read (void)
   {
     pMillis = HAL_GetTick();
     cMillis = HAL_GetTick();
-    while (!(HAL_GPIO_ReadPin (DHT11_PORT, DHT11_PIN)) && pMillis + 2 > cMillis)
+    while (!(HAL_GPIO_ReadPin (dht11Port, dht11Pin)) && pMillis + 2 > cMillis)
     {  // wait for the pin to go high
       cMillis = HAL_GetTick();
     }
     microDelay (40);   // wait for 40 us
-    if (!(HAL_GPIO_ReadPin (DHT11_PORT, DHT11_PIN)))   // if the pin is low
+    if (!(HAL_GPIO_ReadPin (dht11Port, dht11Pin)))   // if the pin is low
       b&= ~(1<<(7-a));
     else
       b|= (1<<(7-a));
     pMillis = HAL_GetTick();
     cMillis = HAL_GetTick();
-    while ((HAL_GPIO_ReadPin (DHT11_PORT, DHT11_PIN)) && pMillis + 2 > cMillis)
+    while ((HAL_GPIO_ReadPin (dht11Port, dht11Pin)) && pMillis + 2 > cMillis)
     {  // wait for the pin to go low
       cMillis = HAL_GetTick();
     }
   }
   return b;
+}
+
+uint8_t DHT11_ReadFrame (DHT11_Frame *frame)
+{
+  frame->valid = 0;
+  if (DHT11_Handshake())
+  {
+    frame->RHI = DHT11_Read();
+    frame->RHD = DHT11_Read();
+    frame->TCI = DHT11_Read();
+    frame->TCD = DHT11_Read();
+    frame->SUM = DHT11_Read();
+    frame->valid = ((uint8_t)(frame->RHI + frame->RHD + frame->TCI + frame->TCD) == frame->SUM);
+  }
+  return frame->valid;
 }
\ No newline at end of file
@@ -19,12 +19,27 @@ extern uint8_t RHI, RHD, TCI, TCD, SUM;
 extern int tCelsius, tFahrenheit;
 extern float RH;
 
+// Trame complète lue sur le capteur
+typedef struct
+{
+  uint8_t RHI, RHD, TCI, TCD, SUM; // humidité, température, checksum
+  uint8_t valid;                   // 1 si la réponse et le checksum sont corrects
+} DHT11_Frame;
+
 // Prototype des fonctions
+// Capteur utilisé par les fonctions suivantes (DHT11_PORT/DHT11_PIN par défaut), un capteur par pièce
+void DHT11_Select(GPIO_TypeDef *port, uint16_t pin);
 void microDelay(uint16_t delay);
 void milliDelay(uint16_t ms);
 uint8_t DHT11_Start(void);
 uint8_t DHT11_Read(void);
 
+// Start découpé : impulsion basse (>= 18 ms, non critique) puis poignée de main temporisée
+void DHT11_PullLow(void);
+uint8_t DHT11_Handshake(void);
+// Poignée de main + 5 octets + vérification du checksum (appeler DHT11_PullLow 20 ms avant)
+uint8_t DHT11_ReadFrame(DHT11_Frame *frame);
+
 // Fin de encapsulation C++
 #ifdef __cplusplus
 }
@@ -13,6 +13,9 @@
 #include "stm32h7xx_hal_gpio.h"
 #include "stm32h7xx_hal_rcc.h"
 #include "stm32h743xx.h"
+#include "boot_sequencer.hpp"
+#include "hw_trace.hpp"
+#include "adaptive_sampling.hpp"
 
 #ifndef NO_LOGGING
 #include <iostream>
@@ -24,11 +27,12 @@ namespace cadmium
     // State of the digital input model
     struct DigitalInputState
     {
-        bool output;  // Current logic level of the input pin
-        double sigma; // Time until next internal transition
+        bool output;          // Current logic level of the input pin
+        double sigma;         // Time until next internal transition
+        SamplingTracker rate; // Polling period
 
         // Constructor initializing default values
-        explicit DigitalInputState() : output(false), sigma(0.1) {}
+        explicit constexpr DigitalInputState() : output(false), sigma(0.1), rate{} {}
     };
 
 #ifndef NO_LOGGING
@@ -49,22 +53,24 @@ namespace cadmium
         Port<bool> out; // Output port: sends the logic level of the pin
 
         // STM32 hardware configuration
-        GPIO_TypeDef *port;    // GPIO port (e.g., GPIOA, GPIOB)
-        GPIO_InitTypeDef pins; // Pin configuration structure
-        uint16_t pinNumber;    // Specific pin number (e.g., GPIO_PIN_5)
+        GPIO_TypeDef *port;      // GPIO port (e.g., GPIOA, GPIOB)
+        GPIO_InitTypeDef pins;   // Pin configuration structure
+        uint16_t pinNumber;      // Specific pin number (e.g., GPIO_PIN_5)
+        SamplingPolicy sampling; // Polling period (adaptive_sampling.hpp)
 
         /**
          * Constructor
          * @param id Unique ID of the DEVS model
          * @param selectedPort GPIO port to read from
          * @param selectedPins Pointer to pin configuration
+         * @param policy Polling period, 0.5 s by default
          */
-        DigitalInput(const std::string &id, GPIO_TypeDef *selectedPort, GPIO_InitTypeDef *selectedPins)
-            : Atomic<DigitalInputState>(id, DigitalInputState()), port(selectedPort), pins(*selectedPins)
+        DigitalInput(const std::string &id, GPIO_TypeDef *selectedPort, const GPIO_InitTypeDef *selectedPins,
+                     const SamplingPolicy &policy = SamplingPolicy::fixed(0.5))
+            : Atomic<DigitalInputState>(id, DigitalInputState()), port(selectedPort), pins(*selectedPins), sampling(policy)
         {
             out = addOutPort<bool>("out");
-            HAL_GPIO_Init(port, &pins); // Initialize the pin with HAL
-           
+            BootSequencer::requestPin(port, pins); // Queued until BootSequencer::commit()
         };
 
         /**
@@ -72,9 +78,10 @@ namespace cadmium
          */
         void internalTransition(DigitalInputState &state) const override
         {
-            GPIO_PinState pinstate = HAL_GPIO_ReadPin(port, pins.Pin);
+            GPIO_PinState pinstate = HwTrace::pin(port, pins.Pin, HAL_GPIO_ReadPin(port, pins.Pin));
             state.output = (pinstate == GPIO_PIN_SET);
-            state.sigma = 0.5; // Poll every 0.5 seconds
+            // Poll every 0.5 seconds, or faster right after the level changed
+            state.sigma = state.rate.next(state.output ? 1.0f : 0.0f, state.sigma, false, sampling); // No external transitions: sigma is the time since the last poll
         }
 
         /**
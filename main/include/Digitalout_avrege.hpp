@@ -5,6 +5,7 @@
 #include "stm32h7xx_hal_gpio.h"
 #include "stm32h7xx_hal_rcc.h"
 #include "stm32h743xx.h"
+#include "boot_sequencer.hpp"
 
 namespace cadmium
 {
@@ -15,7 +16,7 @@ namespace cadmium
         bool output;  // Current output value (true = HIGH, false = LOW)
         double sigma; // Time until next internal transition (not used here)
 
-        explicit DigitalOutputavregeState() : output(false), sigma(0) {}
+        explicit constexpr DigitalOutputavregeState() : output(false), sigma(0) {}
     };
 
     // Optional: logging operator for the state (currently empty)
@@ -43,17 +44,13 @@ namespace cadmium
          * @param selectedPort - GPIO port (e.g., GPIOA, GPIOB)
          * @param selectedPins - GPIO configuration structure
          */
-        DigitalOutputavrege(const std::string &id, GPIO_TypeDef *selectedPort, GPIO_InitTypeDef *selectedPins)
+        DigitalOutputavrege(const std::string &id, GPIO_TypeDef *selectedPort, const GPIO_InitTypeDef *selectedPins)
             : Atomic<DigitalOutputavregeState>(id, DigitalOutputavregeState()), port(selectedPort), pins(*selectedPins)
         {
             in = addInPort<bool>("in");
 
-            // Enable GPIO clocks (hardcoded for GPIOA and GPIOB)
-            __HAL_RCC_GPIOB_CLK_ENABLE();
-            __HAL_RCC_GPIOA_CLK_ENABLE();
-
-            // Initialize the GPIO pin
-            HAL_GPIO_Init(port, &pins);
+            // Queue the pin configuration; written with the other pins by BootSequencer::commit()
+            BootSequencer::requestPin(port, pins);
         }
 
         /**
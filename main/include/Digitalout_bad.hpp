@@ -5,6 +5,7 @@
 #include "stm32h7xx_hal_gpio.h"
 #include "stm32h7xx_hal_rcc.h"
 #include "stm32h743xx.h"
+#include "boot_sequencer.hpp"
 
 namespace cadmium
 {
@@ -15,7 +16,7 @@ namespace cadmium
         bool output;  // Current boolean value to be written to the pin
         double sigma; // Time until next internal transition (not used here)
 
-        explicit DigitalOutputbadState() : output(false), sigma(0) {}
+        explicit constexpr DigitalOutputbadState() : output(false), sigma(0) {}
     };
 
     // Optional: output stream operator for state (unused in logging here)
@@ -43,13 +44,13 @@ namespace cadmium
          * @param selectedPort - GPIO port where the signal should be written
          * @param selectedPins - GPIO pin configuration
          */
-        DigitalOutputbad(const std::string &id, GPIO_TypeDef *selectedPort, GPIO_InitTypeDef *selectedPins)
+        DigitalOutputbad(const std::string &id, GPIO_TypeDef *selectedPort, const GPIO_InitTypeDef *selectedPins)
             : Atomic<DigitalOutputbadState>(id, DigitalOutputbadState()), port(selectedPort), pins(*selectedPins)
         {
             in = addInPort<bool>("in");
 
-            // Initialize the GPIO pin
-            HAL_GPIO_Init(port, &pins);
+            // Queue the pin configuration; written with the other pins by BootSequencer::commit()
+            BootSequencer::requestPin(port, pins);
         }
 
         /**
@@ -5,6 +5,7 @@
 #include "stm32h7xx_hal_gpio.h"
 #include "stm32h7xx_hal_rcc.h"
 #include "stm32h743xx.h"
+#include "boot_sequencer.hpp"
 
 namespace cadmium
 {
@@ -15,7 +16,7 @@ namespace cadmium
         bool output;  // Current output value (true = HIGH, false = LOW)
         double sigma; // Time until next internal transition (unused here)
 
-        explicit DigitalOutputgoodState() : output(false), sigma(0) {}
+        explicit constexpr DigitalOutputgoodState() : output(false), sigma(0) {}
     };
 
     // Optional: output stream operator for debugging (currently empty)
@@ -43,17 +44,13 @@ namespace cadmium
          * @param selectedPort - GPIO port for output
          * @param selectedPins - GPIO pin configuration
          */
-        DigitalOutputgood(const std::string &id, GPIO_TypeDef *selectedPort, GPIO_InitTypeDef *selectedPins)
+        DigitalOutputgood(const std::string &id, GPIO_TypeDef *selectedPort, const GPIO_InitTypeDef *selectedPins)
             : Atomic<DigitalOutputgoodState>(id, DigitalOutputgoodState()), port(selectedPort), pins(*selectedPins)
         {
             in = addInPort<bool>("in");
 
-            // Enable clocks for GPIO ports (hardcoded for GPIOA and GPIOB)
-            __HAL_RCC_GPIOB_CLK_ENABLE();
-            __HAL_RCC_GPIOA_CLK_ENABLE();
-
-            // Initialize the GPIO pin with HAL library
-            HAL_GPIO_Init(port, &pins);
+            // Queue the pin configuration; written with the other pins by BootSequencer::commit()
+            BootSequencer::requestPin(port, pins);
         }
 
         /**
@@ -20,6 +20,14 @@
 #define FILTERING_MAX_TAP_DELAY	0xFF
 #define FILTERING_MAX_L				3
 #define FILTERING_MAX_M				33
+#define FILTERING_FIR_FFT_MAX_BLOCKSIZE  32
+#define FILTERING_FIR_FFT_NUM_BLOCKS     4
+#define FILTERING_CONVERGE_LENGTH        1536
+#define FILTERING_CONVERGE_NUMTAPS       32
+#define FILTERING_CONVERGE_BLOCKSIZE     32
+#define FILTERING_CONVERGE_STATE_LENGTH                                        \
+   (FILTERING_CONVERGE_NUMTAPS + FILTERING_CONVERGE_BLOCKSIZE                  \
+    + ARM_RLS_FACTOR_LENGTH(FILTERING_CONVERGE_NUMTAPS))
 
 /*--------------------------------------------------------------------------------*/
 /* Declare Variables */
@@ -35,6 +43,7 @@ extern float32_t filtering_pState[LMS_MAX_BLOCKSIZE + FILTERING_MAX_NUMTAPS];
 extern float32_t filtering_scratch[FILTERING_MAX_BLOCKSIZE * 3];
 extern float32_t filtering_scratch2[FILTERING_MAX_BLOCKSIZE * 3];
 extern float32_t filtering_coeffs_lms[FILTERING_MAX_NUMTAPS];
+extern float32_t filtering_fir_fft_state[ARM_FIR_FFT_STATE_LENGTH(FILTERING_MAX_NUMTAPS, FILTERING_FIR_FFT_MAX_BLOCKSIZE)];
 
 extern const float64_t filtering_f64_inputs[FILTERING_MAX_BLOCKSIZE * FILTERING_MAX_M + FILTERING_MAX_NUMTAPS];
 extern const float32_t filtering_f32_inputs[FILTERING_MAX_BLOCKSIZE * FILTERING_MAX_M + FILTERING_MAX_NUMTAPS];
@@ -51,6 +60,13 @@ ARR_DESC_DECLARE(filtering_postshifts);
 ARR_DESC_DECLARE(filtering_numstages);
 ARR_DESC_DECLARE(filtering_Ls);
 ARR_DESC_DECLARE(filtering_Ms);
+ARR_DESC_DECLARE(filtering_fir_fft_blocksizes);
+ARR_DESC_DECLARE(filtering_fir_fft_methods);
+ARR_DESC_DECLARE(filtering_farrow_steps);
+ARR_DESC_DECLARE(filtering_farrow_delays);
+ARR_DESC_DECLARE(filtering_cic_Rs);
+ARR_DESC_DECLARE(filtering_cic_numstages);
+ARR_DESC_DECLARE(filtering_cic_delays);
 
 /* Coefficient Lists */
 extern const float64_t filtering_coeffs_f64[FILTERING_MAX_NUMSTAGES * 6 + 2];
@@ -74,6 +90,12 @@ extern const q7_t *filtering_coeffs_c_q7;
 /* Tap Delay Lists */
 extern const int32_t filtering_tap_delay[FILTERING_MAX_NUMTAPS];
 
+/* Convergence Data */
+extern const float32_t filtering_converge_input_f32[FILTERING_CONVERGE_LENGTH];
+extern const float32_t filtering_converge_fir_f32[FILTERING_CONVERGE_NUMTAPS];
+extern const float32_t filtering_converge_init_f32[FILTERING_CONVERGE_NUMTAPS];
+extern float32_t filtering_converge_state[FILTERING_CONVERGE_STATE_LENGTH];
+
 /* Numbers */
 
 /* Float Inputs */
@@ -6,6 +6,7 @@
 /*--------------------------------------------------------------------------------*/
 
 JTEST_DECLARE_GROUP(biquad_tests);
+JTEST_DECLARE_GROUP(cic_tests);
 JTEST_DECLARE_GROUP(conv_tests);
 JTEST_DECLARE_GROUP(correlate_tests);
 JTEST_DECLARE_GROUP(fir_tests);
@@ -14,6 +14,12 @@
 
 #define TRANSFORM_MAX_FFT_LEN 4096
 #define TRANFORM_BIGGEST_INPUT_TYPE float32_t
+#define TRANSFORM_MAX_MIXED_FFT_LEN 1920
+#define TRANSFORM_GOERTZEL_F32_NUM_BINS 7
+#define TRANSFORM_GOERTZEL_Q31_NUM_BINS 4
+#define TRANSFORM_SDFT_F32_NUM_BINS 5
+#define TRANSFORM_SDFT_Q31_NUM_BINS 3
+#define TRANSFORM_SDFT_WINDOW_LEN 256
 
 /*--------------------------------------------------------------------------------*/
 /* Variable Declarations */
@@ -32,6 +38,14 @@ extern float32_t transform_fft_f32_inputs[TRANSFORM_MAX_FFT_LEN * 2];
 extern q31_t transform_fft_q31_inputs[TRANSFORM_MAX_FFT_LEN * 2];
 extern q15_t * transform_fft_q15_inputs;
 extern q15_t dct4_transform_fft_q15_inputs[TRANSFORM_MAX_FFT_LEN * 2];
+extern float32_t transform_fft_mixed_state[ARM_CFFT_MIXED_STATE_LENGTH(TRANSFORM_MAX_MIXED_FFT_LEN)];
+extern const float32_t transform_goertzel_f32_bins[TRANSFORM_GOERTZEL_F32_NUM_BINS];
+extern const float32_t transform_goertzel_q31_bins[TRANSFORM_GOERTZEL_Q31_NUM_BINS];
+extern const uint16_t transform_sdft_f32_bins[TRANSFORM_SDFT_F32_NUM_BINS];
+extern const uint16_t transform_sdft_q31_bins[TRANSFORM_SDFT_Q31_NUM_BINS];
+extern float32_t transform_goertzel_coeffs[ARM_GOERTZEL_COEFFS_PER_BIN * TRANSFORM_GOERTZEL_F32_NUM_BINS];
+extern float32_t transform_sdft_state[ARM_SDFT_STATE_LENGTH(TRANSFORM_SDFT_F32_NUM_BINS, TRANSFORM_SDFT_WINDOW_LEN)];
+extern uint64_t transform_fft_tables_arena[ARM_CFFT_TABLES_SIZE_F32(TRANSFORM_MAX_FFT_LEN) / 8U];
 
 /* FFT Lengths */
 ARR_DESC_DECLARE(transform_radix2_fftlens);
@@ -39,6 +53,10 @@ ARR_DESC_DECLARE(transform_radix4_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fast_fftlens);
 ARR_DESC_DECLARE(transform_dct_fftlens);
+ARR_DESC_DECLARE(transform_cfft_mixed_fftlens);
+ARR_DESC_DECLARE(transform_rfft_mixed_fftlens);
+ARR_DESC_DECLARE(transform_goertzel_blocksizes);
+ARR_DESC_DECLARE(transform_sdft_blocksizes);
 
 /* CFFT Structs */
 ARR_DESC_DECLARE(transform_cfft_f32_structs);
@@ -7,6 +7,7 @@
 JTEST_DECLARE_GROUP(cfft_tests);
 JTEST_DECLARE_GROUP(cfft_family_tests);
 JTEST_DECLARE_GROUP(dct4_tests);
+JTEST_DECLARE_GROUP(goertzel_tests);
 JTEST_DECLARE_GROUP(rfft_tests);
 JTEST_DECLARE_GROUP(rfft_fast_tests);
 
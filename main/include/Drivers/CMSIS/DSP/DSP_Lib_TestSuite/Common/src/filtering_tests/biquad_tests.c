@@ -113,6 +113,142 @@
    }
 
 
+/* Channels of the multi-channel tests: a group of 4, as many Neon lanes, and 3
+   more, processed one at a time (or by AVX2 together with the first 4 in 8) */
+#define BIQUAD_MC_NUMCHANNELS 7
+
+/* Each channel of the multi-channel output, filtered in two blocks, must be
+   bit-exact with the channel filtered alone in a single block. */
+#define BIQUAD_MC_FILTER_AND_COMPARE(suffix, mc_fn, mc_inst, ref_fn,          \
+                                     ref_inst, ref_init, output_type)         \
+   do                                                                         \
+   {                                                                          \
+      uint32_t blk;                                                           \
+      uint32_t ch;                                                            \
+      uint32_t n;                                                             \
+                                                                              \
+      for (blk = 0; blk < 2; blk++)                                           \
+      {                                                                       \
+         JTEST_COUNT_CYCLES(                                                  \
+               mc_fn(&mc_inst,                                                \
+                     (output_type *) filtering_##suffix##_inputs              \
+                     + blk * blockSize * BIQUAD_MC_NUMCHANNELS,               \
+                     (output_type *) filtering_output_fut                     \
+                     + blk * blockSize * BIQUAD_MC_NUMCHANNELS,               \
+                     blockSize));                                             \
+      }                                                                       \
+                                                                              \
+      for (ch = 0; ch < BIQUAD_MC_NUMCHANNELS; ch++)                          \
+      {                                                                       \
+         for (n = 0; n < 2 * blockSize; n++)                                  \
+         {                                                                    \
+            ((output_type *) filtering_scratch2)[n] =                         \
+               filtering_##suffix##_inputs[n * BIQUAD_MC_NUMCHANNELS          \
+                                                + ch];                        \
+         }                                                                    \
+                                                                              \
+         ref_init;                                                            \
+                                                                              \
+         ref_fn(&ref_inst,                                                    \
+                (void *) filtering_scratch2,                                  \
+                (void *) filtering_output_ref,                                \
+                2 * blockSize);                                               \
+                                                                              \
+         for (n = 0; n < 2 * blockSize; n++)                                  \
+         {                                                                    \
+            TEST_ASSERT_BUFFERS_EQUAL(                                        \
+                  (output_type *) filtering_output_fut                        \
+                  + n * BIQUAD_MC_NUMCHANNELS + ch,                           \
+                  (output_type *) filtering_output_ref + n,                   \
+                  sizeof(output_type));                                       \
+         }                                                                    \
+      }                                                                       \
+   } while (0)
+
+#define BIQUAD_MC_DEFINE_TEST(suffix, config_suffix, mc_instance_name,         \
+                              ref_instance_name, ref_fn, output_type)          \
+   JTEST_DEFINE_TEST(arm_biquad_cascade_mc_##config_suffix##_##suffix##_test, \
+         arm_biquad_cascade_mc_##config_suffix##_##suffix)                     \
+   {                                                                           \
+      mc_instance_name biquad_inst_fut = { 0 };                                \
+      ref_instance_name biquad_inst_ref = { 0 };                               \
+                                                                               \
+      TEMPLATE_DO_ARR_DESC(                                                    \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes           \
+            ,                                                                  \
+         TEMPLATE_DO_ARR_DESC(                                                 \
+               numstages_idx, uint16_t, numStages, filtering_numstages         \
+               ,                                                               \
+               /* Display test parameter values */                             \
+               JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                               "Number of Stages: %d\n"                        \
+                               "Number of Channels: %d\n",                     \
+                               (int)blockSize,                                 \
+                               (int)numStages,                                 \
+                               (int)BIQUAD_MC_NUMCHANNELS);                    \
+                                                                               \
+               arm_biquad_cascade_mc_##config_suffix##_init_##suffix(          \
+                     &biquad_inst_fut, numStages, BIQUAD_MC_NUMCHANNELS,       \
+                     (output_type*)filtering_coeffs_b_##suffix,                \
+                     (void *) filtering_pState);                               \
+                                                                               \
+               BIQUAD_MC_FILTER_AND_COMPARE(                                   \
+                     suffix,                                                   \
+                     arm_biquad_cascade_mc_##config_suffix##_##suffix,         \
+                     biquad_inst_fut, ref_fn, biquad_inst_ref,                 \
+                     arm_biquad_cascade_##config_suffix##_init_##suffix(       \
+                           &biquad_inst_ref, numStages,                        \
+                           (output_type*)filtering_coeffs_b_##suffix,          \
+                           (void *) filtering_scratch),                        \
+                     output_type)));                                           \
+                                                                               \
+            return JTEST_TEST_PASSED;                                          \
+   }
+
+JTEST_DEFINE_TEST(arm_biquad_cascade_mc_df1_q31_test,
+      arm_biquad_cascade_mc_df1_q31)
+{
+   arm_biquad_casd_mc_df1_inst_q31 biquad_inst_fut = { 0 };
+   arm_biquad_casd_df1_inst_q31 biquad_inst_ref = { 0 };
+
+   TEMPLATE_DO_ARR_DESC(
+         blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+         ,
+      TEMPLATE_DO_ARR_DESC(
+            numstages_idx, uint16_t, numStages, filtering_numstages
+            ,
+         TEMPLATE_DO_ARR_DESC(
+               postshifts_idx, uint8_t, postShift, filtering_postshifts
+               ,
+               /* Display test parameter values */
+               JTEST_DUMP_STRF("Block Size: %d\n"
+                               "Number of Stages: %d\n"
+                               "Post Shift: %d\n"
+                               "Number of Channels: %d\n",
+                               (int)blockSize,
+                               (int)numStages,
+                               (int)postShift,
+                               (int)BIQUAD_MC_NUMCHANNELS);
+
+               arm_biquad_cascade_mc_df1_init_q31(
+                     &biquad_inst_fut, numStages, BIQUAD_MC_NUMCHANNELS,
+                     (q31_t*)filtering_coeffs_b_q31,
+                     (void *) filtering_pState, postShift);
+
+               BIQUAD_MC_FILTER_AND_COMPARE(
+                     q31, arm_biquad_cascade_mc_df1_q31,
+                     biquad_inst_fut,
+                     ref_biquad_cascade_df1_q31, biquad_inst_ref,
+                     arm_biquad_cascade_df1_init_q31(
+                           &biquad_inst_ref, numStages,
+                           (q31_t*)filtering_coeffs_b_q31,
+                           (void *) filtering_scratch, postShift),
+                     q31_t))));
+
+         return JTEST_TEST_PASSED;
+}
+
+
 JTEST_DEFINE_TEST(arm_biquad_cas_df1_32x64_q31_test,
       arm_biquad_cas_df1_32x64_q31)
 {
@@ -222,6 +358,8 @@ BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,,q31_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,,q15_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,_fast,q31_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,_fast,q15_t);
+BIQUAD_MC_DEFINE_TEST(f32,df1,arm_biquad_casd_mc_df1_inst_f32,arm_biquad_casd_df1_inst_f32,ref_biquad_cascade_df1_f32,float32_t);
+BIQUAD_MC_DEFINE_TEST(f32,df2T,arm_biquad_cascade_mc_df2T_instance_f32,arm_biquad_cascade_df2T_instance_f32,arm_biquad_cascade_df2T_f32,float32_t);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -241,4 +379,7 @@ JTEST_DEFINE_GROUP(biquad_tests)
    JTEST_TEST_CALL(arm_biquad_cascade_df1_fast_q31_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_fast_q15_test);
    JTEST_TEST_CALL(arm_biquad_cas_df1_32x64_q31_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_mc_df1_f32_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_mc_df2T_f32_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_mc_df1_q31_test);
 }
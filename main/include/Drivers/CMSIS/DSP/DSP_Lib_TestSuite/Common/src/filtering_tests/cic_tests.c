@@ -0,0 +1,138 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*
+  One call of the function under test on chunk input samples from processed,
+  counting the output samples.
+*/
+#define CIC_PROCESS_decimate(suffix, output_type)                             \
+   numOutputs += arm_cic_decimate_##suffix(                                   \
+         &cic_inst,                                                           \
+         (output_type *) filtering_##suffix##_inputs + processed,             \
+         (output_type *) filtering_output_fut + numOutputs,                   \
+         chunk)
+
+#define CIC_PROCESS_interpolate(suffix, output_type)                          \
+   arm_cic_interpolate_##suffix(                                              \
+         &cic_inst,                                                           \
+         (output_type *) filtering_##suffix##_inputs + processed,             \
+         (output_type *) filtering_output_fut + numOutputs,                   \
+         chunk);                                                              \
+   numOutputs += chunk * R
+
+/*
+  CIC filter test template: the input is fed in chunks of 1, 3, 7, ... samples
+  and the outputs must be bit-exact with the equivalent FIR filter of
+  ref_cic_xxx, from a zero state. The configurations whose gain exceeds
+  max_gain must be rejected by the initialization. Arguments are: decimate or
+  interpolate, function suffix, output type, largest gain, divisor of
+  (R*D)^N giving the gain, and numbers of input and output samples.
+*/
+#define CIC_DEFINE_TEST(kind, suffix, output_type, max_gain,                  \
+                        gain_divisor, num_inputs, num_outputs)                \
+   JTEST_DEFINE_TEST(arm_cic_##kind##_##suffix##_test,                        \
+         arm_cic_##kind##_##suffix)                                           \
+   {                                                                          \
+      arm_cic_##kind##_instance_##suffix cic_inst = { 0 };                    \
+      arm_status status;                                                      \
+      float64_t gain;                                                         \
+      uint32_t numInputs;                                                     \
+      uint32_t numOutputs;                                                    \
+      uint32_t processed;                                                     \
+      uint32_t chunk;                                                         \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            R_idx, uint16_t, R, filtering_cic_Rs                              \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               stages_idx, uint8_t, numStages, filtering_cic_numstages        \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  delay_idx, uint8_t, diffDelay, filtering_cic_delays         \
+                  ,                                                           \
+                  /* Display test parameter values */                         \
+                  JTEST_DUMP_STRF("Rate change factor: %d\n"                  \
+                                  "Number of stages: %d\n"                    \
+                                  "Differential delay: %d\n",                 \
+                                  (int)R,                                     \
+                                  (int)numStages,                             \
+                                  (int)diffDelay);                            \
+                                                                              \
+                  status = arm_cic_##kind##_init_##suffix(                    \
+                        &cic_inst, numStages, R, diffDelay,                   \
+                        (void *) filtering_pState);                           \
+                                                                              \
+                  gain = pow((float64_t) R * diffDelay, numStages)            \
+                     / (gain_divisor);                                        \
+                  TEST_ASSERT_EQUAL(                                          \
+                        status,                                               \
+                        (gain > (max_gain)) ? ARM_MATH_ARGUMENT_ERROR         \
+                                            : ARM_MATH_SUCCESS);              \
+                                                                              \
+                  if (status == ARM_MATH_SUCCESS)                             \
+                  {                                                           \
+                     numInputs = (num_inputs);                                \
+                     numOutputs = 0;                                          \
+                     processed = 0;                                           \
+                     chunk = 1;                                               \
+                                                                              \
+                     while (processed < numInputs)                            \
+                     {                                                        \
+                        if (chunk > numInputs - processed)                    \
+                        {                                                     \
+                           chunk = numInputs - processed;                     \
+                        }                                                     \
+                                                                              \
+                        JTEST_COUNT_CYCLES(                                   \
+                              CIC_PROCESS_##kind(suffix, output_type));       \
+                                                                              \
+                        processed += chunk;                                   \
+                        chunk = 2 * chunk + 1;                                \
+                     }                                                        \
+                                                                              \
+                     ref_cic_##kind##_##suffix(                               \
+                           &cic_inst,                                         \
+                           (void *) filtering_##suffix##_inputs,              \
+                           (void *) filtering_output_ref,                     \
+                           numInputs);                                        \
+                                                                              \
+                     TEST_ASSERT_EQUAL(numOutputs, (num_outputs));            \
+                                                                              \
+                     TEST_ASSERT_BUFFERS_EQUAL(                               \
+                           filtering_output_fut,                              \
+                           filtering_output_ref,                              \
+                           numOutputs * sizeof(output_type));                 \
+                  })));                                                       \
+                                                                              \
+      return JTEST_TEST_PASSED;                                               \
+   }
+
+CIC_DEFINE_TEST(decimate, q31, q31_t, 4294967296.0, 1,
+                LMS_MAX_BLOCKSIZE * 2, numInputs / R);
+CIC_DEFINE_TEST(decimate, q15, q15_t, 65536.0, 1,
+                LMS_MAX_BLOCKSIZE * 2, numInputs / R);
+CIC_DEFINE_TEST(interpolate, q31, q31_t, 4294967296.0, R,
+                LMS_MAX_BLOCKSIZE * 2 / R, numInputs * R);
+CIC_DEFINE_TEST(interpolate, q15, q15_t, 65536.0, R,
+                LMS_MAX_BLOCKSIZE * 2 / R, numInputs * R);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cic_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_cic_decimate_q31_test);
+    JTEST_TEST_CALL(arm_cic_decimate_q15_test);
+    JTEST_TEST_CALL(arm_cic_interpolate_q31_test);
+    JTEST_TEST_CALL(arm_cic_interpolate_q15_test);
+}
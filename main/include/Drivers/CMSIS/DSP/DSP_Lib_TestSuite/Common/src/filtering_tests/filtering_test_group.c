@@ -7,6 +7,7 @@ JTEST_DEFINE_GROUP(filtering_tests)
     To skip a test, comment it out.
   */
   JTEST_GROUP_CALL(biquad_tests);
+  JTEST_GROUP_CALL(cic_tests);
   JTEST_GROUP_CALL(conv_tests);
   JTEST_GROUP_CALL(correlate_tests);
   JTEST_GROUP_CALL(fir_tests);
@@ -57,6 +57,79 @@
             return JTEST_TEST_PASSED;                                   \
    }
 
+#define FIR_FFT_DEFINE_TEST(suffix, output_type)                        \
+   JTEST_DEFINE_TEST(arm_fir_fft_##suffix##_test,                       \
+         arm_fir_fft_##suffix)                                          \
+   {                                                                    \
+      arm_fir_fft_instance_##suffix fir_inst_fut = { 0 };               \
+      arm_fir_instance_##suffix fir_inst_ref = { 0 };                   \
+      uint32_t block_idx;                                               \
+                                                                        \
+      TEMPLATE_DO_ARR_DESC(                                             \
+            blocksize_idx, uint32_t, blockSize,                         \
+            filtering_fir_fft_blocksizes                                \
+            ,                                                           \
+         TEMPLATE_DO_ARR_DESC(                                          \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps        \
+               ,                                                        \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                  method_idx, uint8_t, method,                          \
+                  filtering_fir_fft_methods                             \
+                  ,                                                     \
+                  /* Display test parameter values */                   \
+                  JTEST_DUMP_STRF("Block Size: %d\n"                    \
+                                  "Number of Taps: %d\n"                \
+                                  "Method: %d\n",                       \
+                                  (int)blockSize,                       \
+                                  (int)numTaps,                         \
+                                  (int)method);                         \
+                                                                        \
+                  /* Initialize the FIR Instances */                    \
+                  if (arm_fir_fft_init_##suffix(                        \
+                         &fir_inst_fut, numTaps,                        \
+                         (output_type*)filtering_coeffs_##suffix,       \
+                         (void *) filtering_fir_fft_state,              \
+                         blockSize,                                     \
+                         (arm_fir_fft_method)method)                    \
+                      != ARM_MATH_SUCCESS)                              \
+                  {                                                     \
+                     return JTEST_TEST_FAILED;                          \
+                  }                                                     \
+                                                                        \
+                  /* Several blocks, to go through the partitions */    \
+                  for (block_idx = 0;                                   \
+                       block_idx < FILTERING_FIR_FFT_NUM_BLOCKS;        \
+                       block_idx++)                                     \
+                  {                                                     \
+                     JTEST_COUNT_CYCLES(                                \
+                           arm_fir_fft_##suffix(                        \
+                                 &fir_inst_fut,                         \
+                                 (output_type *)                        \
+                                 filtering_##suffix##_inputs            \
+                                 + block_idx * blockSize,               \
+                                 (output_type *) filtering_output_fut   \
+                                 + block_idx * blockSize));             \
+                  }                                                     \
+                                                                        \
+                  arm_fir_init_##suffix(                                \
+                        &fir_inst_ref, numTaps,                         \
+                        (output_type*)filtering_coeffs_##suffix,        \
+                        (void *) filtering_pState,                      \
+                        blockSize * FILTERING_FIR_FFT_NUM_BLOCKS);      \
+                                                                        \
+                  ref_fir_##suffix(                                     \
+                        &fir_inst_ref,                                  \
+                        (void *) filtering_##suffix##_inputs,           \
+                        (void *) filtering_output_ref,                  \
+                        blockSize * FILTERING_FIR_FFT_NUM_BLOCKS);      \
+                                                                        \
+                  FILTERING_SNR_COMPARE_INTERFACE(                      \
+                        blockSize * FILTERING_FIR_FFT_NUM_BLOCKS,       \
+                        output_type))));                                \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+   }
+
 #define FIR_INTERPOLATE_DEFINE_TEST(suffix, output_type)                      \
    JTEST_DEFINE_TEST(arm_fir_interpolate_##suffix##_test,                     \
          arm_fir_interpolate_##suffix)                                        \
@@ -112,6 +185,156 @@
             return JTEST_TEST_PASSED;                                         \
    }
 
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, output_type)                         \
+   JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                        \
+         arm_fir_resample_##suffix)                                           \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+      arm_fir_interpolate_instance_##suffix fir_inst_ref = { 0 };             \
+      uint32_t numOutputs;                                                    \
+      uint32_t m;                                                             \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  L_idx, uint8_t, L, filtering_Ls                             \
+                  ,                                                           \
+               TEMPLATE_DO_ARR_DESC(                                          \
+                     M_idx, uint8_t, M, filtering_Ms                          \
+                     ,                                                        \
+                     /* Display test parameter values */                      \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                                     "Number of Taps: %d\n"                   \
+                                     "Upsample factor: %d\n"                  \
+                                     "Downsample factor: %d\n",               \
+                                     (int)blockSize,                          \
+                                     (int)numTaps,                            \
+                                     (int)L,                                  \
+                                     (int)M);                                 \
+                                                                              \
+                     /* Initialize the FIR Instances */                       \
+                     arm_fir_resample_init_##suffix(                          \
+                           &fir_inst_fut, L, M, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState);                        \
+                                                                              \
+                     /* The first sample alone, then the rest of the block */ \
+                     JTEST_COUNT_CYCLES(                                      \
+                           numOutputs = arm_fir_resample_##suffix(            \
+                                 &fir_inst_fut,                               \
+                                 (void *) filtering_##suffix##_inputs,        \
+                                 (void *) filtering_output_fut,               \
+                                 1);                                          \
+                           numOutputs += arm_fir_resample_##suffix(           \
+                                 &fir_inst_fut,                               \
+                                 (output_type *)                              \
+                                 filtering_##suffix##_inputs + 1,             \
+                                 (output_type *)                              \
+                                 filtering_output_fut + numOutputs,           \
+                                 blockSize - 1));                             \
+                                                                              \
+                     TEST_ASSERT_EQUAL(                                       \
+                           numOutputs,                                        \
+                           ((uint32_t)blockSize * L + M - 1) / M);            \
+                                                                              \
+                     /* Every M-th sample of the interpolator */              \
+                     arm_fir_interpolate_init_##suffix(                       \
+                           &fir_inst_ref, L, numTaps,                         \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, blockSize);             \
+                                                                              \
+                     ref_fir_interpolate_##suffix(                            \
+                           &fir_inst_ref,                                     \
+                           (void *) filtering_##suffix##_inputs,              \
+                           (void *) filtering_output_ref,                     \
+                           blockSize);                                        \
+                                                                              \
+                     for (m = 0; m < numOutputs; m++)                         \
+                     {                                                        \
+                        ((output_type *) filtering_output_ref)[m] =           \
+                           ((output_type *) filtering_output_ref)[m * M];     \
+                     }                                                        \
+                                                                              \
+                     FILTERING_SNR_COMPARE_INTERFACE(                         \
+                           numOutputs,                                        \
+                           output_type)))));                                  \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+JTEST_DEFINE_TEST(arm_farrow_f32_test,
+      arm_farrow_f32)
+{
+   arm_farrow_instance_f32 farrow_inst_fut = { 0 };
+   uint32_t numFirst;
+   uint32_t numOutputs;
+   uint32_t n;
+
+   TEMPLATE_DO_ARR_DESC(
+         blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+         ,
+      TEMPLATE_DO_ARR_DESC(
+            step_idx, float32_t, step, filtering_farrow_steps
+            ,
+         TEMPLATE_DO_ARR_DESC(
+               delay_idx, float32_t, delay, filtering_farrow_delays
+               ,
+               /* Display test parameter values */
+               JTEST_DUMP_STRF("Block Size: %d\n"
+                               "Step: %d/10\n"
+                               "Delay: %d/10\n",
+                               (int)blockSize,
+                               (int)(step * 10.0f),
+                               (int)(delay * 10.0f));
+
+               /* A sinusoid at 1% of the sample rate, where the cubic
+                  interpolation is exact to the float32_t precision */
+               for (n = 0; n < blockSize + 3; n++)
+               {
+                  filtering_scratch[n] =
+                     (float32_t) sin(0.06283185307179586 * (float64_t) n);
+               }
+
+               arm_farrow_init_f32(&farrow_inst_fut, step, delay);
+
+               /* The output samples of the first 3 input samples depend
+                  on the cleared state */
+               numFirst = arm_farrow_f32(
+                     &farrow_inst_fut,
+                     filtering_scratch,
+                     filtering_output_fut,
+                     3);
+
+               JTEST_COUNT_CYCLES(
+                     numOutputs = arm_farrow_f32(
+                           &farrow_inst_fut,
+                           filtering_scratch + 3,
+                           filtering_output_fut + numFirst,
+                           blockSize));
+
+               /* Output sample k is the input at k*step - 1 - delay */
+               for (n = numFirst; n < numFirst + numOutputs; n++)
+               {
+                  filtering_output_ref[n] =
+                     (float32_t) sin(0.06283185307179586
+                                     * ((float64_t) n * step - 1.0 - delay));
+               }
+
+               if (numOutputs > 0)
+               {
+                  FILTERING_SNR_COMPARE_INTERFACE_OFFSET(
+                        numFirst,
+                        numOutputs,
+                        float32_t);
+               })));
+
+         return JTEST_TEST_PASSED;
+}
+
 #define FIR_DECIMATE_DEFINE_TEST(suffix, config_suffix, output_type)       \
    JTEST_DEFINE_TEST(arm_fir_decimate##config_suffix##_##suffix##_test,    \
          arm_fir_decimate##config_suffix##_##suffix)                       \
@@ -346,6 +569,8 @@ FIR_DEFINE_TEST(q31,_fast,q31_t);
 FIR_DEFINE_TEST(q15,_fast,q15_t);
 FIR_DEFINE_TEST(q7,,q7_t);
 
+FIR_FFT_DEFINE_TEST(f32,float32_t);
+
 FIR_LATTICE_DEFINE_TEST(f32,float32_t);
 FIR_LATTICE_DEFINE_TEST(q31,q31_t);
 FIR_LATTICE_DEFINE_TEST(q15,q15_t);
@@ -364,6 +589,9 @@ FIR_SPARSE_DEFINE_TEST(f32,float32_t);
 FIR_SPARSE_DEFINE_TEST(q31,q31_t);
 FIR_SPARSE2_DEFINE_TEST(q15,q15_t);
 FIR_SPARSE2_DEFINE_TEST(q7,q7_t);
+FIR_RESAMPLE_DEFINE_TEST(f32,float32_t);
+FIR_RESAMPLE_DEFINE_TEST(q31,q31_t);
+FIR_RESAMPLE_DEFINE_TEST(q15,q15_t);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -381,6 +609,8 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_fast_q31_test);
    JTEST_TEST_CALL(arm_fir_fast_q15_test);
 
+   JTEST_TEST_CALL(arm_fir_fft_f32_test);
+
    JTEST_TEST_CALL(arm_fir_lattice_f32_test);
    JTEST_TEST_CALL(arm_fir_lattice_q31_test);
    JTEST_TEST_CALL(arm_fir_lattice_q15_test);
@@ -395,6 +625,11 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_decimate_fast_q31_test);
    JTEST_TEST_CALL(arm_fir_decimate_fast_q15_test);
 
+   JTEST_TEST_CALL(arm_fir_resample_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_q31_test);
+   JTEST_TEST_CALL(arm_fir_resample_q15_test);
+   JTEST_TEST_CALL(arm_farrow_f32_test);
+
    JTEST_TEST_CALL(arm_fir_sparse_f32_test);
    JTEST_TEST_CALL(arm_fir_sparse_q31_test);
    JTEST_TEST_CALL(arm_fir_sparse_q15_test);
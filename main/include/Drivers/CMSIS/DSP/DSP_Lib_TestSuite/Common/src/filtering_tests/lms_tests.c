@@ -200,6 +200,114 @@ LMS_DEFINE_TEST(f32,_norm,float32_t, mu2_f32);
 LMS_WITH_POSTSHIFT_DEFINE_TEST(q31,_norm,q31_t);
 LMS_WITH_POSTSHIFT_DEFINE_TEST(q15,_norm,q15_t);
 
+/*
+  Convergence test template, with the setup of arm_signal_converge_example:
+  the adaptive filter identifies the 32-tap low-pass FIR filter of the example
+  from its randn() input, in blocks of 32 samples, starting from the high-pass
+  filter of the example. After the 1536 samples, the SNR of the coefficients
+  against the FIR filter and of the last output block against the reference
+  must exceed snr_db. The cycles of the last block are dumped. Arguments are:
+  function under test, instance type, and the initialization and processing
+  statements, on lms_inst and on the blocks in, ref, out and err.
+*/
+#define LMS_CONVERGE_DEFINE_TEST(fn_name, instance_type, init, process, snr_db) \
+   JTEST_DEFINE_TEST(fn_name##_converge_test,                                  \
+         fn_name)                                                              \
+   {                                                                           \
+      instance_type lms_inst = { 0 };                                          \
+      arm_fir_instance_f32 fir_inst = { 0 };                                   \
+      const float32_t *in;                                                     \
+      float32_t *ref = filtering_output_ref;                                   \
+      float32_t *out = filtering_output_fut;                                   \
+      float32_t *err = filtering_output_fut + FILTERING_CONVERGE_BLOCKSIZE;    \
+      uint32_t numFrames =                                                     \
+            FILTERING_CONVERGE_LENGTH / FILTERING_CONVERGE_BLOCKSIZE;          \
+      uint32_t frame;                                                          \
+                                                                               \
+      memcpy(filtering_coeffs_lms, filtering_converge_init_f32,                \
+             FILTERING_CONVERGE_NUMTAPS * sizeof(float32_t));                  \
+                                                                               \
+      arm_fir_init_f32(                                                        \
+            &fir_inst, FILTERING_CONVERGE_NUMTAPS,                             \
+            (float32_t *) filtering_converge_fir_f32,                          \
+            (void *) filtering_pState, FILTERING_CONVERGE_BLOCKSIZE);          \
+                                                                               \
+      init;                                                                    \
+                                                                               \
+      JTEST_DUMP_STRF("Block Size: %d\n"                                       \
+                      "Number of Taps: %d\n",                                  \
+                      (int)FILTERING_CONVERGE_BLOCKSIZE,                       \
+                      (int)FILTERING_CONVERGE_NUMTAPS);                        \
+                                                                               \
+      for (frame = 0; frame < numFrames; frame++)                              \
+      {                                                                        \
+         in = filtering_converge_input_f32                                     \
+            + frame * FILTERING_CONVERGE_BLOCKSIZE;                            \
+                                                                               \
+         arm_fir_f32(&fir_inst, in, ref, FILTERING_CONVERGE_BLOCKSIZE);        \
+                                                                               \
+         if (frame + 1 == numFrames)                                           \
+         {                                                                     \
+            JTEST_COUNT_CYCLES(process);                                       \
+         }                                                                     \
+         else                                                                  \
+         {                                                                     \
+            process;                                                           \
+         }                                                                     \
+      }                                                                        \
+                                                                               \
+      TEST_ASSERT_SNR((float32_t *) filtering_converge_fir_f32,                \
+                      filtering_coeffs_lms,                                    \
+                      FILTERING_CONVERGE_NUMTAPS,                              \
+                      snr_db);                                                 \
+                                                                               \
+      TEST_ASSERT_SNR(ref, out, FILTERING_CONVERGE_BLOCKSIZE, snr_db);         \
+                                                                               \
+      return JTEST_TEST_PASSED;                                                \
+   }
+
+LMS_CONVERGE_DEFINE_TEST(
+      arm_lms_norm_f32, arm_lms_norm_instance_f32,
+      arm_lms_norm_init_f32(
+            &lms_inst, FILTERING_CONVERGE_NUMTAPS, filtering_coeffs_lms,
+            filtering_converge_state, 0.5f, FILTERING_CONVERGE_BLOCKSIZE),
+      arm_lms_norm_f32(
+            &lms_inst, in, ref, out, err, FILTERING_CONVERGE_BLOCKSIZE),
+      80.0f);
+
+LMS_CONVERGE_DEFINE_TEST(
+      arm_lms_block_f32, arm_lms_block_instance_f32,
+      arm_lms_block_init_f32(
+            &lms_inst, FILTERING_CONVERGE_NUMTAPS, filtering_coeffs_lms,
+            filtering_converge_state, 0.01f, FILTERING_CONVERGE_BLOCKSIZE),
+      arm_lms_block_f32(
+            &lms_inst, in, ref, out, err, FILTERING_CONVERGE_BLOCKSIZE),
+      80.0f);
+
+LMS_CONVERGE_DEFINE_TEST(
+      arm_lms_fd_f32, arm_lms_fd_instance_f32,
+      TEST_ASSERT_EQUAL(
+            arm_lms_fd_init_f32(
+                  &lms_inst, FILTERING_CONVERGE_NUMTAPS, filtering_coeffs_lms,
+                  filtering_converge_state, 0.5f, 0.9f),
+            ARM_MATH_SUCCESS),
+      arm_lms_fd_f32(&lms_inst, in, ref, out, err),
+      80.0f);
+
+LMS_CONVERGE_DEFINE_TEST(
+      arm_rls_f32, arm_rls_instance_f32,
+      TEST_ASSERT_EQUAL(
+            arm_rls_init_f32(
+                  &lms_inst, FILTERING_CONVERGE_NUMTAPS, filtering_coeffs_lms,
+                  filtering_converge_state,
+                  filtering_converge_state + FILTERING_CONVERGE_NUMTAPS
+                  + FILTERING_CONVERGE_BLOCKSIZE,
+                  1.0f, 0.01f, FILTERING_CONVERGE_BLOCKSIZE),
+            ARM_MATH_SUCCESS),
+      arm_rls_f32(
+            &lms_inst, in, ref, out, err, FILTERING_CONVERGE_BLOCKSIZE),
+      80.0f);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -216,4 +324,9 @@ JTEST_DEFINE_GROUP(lms_tests)
    JTEST_TEST_CALL(arm_lms_norm_f32_test);
    JTEST_TEST_CALL(arm_lms_norm_q31_test);
    JTEST_TEST_CALL(arm_lms_norm_q15_test);
+
+   JTEST_TEST_CALL(arm_lms_norm_f32_converge_test);
+   JTEST_TEST_CALL(arm_lms_block_f32_converge_test);
+   JTEST_TEST_CALL(arm_lms_fd_f32_converge_test);
+   JTEST_TEST_CALL(arm_rls_f32_converge_test);
 }
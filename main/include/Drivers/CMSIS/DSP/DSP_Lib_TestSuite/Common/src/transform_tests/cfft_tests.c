@@ -96,6 +96,104 @@
     } while (0)
 
 
+/*
+  Mixed-radix CFFT test template, against a direct DFT. Argument is the
+  inverse-transform flag.
+*/
+#define CFFT_MIXED_TEST_BODY(ifft_flag)                                                 \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_mixed_instance_f32 cfft_inst = {0};                                    \
+                                                                                        \
+        /* Go through all mixed-radix lengths */                                        \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            fftlen_idx, uint16_t, fftlen, transform_cfft_mixed_fftlens                  \
+            ,                                                                           \
+                                                                                        \
+            arm_cfft_mixed_init_f32(&cfft_inst, fftlen, transform_fft_mixed_state);     \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_f32_inputs,                                               \
+                fftlen *                                                                \
+                sizeof(float32_t) *                                                     \
+                2 /*complex_inputs*/);                                                  \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)fftlen,                                                \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_mixed_f32(&cfft_inst,                                          \
+                                   (void *) transform_fft_inplace_input_fut,            \
+                                   ifft_flag));                                         \
+            ref_cfft_mixed_f32(&cfft_inst,                                              \
+                               (void *) transform_fft_inplace_input_ref,                \
+                               ifft_flag);                                              \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                                      \
+                fftlen,                                                                 \
+                float32_t));                                                            \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
+/*
+  CFFT test template with the tables generated at initialization: each constant
+  instance is rebuilt in the arena. Argument is the inverse-transform flag.
+*/
+#define CFFT_TABLES_TEST_BODY(ifft_flag)                                                \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_instance_f32 cfft_inst = {0};                                          \
+        arm_fft_table_arena arena;                                                      \
+                                                                                        \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_f32 *, cfft_inst_ptr,                \
+            transform_cfft_f32_structs                                                  \
+            ,                                                                           \
+                                                                                        \
+            arm_fft_table_arena_init(&arena, transform_fft_tables_arena,                \
+                                     sizeof(transform_fft_tables_arena));               \
+            arm_cfft_tables_init_f32(&cfft_inst, cfft_inst_ptr->fftLen, &arena);        \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_f32_inputs,                                               \
+                cfft_inst_ptr->fftLen *                                                 \
+                sizeof(float32_t) *                                                     \
+                2 /*complex_inputs*/);                                                  \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)cfft_inst_ptr->fftLen,                                 \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_f32(&cfft_inst,                                                \
+                             (void *) transform_fft_inplace_input_fut,                  \
+                             ifft_flag,              /* IFFT Flag */                    \
+                             1));            /* Bitreverse flag */                      \
+            ref_cfft_f32(cfft_inst_ptr,                                                 \
+                         (void *) transform_fft_inplace_input_ref,                      \
+                         ifft_flag,         /* IFFT Flag */                             \
+                         1);        /* Bitreverse flag */                               \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                                      \
+                cfft_inst_ptr->fftLen,                                                  \
+                float32_t));                                                            \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
 /* Test declarations */
 JTEST_DEFINE_TEST(cfft_f32_test, cfft_f32)
 {
@@ -107,6 +205,26 @@ JTEST_DEFINE_TEST(cfft_f32_ifft_test, cfft_f32)
     CFFT_TEST_BODY((uint8_t) 1, f32, float32_t);
 }
 
+JTEST_DEFINE_TEST(cfft_tables_f32_test, cfft_f32)
+{
+    CFFT_TABLES_TEST_BODY((uint8_t) 0);
+}
+
+JTEST_DEFINE_TEST(cfft_tables_f32_ifft_test, cfft_f32)
+{
+    CFFT_TABLES_TEST_BODY((uint8_t) 1);
+}
+
+JTEST_DEFINE_TEST(cfft_mixed_f32_test, cfft_mixed_f32)
+{
+    CFFT_MIXED_TEST_BODY((uint8_t) 0);
+}
+
+JTEST_DEFINE_TEST(cfft_mixed_f32_ifft_test, cfft_mixed_f32)
+{
+    CFFT_MIXED_TEST_BODY((uint8_t) 1);
+}
+
 JTEST_DEFINE_TEST(cfft_q31_test, cfft_q31)
 {
     CFFT_TEST_BODY((uint8_t) 0, q31, q31_t);
@@ -136,6 +254,12 @@ JTEST_DEFINE_GROUP(cfft_tests)
     JTEST_TEST_CALL(cfft_f32_test);
     JTEST_TEST_CALL(cfft_f32_ifft_test);
 
+    JTEST_TEST_CALL(cfft_tables_f32_test);
+    JTEST_TEST_CALL(cfft_tables_f32_ifft_test);
+
+    JTEST_TEST_CALL(cfft_mixed_f32_test);
+    JTEST_TEST_CALL(cfft_mixed_f32_ifft_test);
+
     JTEST_TEST_CALL(cfft_q31_test);
     JTEST_TEST_CALL(cfft_q31_ifft_test);
 
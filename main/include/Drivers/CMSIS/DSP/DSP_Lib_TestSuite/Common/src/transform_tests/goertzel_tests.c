@@ -0,0 +1,139 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/*
+  Goertzel filter bank test template, against a direct DTFT at the bin
+  frequencies. Arguments are: function suffix (f32/q31) in lower and upper
+  case, output type and the reference arguments following the bins (none for
+  f32, the shift for q31).
+*/
+#define GOERTZEL_DEFINE_TEST(suffix, SUFFIX, output_type, ...)          \
+    JTEST_DEFINE_TEST(arm_goertzel_##suffix##_test,                     \
+                      arm_goertzel_##suffix)                            \
+    {                                                                   \
+        arm_goertzel_instance_##suffix goertzel_inst;                   \
+        uint16_t num_bins = TRANSFORM_GOERTZEL_##SUFFIX##_NUM_BINS;     \
+                                                                        \
+        /* Go through all block sizes */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            blocksize_idx, uint16_t, blocksize,                         \
+            transform_goertzel_blocksizes                               \
+            ,                                                           \
+                                                                        \
+            arm_goertzel_init_##suffix(                                 \
+                &goertzel_inst, num_bins,                               \
+                transform_goertzel_##suffix##_bins,                     \
+                (output_type *) transform_goertzel_coeffs, blocksize);  \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Number of bins: %d\n",                     \
+                            (int)blocksize,                             \
+                            (int)num_bins);                             \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_goertzel_##suffix(                                  \
+                    &goertzel_inst,                                     \
+                    transform_fft_##suffix##_inputs,                    \
+                    (void *) transform_fft_output_fut));                \
+                                                                        \
+            ref_dft_bins_##suffix(                                      \
+                transform_fft_##suffix##_inputs, blocksize,             \
+                transform_goertzel_##suffix##_bins, num_bins,           \
+                __VA_ARGS__ (void *) transform_fft_output_ref);         \
+                                                                        \
+            /* Test correctness */                                      \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                      \
+                num_bins,                                               \
+                output_type));                                          \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*
+  Sliding DFT test template: the input is fed in blocks shorter and longer than
+  the window, and the bins are compared with a direct DFT of the last window
+  once it is full. Arguments are: function suffix (f32/q31) in lower and
+  upper case, output type, the damping factor, and the reference arguments
+  following the bins (none for f32, the shift for q31).
+*/
+#define SDFT_DEFINE_TEST(suffix, SUFFIX, output_type, damping, ...)     \
+    JTEST_DEFINE_TEST(arm_sdft_##suffix##_test,                         \
+                      arm_sdft_##suffix)                                \
+    {                                                                   \
+        arm_sdft_instance_##suffix sdft_inst;                           \
+        uint16_t num_bins = TRANSFORM_SDFT_##SUFFIX##_NUM_BINS;         \
+        uint16_t window_len = TRANSFORM_SDFT_WINDOW_LEN;                \
+        float32_t bins[TRANSFORM_SDFT_##SUFFIX##_NUM_BINS];             \
+        uint32_t processed = 0;                                         \
+        uint32_t bin_idx;                                               \
+                                                                        \
+        for (bin_idx = 0; bin_idx < num_bins; bin_idx++)                \
+        {                                                               \
+            bins[bin_idx] = transform_sdft_##suffix##_bins[bin_idx];    \
+        }                                                               \
+                                                                        \
+        arm_sdft_init_##suffix(                                         \
+            &sdft_inst, num_bins, transform_sdft_##suffix##_bins,       \
+            damping, (output_type *) transform_goertzel_coeffs,         \
+            (output_type *) transform_sdft_state, window_len);          \
+                                                                        \
+        /* Go through all blocks */                                     \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            blocksize_idx, uint16_t, blocksize,                         \
+            transform_sdft_blocksizes                                   \
+            ,                                                           \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Window length: %d\n",                      \
+                            (int)blocksize,                             \
+                            (int)window_len);                           \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_sdft_##suffix(                                      \
+                    &sdft_inst,                                         \
+                    transform_fft_##suffix##_inputs + processed,        \
+                    (void *) transform_fft_output_fut,                  \
+                    blocksize));                                        \
+            processed += blocksize;                                     \
+                                                                        \
+            if (processed >= window_len)                                \
+            {                                                           \
+                ref_dft_bins_##suffix(                                  \
+                    transform_fft_##suffix##_inputs                     \
+                    + processed - window_len,                           \
+                    window_len, bins, num_bins,                         \
+                    __VA_ARGS__ (void *) transform_fft_output_ref);     \
+                                                                        \
+                /* Test correctness */                                  \
+                TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                  \
+                    num_bins,                                           \
+                    output_type);                                       \
+            });                                                         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+GOERTZEL_DEFINE_TEST(f32, F32, float32_t, );
+GOERTZEL_DEFINE_TEST(q31, Q31, q31_t, goertzel_inst.shift,);
+SDFT_DEFINE_TEST(f32, F32, float32_t, 1.0f, );
+SDFT_DEFINE_TEST(q31, Q31, q31_t, 0x7FFFFFFF, sdft_inst.shift,);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(goertzel_tests)
+{
+    JTEST_TEST_CALL(arm_goertzel_f32_test);
+    JTEST_TEST_CALL(arm_goertzel_q31_test);
+    JTEST_TEST_CALL(arm_sdft_f32_test);
+    JTEST_TEST_CALL(arm_sdft_q31_test);
+}
@@ -8,4 +8,5 @@ JTEST_DEFINE_GROUP(transform_tests)
     JTEST_GROUP_CALL(rfft_tests);
     JTEST_GROUP_CALL(rfft_fast_tests);
     JTEST_GROUP_CALL(dct4_tests);
+    JTEST_GROUP_CALL(goertzel_tests);
 }
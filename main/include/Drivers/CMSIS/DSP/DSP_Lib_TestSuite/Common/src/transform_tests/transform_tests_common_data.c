@@ -17,6 +17,39 @@ float32_t transform_fft_output_f32_ref[TRANSFORM_MAX_FFT_LEN * 2] = {0};
 float32_t * transform_fft_inplace_input_fut = transform_fft_output_fut;
 float32_t * transform_fft_inplace_input_ref = transform_fft_output_ref;
 
+/* Twiddle factors and work buffer of the mixed-radix FFTs, also large enough
+ * for the real FFT of TRANSFORM_MAX_MIXED_FFT_LEN points. */
+float32_t transform_fft_mixed_state[ARM_CFFT_MIXED_STATE_LENGTH(TRANSFORM_MAX_MIXED_FFT_LEN)] = {0};
+
+/* Goertzel bins: integer, fractional, and at and near 0 and N/2 for the f32
+ * version only, where the Q31 scaling costs too many bits (see
+ * arm_goertzel_init_q31). Sliding DFT bins, below TRANSFORM_SDFT_WINDOW_LEN. */
+const float32_t transform_goertzel_f32_bins[TRANSFORM_GOERTZEL_F32_NUM_BINS] =
+{
+    0.0f, 1.0f, 7.5f, 50.0f, 51.2f, 100.25f, 127.0f
+};
+const float32_t transform_goertzel_q31_bins[TRANSFORM_GOERTZEL_Q31_NUM_BINS] =
+{
+    7.5f, 50.0f, 51.2f, 100.25f
+};
+const uint16_t transform_sdft_f32_bins[TRANSFORM_SDFT_F32_NUM_BINS] =
+{
+    0, 1, 3, 50, 127
+};
+const uint16_t transform_sdft_q31_bins[TRANSFORM_SDFT_Q31_NUM_BINS] =
+{
+    3, 50, 100
+};
+
+/* Coefficients and state of the Goertzel and sliding DFT tests, also used
+ * as q31_t */
+float32_t transform_goertzel_coeffs[ARM_GOERTZEL_COEFFS_PER_BIN * TRANSFORM_GOERTZEL_F32_NUM_BINS] = {0};
+float32_t transform_sdft_state[ARM_SDFT_STATE_LENGTH(TRANSFORM_SDFT_F32_NUM_BINS, TRANSFORM_SDFT_WINDOW_LEN)] = {0};
+
+/* Arena of the FFT tables generated at initialization, large enough for the
+ * CFFT of TRANSFORM_MAX_FFT_LEN points and the real FFTs up to 4096 points. */
+uint64_t transform_fft_tables_arena[ARM_CFFT_TABLES_SIZE_F32(TRANSFORM_MAX_FFT_LEN) / 8U] = {0};
+
 q31_t transform_fft_q31_inputs[TRANSFORM_MAX_FFT_LEN * 2] =
 {
     0xC14A5524, 0xCCABDA17, 0xAD6F5B56, 0xFDAFCE3B, 0xA9B226EB,
@@ -3250,6 +3283,35 @@ ARR_DESC_DEFINE(uint16_t,
                       32, 64, 128, 256,
                       512, 1024, 2048));
 
+/* 2^a * 3^b * 5^c, covering the radix-2, 3, 4, 5 and 8 stages */
+ARR_DESC_DEFINE(uint16_t,
+                transform_cfft_mixed_fftlens,
+                10,
+                CURLY(
+                      12, 15, 48, 60, 100,
+                      120, 240, 360, 480, 960));
+
+ARR_DESC_DEFINE(uint16_t,
+                transform_rfft_mixed_fftlens,
+                8,
+                CURLY(
+                      24, 60, 96, 120, 240,
+                      480, 960, TRANSFORM_MAX_MIXED_FFT_LEN));
+
+ARR_DESC_DEFINE(uint16_t,
+                transform_goertzel_blocksizes,
+                2,
+                CURLY(
+                      256, 1000));
+
+/* Blocks fed to the sliding DFT one after the other: shorter and longer than
+ * the window */
+ARR_DESC_DEFINE(uint16_t,
+                transform_sdft_blocksizes,
+                4,
+                CURLY(
+                      1, 100, 300, 299));
+
 /*--------------------------------------------------------------------------------*/
 /* CFFT_F32 Structs */
 /*--------------------------------------------------------------------------------*/
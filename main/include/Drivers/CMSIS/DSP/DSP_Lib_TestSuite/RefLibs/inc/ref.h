@@ -932,6 +932,30 @@ void ref_fir_interpolate_q15(
   const arm_fir_interpolate_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_cic_decimate_q31(
+  const arm_cic_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_cic_decimate_q15(
+  const arm_cic_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_cic_interpolate_q31(
+  const arm_cic_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_cic_interpolate_q15(
+  const arm_cic_interpolate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 	/*
@@ -1297,6 +1321,26 @@ void ref_cfft_f32(
    uint8_t ifftFlag,
    uint8_t bitReverseFlag);
 	 
+void ref_cfft_mixed_f32(
+	const arm_cfft_mixed_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag);
+
+void ref_dft_bins_f32(
+	const float32_t * pSrc,
+	uint32_t blockSize,
+	const float32_t * pBins,
+	uint16_t numBins,
+	float32_t * pDst);
+
+void ref_dft_bins_q31(
+	const q31_t * pSrc,
+	uint32_t blockSize,
+	const float32_t * pBins,
+	uint16_t numBins,
+	uint8_t shift,
+	q31_t * pDst);
+
 void ref_cfft_q31(
 	const arm_cfft_instance_q31 * S,
     q31_t * p1,
@@ -1343,6 +1387,11 @@ void ref_rfft_fast_f32(
 	float32_t * p, float32_t * pOut,
 	uint8_t ifftFlag);
 
+void ref_rfft_mixed_f32(
+	const arm_rfft_mixed_instance_f32 * S,
+	float32_t * p, float32_t * pOut,
+	uint8_t ifftFlag);
+
 void ref_rfft_q31(
   const arm_rfft_instance_q31 * S,
   q31_t * pSrc,
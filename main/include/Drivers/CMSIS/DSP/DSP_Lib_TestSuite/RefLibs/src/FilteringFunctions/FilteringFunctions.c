@@ -1,5 +1,6 @@
 
 #include "biquad.c"
+#include "cic.c"
 #include "conv.c"
 #include "correlate.c"
 #include "fir.c"
@@ -0,0 +1,114 @@
+#include "ref.h"
+
+/* Largest R*diffDelay of the reference CIC filters */
+#define REF_CIC_MAX_RD 256
+
+static q63_t ref_cic_coeffs[ARM_CIC_MAX_STAGES * (REF_CIC_MAX_RD - 1) + 1];
+
+/*
+ * Impulse response of the CIC filter at the high rate, the moving sum of
+ * R*D samples applied N times, in ref_cic_coeffs. Returns its length.
+ */
+static uint32_t ref_cic_response(uint32_t R, uint32_t N, uint32_t D)
+{
+	uint32_t rd = R * D;
+	uint32_t len = 1;
+	uint32_t stage, k;
+
+	ref_cic_coeffs[0] = 1;
+	for (stage = 0; stage < N; stage++) {
+		for (k = len; k < len + rd - 1; k++) {
+			ref_cic_coeffs[k] = 0;
+		}
+		len += rd - 1;
+
+		/* Prefix sums, then their differences at distance R*D */
+		for (k = 1; k < len; k++) {
+			ref_cic_coeffs[k] += ref_cic_coeffs[k - 1];
+		}
+		for (k = len - 1; k >= rd; k--) {
+			ref_cic_coeffs[k] -= ref_cic_coeffs[k - rd];
+		}
+	}
+	return len;
+}
+
+void ref_cic_decimate_q31(
+	const arm_cic_decimate_instance_q31 * S,
+	q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t len = ref_cic_response(S->R, S->numStages, S->diffDelay);
+	uint32_t m, n, k;
+	q63_t sum;
+
+	/* The outputs are the ones of input samples R-1, 2R-1, ... */
+	for (m = 0; (m + 1) * S->R <= blockSize; m++) {
+		n = (m + 1) * S->R - 1;
+		sum = 0;
+		for (k = 0; k < len && k <= n; k++) {
+			sum += ref_cic_coeffs[k] * pSrc[n - k];
+		}
+		pDst[m] = (q31_t)(sum >> S->postShift);
+	}
+}
+
+void ref_cic_decimate_q15(
+	const arm_cic_decimate_instance_q15 * S,
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t len = ref_cic_response(S->R, S->numStages, S->diffDelay);
+	uint32_t m, n, k;
+	q63_t sum;
+
+	for (m = 0; (m + 1) * S->R <= blockSize; m++) {
+		n = (m + 1) * S->R - 1;
+		sum = 0;
+		for (k = 0; k < len && k <= n; k++) {
+			sum += ref_cic_coeffs[k] * pSrc[n - k];
+		}
+		pDst[m] = (q15_t)(sum >> S->postShift);
+	}
+}
+
+void ref_cic_interpolate_q31(
+	const arm_cic_interpolate_instance_q31 * S,
+	q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t len = ref_cic_response(S->R, S->numStages, S->diffDelay);
+	uint32_t n, k;
+	q63_t sum;
+
+	/* Input sample i is at high rate time i*R, with zeros in between */
+	for (n = 0; n < blockSize * S->R; n++) {
+		sum = 0;
+		for (k = n % S->R; k < len && k <= n; k += S->R) {
+			sum += ref_cic_coeffs[k] * pSrc[(n - k) / S->R];
+		}
+		pDst[n] = (q31_t)(sum >> S->postShift);
+	}
+}
+
+void ref_cic_interpolate_q15(
+	const arm_cic_interpolate_instance_q15 * S,
+	q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t len = ref_cic_response(S->R, S->numStages, S->diffDelay);
+	uint32_t n, k;
+	q63_t sum;
+
+	for (n = 0; n < blockSize * S->R; n++) {
+		sum = 0;
+		for (k = n % S->R; k < len && k <= n; k += S->R) {
+			sum += ref_cic_coeffs[k] * pSrc[(n - k) / S->R];
+		}
+		pDst[n] = (q15_t)(sum >> S->postShift);
+	}
+}
@@ -1,4 +1,5 @@
 
 #include "cfft.c"
 #include "dct4.c"
+#include "dft_bins.c"
 #include "rfft.c"
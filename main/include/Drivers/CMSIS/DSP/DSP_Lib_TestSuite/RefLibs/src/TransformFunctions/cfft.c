@@ -67,6 +67,37 @@ void ref_cfft_f32(
 	}
 }
 
+void ref_cfft_mixed_f32(
+	const arm_cfft_mixed_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag)
+{
+	// Direct DFT in double precision, on a copy in the work buffer of S
+	uint32_t N = S->fftLen;
+	uint32_t k, n;
+	float64_t sumr, sumi, angle;
+	float64_t dir = (ifftFlag) ? 1.0 : -1.0;
+	float32_t *data = S->pBuffer;
+
+	memcpy(data, p1, 2 * N * sizeof(float32_t));
+	for (k = 0; k < N; k++) {
+		sumr = 0.0;
+		sumi = 0.0;
+		for (n = 0; n < N; n++) {
+			angle = dir * 6.283185307179586 * (float64_t)((k * n) % N) / N;
+			sumr += data[2*n] * cos(angle) - data[2*n+1] * sin(angle);
+			sumi += data[2*n] * sin(angle) + data[2*n+1] * cos(angle);
+		}
+		// Inverse transform is scaled by 1/N
+		if (ifftFlag) {
+			sumr /= N;
+			sumi /= N;
+		}
+		p1[2*k] = (float32_t)sumr;
+		p1[2*k+1] = (float32_t)sumi;
+	}
+}
+
 void ref_cfft_q31(
 	const arm_cfft_instance_q31 * S,
     q31_t * p1,
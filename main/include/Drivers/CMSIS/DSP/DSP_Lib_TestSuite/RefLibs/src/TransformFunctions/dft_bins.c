@@ -0,0 +1,50 @@
+#include "ref.h"
+
+void ref_dft_bins_f32(
+	const float32_t * pSrc,
+	uint32_t blockSize,
+	const float32_t * pBins,
+	uint16_t numBins,
+	float32_t * pDst)
+{
+	// Direct DTFT at the bin frequencies, in double precision
+	uint32_t bin, n;
+	float64_t sumr, sumi, w;
+
+	for (bin = 0; bin < numBins; bin++) {
+		w = 6.283185307179586 * pBins[bin] / blockSize;
+		sumr = 0.0;
+		sumi = 0.0;
+		for (n = 0; n < blockSize; n++) {
+			sumr += pSrc[n] * cos(w * n);
+			sumi -= pSrc[n] * sin(w * n);
+		}
+		pDst[2*bin] = (float32_t)sumr;
+		pDst[2*bin+1] = (float32_t)sumi;
+	}
+}
+
+void ref_dft_bins_q31(
+	const q31_t * pSrc,
+	uint32_t blockSize,
+	const float32_t * pBins,
+	uint16_t numBins,
+	uint8_t shift,
+	q31_t * pDst)
+{
+	// Direct DTFT at the bin frequencies, in double precision, scaled by 2^-shift
+	uint32_t bin, n;
+	float64_t sumr, sumi, w;
+
+	for (bin = 0; bin < numBins; bin++) {
+		w = 6.283185307179586 * pBins[bin] / blockSize;
+		sumr = 0.0;
+		sumi = 0.0;
+		for (n = 0; n < blockSize; n++) {
+			sumr += (float64_t)pSrc[n] * cos(w * n);
+			sumi -= (float64_t)pSrc[n] * sin(w * n);
+		}
+		pDst[2*bin] = (q31_t)(sumr / (1 << shift));
+		pDst[2*bin+1] = (q31_t)(sumi / (1 << shift));
+	}
+}
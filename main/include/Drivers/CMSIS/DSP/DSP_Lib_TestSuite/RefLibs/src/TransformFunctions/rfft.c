@@ -137,6 +137,59 @@ void ref_rfft_fast_f32(
 	}
 }
 	
+void ref_rfft_mixed_f32(
+	const arm_rfft_mixed_instance_f32 * S,
+	float32_t * p, float32_t * pOut,
+	uint8_t ifftFlag)
+{
+	// Direct real DFT in double precision, with the packing of ref_rfft_fast_f32
+	uint32_t N = S->fftLenRFFT;
+	uint32_t k, n;
+	float64_t sumr, sumi, angle;
+
+	if (ifftFlag)
+	{
+		for(n=0;n<N;n++)
+		{
+			//bins 0 and N/2, then the other bins twice (Hermitian symmetry)
+			sumr = p[0] + ((n & 1) ? -p[1] : p[1]);
+			for(k=1;k<N/2;k++)
+			{
+				angle = 6.283185307179586 * (float64_t)((k * n) % N) / N;
+				sumr += 2.0 * (p[2*k] * cos(angle) - p[2*k+1] * sin(angle));
+			}
+			pOut[n] = (float32_t)(sumr / N);
+		}
+	}
+	else
+	{
+		for(k=0;k<=N/2;k++)
+		{
+			sumr = 0.0;
+			sumi = 0.0;
+			for(n=0;n<N;n++)
+			{
+				angle = 6.283185307179586 * (float64_t)((k * n) % N) / N;
+				sumr += p[n] * cos(angle);
+				sumi -= p[n] * sin(angle);
+			}
+			if (k == N/2)
+			{
+				//pack last sample's real part into first sample's complex part
+				pOut[1] = (float32_t)sumr;
+			}
+			else
+			{
+				pOut[2*k] = (float32_t)sumr;
+				if (k > 0)
+				{
+					pOut[2*k+1] = (float32_t)sumi;
+				}
+			}
+		}
+	}
+}
+	
 void ref_rfft_q31(
   const arm_rfft_instance_q31 * S,
   q31_t * pSrc,
@@ -128,6 +128,25 @@
    * of some DSP functions. Experimental Neon versions currently do not have better
    * performances than the scalar versions.
    *
+   * - ARM_MATH_X86_SIMD:
+   *
+   * Define macro ARM_MATH_X86_SIMD to build the library for an x86-64 host (simulation,
+   * offline analysis) with the Neon versions of the DSP functions, running on SSE4.2
+   * (arm_neon_x86.h). It implies ARM_MATH_NEON and ARM_MATH_NEON_EXPERIMENTAL and
+   * requires -msse4.2. With -mavx2, the element-wise functions and the dot product also
+   * process 8 samples at a time. arm_mat_mult_f32 and arm_cmplx_mag_f32 have x86 versions
+   * giving the scalar results, and the transposed direct form II biquad keeps the
+   * coefficient layout of the Cortex-M builds (no arm_biquad_cascade_df2T_compute_coefs_f32).
+   * arm_mean_f32 keeps the sequential sum: its result is the scalar one.
+   * The Neon FFT stages (radix-8 butterflies, bit reversal, real FFT split and merge)
+   * compute the operations of the scalar ones: the results of finite inputs are the same.
+   * Build with -ffp-contract=off: multiply-accumulates are then rounded as on Neon.
+   * Element-wise functions give the same results as the scalar versions. Functions
+   * which accumulate (dot product, FIR, correlation, statistics...) add the terms in
+   * another order, as on Neon: like the scalar result, the result of n terms is within
+   * n * 2^-24 * sum(|term|) of the exact sum, and within the SNR thresholds of
+   * DSP_Lib_TestSuite.
+   *
    * <hr>
    * CMSIS-DSP in ARM::CMSIS Pack
    * -----------------------------
@@ -327,7 +346,17 @@
   #define ARM_MATH_DSP                   1
 #endif
 
-#if defined(__ARM_NEON)
+#if defined(ARM_MATH_X86_SIMD)
+/* Neon intrinsics implemented with SSE4.2: the Neon versions are used on x86-64,
+   including the experimental ones, which are faster than the scalar code there */
+#include "arm_neon_x86.h"
+  #if !defined(ARM_MATH_NEON)
+    #define ARM_MATH_NEON
+  #endif
+  #if !defined(ARM_MATH_NEON_EXPERIMENTAL)
+    #define ARM_MATH_NEON_EXPERIMENTAL
+  #endif
+#elif defined(__ARM_NEON)
 #include <arm_neon.h>
 #endif
 
@@ -820,11 +849,16 @@ compiler file in Core or Core_A would not make sense.
 
 static inline float32x4_t __arm_vec_sqrt_f32_neon(float32x4_t  x)
 {
+#if defined(ARM_MATH_X86_SIMD)
+    /* Correctly rounded square root, 0 for negative inputs as arm_sqrt_f32 */
+    return (float32x4_t)_mm_sqrt_ps(_mm_max_ps((__m128)x, _mm_setzero_ps()));
+#else
     float32x4_t x1 = vmaxq_f32(x, vdupq_n_f32(FLT_MIN));
     float32x4_t e = vrsqrteq_f32(x1);
     e = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x1, e), e), e);
     e = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x1, e), e), e);
     return vmulq_f32(x, e);
+#endif
 }
 
 static inline int16x8_t __arm_vec_sqrt_q15_neon(int16x8_t vec)
@@ -1512,6 +1546,87 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
   const float32_t * pCoeffs,
         float32_t * pState);
 
+  /**
+   * @brief Instance structure for the multi-channel floating-point Biquad cascade filter.
+   */
+  typedef struct
+  {
+          uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;    /**< number of interleaved channels, filtered with the same coefficients. */
+          float32_t *pState;       /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    const float32_t *pCoeffs;      /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_casd_mc_df1_inst_f32;
+
+  /**
+   * @brief Instance structure for the multi-channel Q31 Biquad cascade filter.
+   */
+  typedef struct
+  {
+          uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;    /**< number of interleaved channels, filtered with the same coefficients. */
+          q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    const q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+          uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_mc_df1_inst_q31;
+
+  /**
+   * @brief Processing function for the multi-channel floating-point Biquad cascade filter.
+   * @param[in]  S          points to an instance of the multi-channel floating-point Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of channel-interleaved input data.
+   * @param[out] pDst       points to the block of channel-interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_mc_df1_f32(
+  const arm_biquad_casd_mc_df1_inst_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the multi-channel floating-point Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the multi-channel floating-point Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_mc_df1_init_f32(
+        arm_biquad_casd_mc_df1_inst_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+  /**
+   * @brief Processing function for the multi-channel Q31 Biquad cascade filter.
+   * @param[in]  S          points to an instance of the multi-channel Q31 Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of channel-interleaved input data.
+   * @param[out] pDst       points to the block of channel-interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_mc_df1_q31(
+  const arm_biquad_casd_mc_df1_inst_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the multi-channel Q31 Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the multi-channel Q31 Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_mc_df1_init_q31(
+        arm_biquad_casd_mc_df1_inst_q31 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        int8_t postShift);
+
   /**
    * @brief Instance structure for the floating-point matrix structure.
    */
@@ -2390,6 +2505,426 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+  /**
+   * @brief Arena receiving the FFT tables generated at initialization, placed by the
+   * application in DTCM or AXI SRAM.
+   */
+  typedef struct
+  {
+          uint8_t *pBase;                                   /**< start of the arena, 8-byte aligned. */
+          uint32_t size;                                    /**< size of the arena in bytes. */
+          uint32_t used;                                    /**< bytes already given to tables. */
+  } arm_fft_table_arena;
+
+  /**
+   * @brief Length of the bit reversal table of arm_cfft_f32(), for a power of 2 from 16 to 4096:
+   * the length of the constant armBitRevIndexTableN.
+   */
+#define ARM_CFFT_BITREV_LENGTH_F32(fftLen) \
+  ((fftLen) == 16U ? 20U : (fftLen) == 32U ? 48U : (fftLen) == 64U ? 56U :       \
+   (fftLen) == 128U ? 208U : (fftLen) == 256U ? 440U : (fftLen) == 512U ? 448U : \
+   (fftLen) == 1024U ? 1800U : (fftLen) == 2048U ? 3808U : 4032U)
+
+  /**
+   * @brief Arena bytes used by arm_cfft_tables_init_f32(): fftLen twiddle factors and the
+   * bit reversal table.
+   */
+#define ARM_CFFT_TABLES_SIZE_F32(fftLen) \
+  (8U * (fftLen) + ((2U * ARM_CFFT_BITREV_LENGTH_F32(fftLen) + 7U) & ~7U))
+
+  /**
+   * @brief Arena bytes used by arm_rfft_fast_tables_init_f32(): the CFFT of fftLen/2 points and
+   * the fftLen/2 twiddle factors of the split stage.
+   */
+#define ARM_RFFT_FAST_TABLES_SIZE_F32(fftLen) \
+  (ARM_CFFT_TABLES_SIZE_F32((fftLen) / 2U) + 4U * (fftLen))
+
+  /**
+   * @brief Initializes an arena for the run-time FFT tables.
+   * @param[out] A      points to the arena.
+   * @param[in]  pBase  points to the arena memory, 8-byte aligned.
+   * @param[in]  size   size of the arena memory in bytes.
+   */
+  void arm_fft_table_arena_init(
+        arm_fft_table_arena * A,
+        void * pBase,
+        uint32_t size);
+
+  /**
+   * @brief Initializes an arm_cfft_f32() instance with tables generated into an arena.
+   * @param[out]    S       points to an instance of the floating-point CFFT structure.
+   * @param[in]     fftLen  length of the FFT, a power of 2 from 16 to 4096.
+   * @param[in,out] A       points to the arena.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR for an unsupported length, or
+   * ARM_MATH_LENGTH_ERROR if the arena is too small.
+   */
+  arm_status arm_cfft_tables_init_f32(
+        arm_cfft_instance_f32 * S,
+        uint16_t fftLen,
+        arm_fft_table_arena * A);
+
+  /**
+   * @brief Initializes an arm_rfft_fast_f32() instance with tables generated into an arena.
+   * @param[out]    S       points to an instance of the floating-point real FFT structure.
+   * @param[in]     fftLen  length of the real sequence, a power of 2 from 32 to 4096.
+   * @param[in,out] A       points to the arena.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR for an unsupported length, or
+   * ARM_MATH_LENGTH_ERROR if the arena is too small.
+   */
+  arm_status arm_rfft_fast_tables_init_f32(
+        arm_rfft_fast_instance_f32 * S,
+        uint16_t fftLen,
+        arm_fft_table_arena * A);
+
+  /**
+   * @brief Maximum number of stages of the mixed-radix CFFT.
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES 16
+
+  /**
+   * @brief Length of the state buffer of the mixed-radix CFFT, in samples:
+   * twiddle factors and work buffer of 2*fftLen values each.
+   */
+#define ARM_CFFT_MIXED_STATE_LENGTH(fftLen) (4U * (fftLen))
+
+  /**
+   * @brief Length of the state buffer of the mixed-radix RFFT, in samples:
+   * the CFFT of fftLen/2 points and the fftLen values of the split twiddle factors.
+   */
+#define ARM_RFFT_MIXED_STATE_LENGTH(fftLen) (3U * (fftLen))
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                                  /**< length of the FFT, a product of 2, 3 and 5. */
+          uint16_t numStages;                               /**< number of radix stages. */
+          uint8_t radix[ARM_CFFT_MIXED_MAX_STAGES];         /**< radix of each stage: 2, 3, 4, 5 or 8. */
+          float32_t *pTwiddle;                              /**< twiddle factors exp(-2*pi*i*k/fftLen), fftLen complex values. */
+          float32_t *pBuffer;                               /**< work buffer of fftLen complex values. */
+  } arm_cfft_mixed_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[out] S       points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]  fftLen  length of the FFT: 2^a * 3^b * 5^c, at least 2.
+   * @param[in]  pState  points to the state buffer of ARM_CFFT_MIXED_STATE_LENGTH(fftLen) samples.
+   * @return     execution status
+   *               - \ref ARM_MATH_SUCCESS        : Operation successful
+   *               - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> has a prime factor other than 2, 3 and 5
+   */
+  arm_status arm_cfft_mixed_init_f32(
+        arm_cfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point mixed-radix complex FFT.
+   * @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in,out] p1        points to the complex data buffer of size 2*fftLen. Processing occurs in-place.
+   * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   */
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          arm_cfft_mixed_instance_f32 Sint;   /**< Internal mixed-radix CFFT of fftLenRFFT/2 points. */
+          uint16_t fftLenRFFT;                /**< length of the real sequence */
+          float32_t *pTwiddleRFFT;            /**< Twiddle factors of the real stage, fftLenRFFT/2 complex values */
+  } arm_rfft_mixed_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point mixed-radix RFFT/RIFFT.
+   * @param[out] S       points to an instance of the floating-point mixed-radix RFFT structure.
+   * @param[in]  fftLen  length of the real sequence: even, with fftLen/2 a valid mixed-radix CFFT length.
+   * @param[in]  pState  points to the state buffer of ARM_RFFT_MIXED_STATE_LENGTH(fftLen) samples.
+   * @return     execution status
+   *               - \ref ARM_MATH_SUCCESS        : Operation successful
+   *               - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not supported
+   */
+  arm_status arm_rfft_mixed_init_f32(
+        arm_rfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point mixed-radix real FFT, with the packed
+   * output format of arm_rfft_fast_f32().
+   * @param[in]  S         points to an instance of the floating-point mixed-radix RFFT structure.
+   * @param[in]  p         points to the input buffer. It is modified by the function.
+   * @param[out] pOut      points to the output buffer.
+   * @param[in]  ifftFlag  RFFT if flag is 0, RIFFT if flag is 1.
+   */
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Number of coefficients per bin of the Goertzel filters: the recursion
+   * coefficient, then the two complex factors applied to the last states.
+   */
+#define ARM_GOERTZEL_COEFFS_PER_BIN 5U
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;            /**< number of frequency bins. */
+          uint16_t blockSize;          /**< number of samples N of the analysed block. */
+    const float32_t *pCoeffs;          /**< points to the ARM_GOERTZEL_COEFFS_PER_BIN*numBins coefficients. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;            /**< number of frequency bins. */
+          uint16_t blockSize;          /**< number of samples N of the analysed block. */
+          uint8_t shift;               /**< input down-shift: the bins are scaled by 2^-shift. */
+    const q31_t *pCoeffs;              /**< points to the ARM_GOERTZEL_COEFFS_PER_BIN*numBins coefficients, 2*cos(w) in 2.30 format. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief Initialization function for the floating-point Goertzel filter bank.
+   * @param[out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]  numBins    number of frequency bins.
+   * @param[in]  pBins      points to the numBins bin frequencies, in bins of blockSize points (fraction allowed).
+   * @param[out] pCoeffs    points to the ARM_GOERTZEL_COEFFS_PER_BIN*numBins coefficients.
+   * @param[in]  blockSize  number of samples N of the analysed block.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numBins or blockSize is 0.
+   */
+  arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+  const float32_t * pBins,
+        float32_t * pCoeffs,
+        uint16_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point Goertzel filter bank.
+   * @param[in]  S     points to an instance of the floating-point Goertzel structure.
+   * @param[in]  pSrc  points to the block of blockSize input samples.
+   * @param[out] pDst  points to the numBins complex bins (interleaved real and imaginary parts).
+   */
+  void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst);
+
+  /**
+   * @brief Initialization function for the Q31 Goertzel filter bank.
+   * @param[out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]  numBins    number of frequency bins.
+   * @param[in]  pBins      points to the numBins bin frequencies, in bins of blockSize points (fraction allowed).
+   * @param[out] pCoeffs    points to the ARM_GOERTZEL_COEFFS_PER_BIN*numBins coefficients.
+   * @param[in]  blockSize  number of samples N of the analysed block.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numBins or blockSize is 0.
+   */
+  arm_status arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+  const float32_t * pBins,
+        q31_t * pCoeffs,
+        uint16_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 Goertzel filter bank.
+   * @param[in]  S     points to an instance of the Q31 Goertzel structure.
+   * @param[in]  pSrc  points to the block of blockSize input samples.
+   * @param[out] pDst  points to the numBins complex bins, in 1.31 format scaled by 2^-shift.
+   */
+  void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst);
+
+  /**
+   * @brief Number of coefficients per bin of the sliding DFT: r*exp(i*w) and exp(i*w).
+   */
+#define ARM_SDFT_COEFFS_PER_BIN 4U
+
+  /**
+   * @brief Length of the state buffer of the sliding DFT, in samples: the numBins
+   * complex bins and the windowLen delayed input samples.
+   */
+#define ARM_SDFT_STATE_LENGTH(numBins, windowLen) (2U * (numBins) + (windowLen))
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;            /**< number of frequency bins. */
+          uint16_t windowLen;          /**< length N of the sliding window. */
+          uint16_t index;              /**< position of x[n-N] in the delay line. */
+          float32_t dampingN;          /**< r^N, weight of the sample leaving the window. */
+    const float32_t *pCoeffs;          /**< points to the ARM_SDFT_COEFFS_PER_BIN*numBins coefficients. */
+          float32_t *pState;           /**< points to the state buffer of ARM_SDFT_STATE_LENGTH(numBins, windowLen) samples. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;            /**< number of frequency bins. */
+          uint16_t windowLen;          /**< length N of the sliding window. */
+          uint16_t index;              /**< position of x[n-N] in the delay line. */
+          uint8_t shift;               /**< input down-shift: the bins are scaled by 2^-shift. */
+          q31_t dampingN;              /**< r^N, weight of the sample leaving the window. */
+    const q31_t *pCoeffs;              /**< points to the ARM_SDFT_COEFFS_PER_BIN*numBins coefficients. */
+          q31_t *pState;               /**< points to the state buffer of ARM_SDFT_STATE_LENGTH(numBins, windowLen) samples. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief Initialization function for the floating-point sliding DFT.
+   * @param[out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]  numBins    number of frequency bins.
+   * @param[in]  pBins      points to the numBins bin indexes, below windowLen.
+   * @param[in]  damping    damping factor r of the recursion, 1.0 for none.
+   * @param[out] pCoeffs    points to the ARM_SDFT_COEFFS_PER_BIN*numBins coefficients.
+   * @param[in]  pState     points to the state buffer of ARM_SDFT_STATE_LENGTH(numBins, windowLen) samples.
+   * @param[in]  windowLen  length N of the sliding window.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for an invalid argument.
+   */
+  arm_status arm_sdft_init_f32(
+        arm_sdft_instance_f32 * S,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        float32_t damping,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        uint16_t windowLen);
+
+  /**
+   * @brief Processing function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the numBins complex bins of the window ending at the last sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the Q31 sliding DFT.
+   * @param[out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]  numBins    number of frequency bins.
+   * @param[in]  pBins      points to the numBins bin indexes, below windowLen.
+   * @param[in]  damping    damping factor r of the recursion, in 1.31 format.
+   * @param[out] pCoeffs    points to the ARM_SDFT_COEFFS_PER_BIN*numBins coefficients.
+   * @param[in]  pState     points to the state buffer of ARM_SDFT_STATE_LENGTH(numBins, windowLen) samples.
+   * @param[in]  windowLen  length N of the sliding window.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for an invalid argument.
+   */
+  arm_status arm_sdft_init_q31(
+        arm_sdft_instance_q31 * S,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        q31_t damping,
+        q31_t * pCoeffs,
+        q31_t * pState,
+        uint16_t windowLen);
+
+  /**
+   * @brief Processing function for the Q31 sliding DFT.
+   * @param[in,out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the numBins complex bins, in 1.31 format scaled by 2^-shift.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Filtering method of the floating-point FFT FIR filter.
+   */
+  typedef enum
+  {
+    ARM_FIR_FFT_AUTO = 0,        /**< direct form or overlap-save, whichever is cheaper for numTaps and blockSize */
+    ARM_FIR_FFT_DIRECT,          /**< direct form, through arm_fir_f32() */
+    ARM_FIR_FFT_OVERLAP_SAVE,    /**< uniformly partitioned overlap-save */
+    ARM_FIR_FFT_OVERLAP_ADD      /**< uniformly partitioned overlap-add */
+  } arm_fir_fft_method;
+
+  /**
+   * @brief Length of the state buffer of the floating-point FFT FIR filter, in samples.
+   *
+   * The filter is split in ceil(numTaps/blockSize) partitions. Each has a coefficient
+   * spectrum and an input spectrum of 2*blockSize values; the work buffers take
+   * another 7*blockSize values.
+   */
+#define ARM_FIR_FFT_STATE_LENGTH(numTaps, blockSize) \
+  ((4U * (((numTaps) + (blockSize) - 1U) / (blockSize)) + 7U) * (blockSize))
+
+  /**
+   * @brief Instance structure for the floating-point FFT FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;                  /**< number of filter coefficients in the filter. */
+          uint16_t blockSize;                /**< number of samples processed per call. */
+          uint16_t numPartitions;            /**< number of blockSize long partitions of the filter. */
+          uint16_t partition;                /**< slot of the newest input spectrum in pSpectra. */
+          arm_fir_fft_method method;         /**< method selected by the initialization function. */
+          arm_fir_instance_f32 fir;          /**< direct form filter, used by ARM_FIR_FFT_DIRECT. */
+          arm_rfft_fast_instance_f32 rfft;   /**< real FFT of length 2*blockSize. */
+          float32_t *pCoeffSpectra;          /**< spectra of the partitions, numPartitions*2*blockSize values. */
+          float32_t *pSpectra;               /**< spectra of the last numPartitions input blocks, numPartitions*2*blockSize values. */
+          float32_t *pInput;                 /**< time-domain input of the transform, 2*blockSize values. */
+          float32_t *pAccum;                 /**< sum of the partition products, 2*blockSize values. */
+          float32_t *pScratch;               /**< transform scratch and partition product, 2*blockSize values. */
+          float32_t *pOverlap;               /**< overlap-add tail, blockSize values. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point FFT FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point FFT FIR filter structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in time reversed order as for arm_fir_f32().
+   * @param[in]     pState     points to the state buffer of ARM_FIR_FFT_STATE_LENGTH(numTaps, blockSize) samples.
+   * @param[in]     blockSize  number of samples processed per call.
+   * @param[in]     method     filtering method.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0, or an FFT method is requested with a <code>blockSize</code> that is not a power of 2 between 16 and 2048
+   */
+  arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint16_t blockSize,
+        arm_fir_fft_method method);
+
+  /**
+   * @brief Processing function for the floating-point FFT FIR filter.
+   * @param[in,out] S     points to an instance of the floating-point FFT FIR filter structure.
+   * @param[in]     pSrc  points to the block of blockSize input samples.
+   * @param[out]    pDst  points to the block of blockSize output samples.
+   */
+  void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3705,6 +4240,435 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Length of the state buffer of the rational resamplers, in samples.
+   *
+   * The filter is rearranged into L polyphase components of ceil(numTaps/L)
+   * coefficients, followed by a delay line of twice that length.
+   */
+#define ARM_FIR_RESAMPLE_STATE_LENGTH(numTaps, L) \
+  ((((numTaps) + (L) - 1U) / (L)) * ((L) + 2U))
+
+  /**
+   * @brief Largest number of output samples of a call of the rational resamplers.
+   */
+#define ARM_FIR_RESAMPLE_MAX_OUTPUTS(blockSize, L, M) \
+  ((((uint32_t) (blockSize)) * (L) + (M) - 1U) / (M))
+
+  /**
+   * @brief Instance structure for the Q15 rational resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                     /**< upsample factor. */
+        uint16_t M;                     /**< downsample factor. */
+        uint16_t phaseLength;           /**< length of each polyphase filter component. */
+        uint16_t phase;                 /**< time of the next output sample at the upsampled rate, from the next input sample. */
+        uint16_t delayIndex;            /**< position of the oldest sample in the delay line. */
+        q15_t *pPhases;                 /**< polyphase components, L*phaseLength coefficients in the order of the delay line. */
+        q15_t *pDelay;                  /**< delay line, 2*phaseLength samples, each written twice. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 rational resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                     /**< upsample factor. */
+        uint16_t M;                     /**< downsample factor. */
+        uint16_t phaseLength;           /**< length of each polyphase filter component. */
+        uint16_t phase;                 /**< time of the next output sample at the upsampled rate, from the next input sample. */
+        uint16_t delayIndex;            /**< position of the oldest sample in the delay line. */
+        q31_t *pPhases;                 /**< polyphase components, L*phaseLength coefficients in the order of the delay line. */
+        q31_t *pDelay;                  /**< delay line, 2*phaseLength samples, each written twice. */
+  } arm_fir_resample_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point rational resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                     /**< upsample factor. */
+        uint16_t M;                     /**< downsample factor. */
+        uint16_t phaseLength;           /**< length of each polyphase filter component. */
+        uint16_t phase;                 /**< time of the next output sample at the upsampled rate, from the next input sample. */
+        uint16_t delayIndex;            /**< position of the oldest sample in the delay line. */
+        float32_t *pPhases;             /**< polyphase components, L*phaseLength coefficients in the order of the delay line. */
+        float32_t *pDelay;              /**< delay line, 2*phaseLength samples, each written twice. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief  Initialization function for the Q15 rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in the order of arm_fir_interpolate_q15().
+   * @param[in]     pState     points to the state buffer of ARM_FIR_RESAMPLE_STATE_LENGTH(numTaps, L) samples.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code>, <code>M</code> or <code>numTaps</code> is 0
+   */
+  arm_status arm_fir_resample_init_q15(
+        arm_fir_resample_instance_q15 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState);
+
+  /**
+   * @brief Processing function for the Q15 rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of ARM_FIR_RESAMPLE_MAX_OUTPUTS(blockSize, L, M) samples.
+   * @param[in]     blockSize  number of input samples to process, 1 or more.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q15(
+        arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in the order of arm_fir_interpolate_q31().
+   * @param[in]     pState     points to the state buffer of ARM_FIR_RESAMPLE_STATE_LENGTH(numTaps, L) samples.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code>, <code>M</code> or <code>numTaps</code> is 0
+   */
+  arm_status arm_fir_resample_init_q31(
+        arm_fir_resample_instance_q31 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState);
+
+  /**
+   * @brief Processing function for the Q31 rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of ARM_FIR_RESAMPLE_MAX_OUTPUTS(blockSize, L, M) samples.
+   * @param[in]     blockSize  number of input samples to process, 1 or more.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q31(
+        arm_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point rational resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in the order of arm_fir_interpolate_f32().
+   * @param[in]     pState     points to the state buffer of ARM_FIR_RESAMPLE_STATE_LENGTH(numTaps, L) samples.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code>, <code>M</code> or <code>numTaps</code> is 0
+   */
+  arm_status arm_fir_resample_init_f32(
+        arm_fir_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point rational resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of ARM_FIR_RESAMPLE_MAX_OUTPUTS(blockSize, L, M) samples.
+   * @param[in]     blockSize  number of input samples to process, 1 or more.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Kaiser window design of the low-pass filter of a rational resampler.
+   * @param[in]  L          upsample factor.
+   * @param[in]  M          downsample factor.
+   * @param[in]  numTaps    number of filter coefficients to compute.
+   * @param[in]  beta       parameter of the Kaiser window (5 for about 55 dB of stopband attenuation, 8 for 80 dB).
+   * @param[out] pCoeffs    points to the numTaps filter coefficients.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code>, <code>M</code> or <code>numTaps</code> is 0
+   */
+  arm_status arm_fir_resample_design_f32(
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+        float32_t beta,
+        float32_t * pCoeffs);
+
+  /**
+   * @brief Instance structure for the floating-point Farrow interpolator.
+   */
+  typedef struct
+  {
+        float32_t step;                 /**< input samples per output sample. */
+        float32_t mu;                   /**< position of the next output sample between x[n-2] and x[n-1]. */
+        float32_t state[3];             /**< the last 3 input samples {x[n-3], x[n-2], x[n-1]}. */
+  } arm_farrow_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Farrow interpolator.
+   * @param[in,out] S      points to an instance of the floating-point Farrow interpolator structure.
+   * @param[in]     step   input samples per output sample, fsIn/fsOut.
+   * @param[in]     delay  fractional delay of the first output sample, in [0, 1).
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>step</code> is not positive or <code>delay</code> is outside [0, 1)
+   */
+  arm_status arm_farrow_init_f32(
+        arm_farrow_instance_f32 * S,
+        float32_t step,
+        float32_t delay);
+
+  /**
+   * @brief Processing function for the floating-point Farrow interpolator.
+   * @param[in,out] S          points to an instance of the floating-point Farrow interpolator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of floor(blockSize/step)+1 samples.
+   * @param[in]     blockSize  number of input samples to process, 1 or more.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_farrow_f32(
+        arm_farrow_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Largest number of integrator and comb stages of the CIC filters.
+   */
+#define ARM_CIC_MAX_STAGES 6U
+
+  /**
+   * @brief Length of the state buffer of the CIC filters, in samples.
+   *
+   * One register per integrator, followed by diffDelay samples per comb.
+   */
+#define ARM_CIC_STATE_LENGTH(numStages, diffDelay) \
+  ((numStages) * (1U + (diffDelay)))
+
+  /**
+   * @brief Instance structure for the Q15 CIC decimator.
+   */
+  typedef struct
+  {
+        uint16_t R;                     /**< decimation factor. */
+        uint8_t numStages;              /**< number of integrator and comb stages. */
+        uint8_t diffDelay;              /**< differential delay of the combs, in output samples. */
+        uint8_t postShift;              /**< right shift of the output, the bit growth of the filter. */
+        uint16_t phase;                 /**< number of input samples since the last output sample. */
+        q31_t *pState;                  /**< points to the state buffer of ARM_CIC_STATE_LENGTH(numStages, diffDelay) samples. */
+  } arm_cic_decimate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 CIC decimator.
+   */
+  typedef struct
+  {
+        uint16_t R;                     /**< decimation factor. */
+        uint8_t numStages;              /**< number of integrator and comb stages. */
+        uint8_t diffDelay;              /**< differential delay of the combs, in output samples. */
+        uint8_t postShift;              /**< right shift of the output, the bit growth of the filter. */
+        uint16_t phase;                 /**< number of input samples since the last output sample. */
+        q63_t *pState;                  /**< points to the state buffer of ARM_CIC_STATE_LENGTH(numStages, diffDelay) samples. */
+  } arm_cic_decimate_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 CIC interpolator.
+   */
+  typedef struct
+  {
+        uint16_t R;                     /**< interpolation factor. */
+        uint8_t numStages;              /**< number of comb and integrator stages. */
+        uint8_t diffDelay;              /**< differential delay of the combs, in input samples. */
+        uint8_t postShift;              /**< right shift of the output, the bit growth of the filter. */
+        q31_t *pState;                  /**< points to the state buffer of ARM_CIC_STATE_LENGTH(numStages, diffDelay) samples. */
+  } arm_cic_interpolate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 CIC interpolator.
+   */
+  typedef struct
+  {
+        uint16_t R;                     /**< interpolation factor. */
+        uint8_t numStages;              /**< number of comb and integrator stages. */
+        uint8_t diffDelay;              /**< differential delay of the combs, in input samples. */
+        uint8_t postShift;              /**< right shift of the output, the bit growth of the filter. */
+        q63_t *pState;                  /**< points to the state buffer of ARM_CIC_STATE_LENGTH(numStages, diffDelay) samples. */
+  } arm_cic_interpolate_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q15 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q15 CIC decimator structure.
+   * @param[in]     numStages  number of integrator and comb stages, 1 to ARM_CIC_MAX_STAGES.
+   * @param[in]     R          decimation factor.
+   * @param[in]     diffDelay  differential delay of the combs, usually 1 or 2.
+   * @param[in]     pState     points to the state buffer of ARM_CIC_STATE_LENGTH(numStages, diffDelay) samples.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is 0, <code>numStages</code> is too large or the
+   *                                                   gain <code>(R*diffDelay)^numStages</code> exceeds 2^16
+   */
+  arm_status arm_cic_decimate_init_q15(
+        arm_cic_decimate_instance_q15 * S,
+        uint8_t numStages,
+        uint16_t R,
+        uint8_t diffDelay,
+        q31_t * pState);
+
+  /**
+   * @brief Processing function for the Q15 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q15 CIC decimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of blockSize/R+1 samples.
+   * @param[in]     blockSize  number of input samples to process, 1 or more.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_cic_decimate_q15(
+        arm_cic_decimate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     numStages  number of integrator and comb stages, 1 to ARM_CIC_MAX_STAGES.
+   * @param[in]     R          decimation factor.
+   * @param[in]     diffDelay  differential delay of the combs, usually 1 or 2.
+   * @param[in]     pState     points to the state buffer of ARM_CIC_STATE_LENGTH(numStages, diffDelay) samples.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is 0, <code>numStages</code> is too large or the
+   *                                                   gain <code>(R*diffDelay)^numStages</code> exceeds 2^32
+   */
+  arm_status arm_cic_decimate_init_q31(
+        arm_cic_decimate_instance_q31 * S,
+        uint8_t numStages,
+        uint16_t R,
+        uint8_t diffDelay,
+        q63_t * pState);
+
+  /**
+   * @brief Processing function for the Q31 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of blockSize/R+1 samples.
+   * @param[in]     blockSize  number of input samples to process, 1 or more.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_cic_decimate_q31(
+        arm_cic_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 CIC interpolator.
+   * @param[in,out] S          points to an instance of the Q15 CIC interpolator structure.
+   * @param[in]     numStages  number of comb and integrator stages, 1 to ARM_CIC_MAX_STAGES.
+   * @param[in]     R          interpolation factor.
+   * @param[in]     diffDelay  differential delay of the combs, usually 1 or 2.
+   * @param[in]     pState     points to the state buffer of ARM_CIC_STATE_LENGTH(numStages, diffDelay) samples.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is 0, <code>numStages</code> is too large or the
+   *                                                   gain <code>(R*diffDelay)^numStages/R</code> exceeds 2^16
+   */
+  arm_status arm_cic_interpolate_init_q15(
+        arm_cic_interpolate_instance_q15 * S,
+        uint8_t numStages,
+        uint16_t R,
+        uint8_t diffDelay,
+        q31_t * pState);
+
+  /**
+   * @brief Processing function for the Q15 CIC interpolator.
+   * @param[in,out] S          points to an instance of the Q15 CIC interpolator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of blockSize*R samples.
+   * @param[in]     blockSize  number of input samples to process.
+   */
+  void arm_cic_interpolate_q15(
+        arm_cic_interpolate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 CIC interpolator.
+   * @param[in,out] S          points to an instance of the Q31 CIC interpolator structure.
+   * @param[in]     numStages  number of comb and integrator stages, 1 to ARM_CIC_MAX_STAGES.
+   * @param[in]     R          interpolation factor.
+   * @param[in]     diffDelay  differential delay of the combs, usually 1 or 2.
+   * @param[in]     pState     points to the state buffer of ARM_CIC_STATE_LENGTH(numStages, diffDelay) samples.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is 0, <code>numStages</code> is too large or the
+   *                                                   gain <code>(R*diffDelay)^numStages/R</code> exceeds 2^32
+   */
+  arm_status arm_cic_interpolate_init_q31(
+        arm_cic_interpolate_instance_q31 * S,
+        uint8_t numStages,
+        uint16_t R,
+        uint8_t diffDelay,
+        q63_t * pState);
+
+  /**
+   * @brief Processing function for the Q31 CIC interpolator.
+   * @param[in,out] S          points to an instance of the Q31 CIC interpolator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of blockSize*R samples.
+   * @param[in]     blockSize  number of input samples to process.
+   */
+  void arm_cic_interpolate_q31(
+        arm_cic_interpolate_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Design of the FIR filter compensating the passband droop of a CIC filter.
+   * @param[in]  R          rate change factor of the CIC filter.
+   * @param[in]  numStages  number of stages of the CIC filter.
+   * @param[in]  diffDelay  differential delay of the CIC filter.
+   * @param[in]  numTaps    number of filter coefficients to compute.
+   * @param[in]  cutoff     end of the compensated passband, in cycles per sample at the low rate of the CIC filter, in (0, 0.5].
+   * @param[out] pCoeffs    points to the numTaps filter coefficients.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is 0 or <code>cutoff</code> is outside (0, 0.5]
+   */
+  arm_status arm_cic_compensate_design_f32(
+        uint16_t R,
+        uint8_t numStages,
+        uint8_t diffDelay,
+        uint16_t numTaps,
+        float32_t cutoff,
+        float32_t * pCoeffs);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3765,6 +4729,17 @@ arm_status arm_fir_decimate_init_f32(
     const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_stereo_df2T_instance_f32;
 
+  /**
+   * @brief Instance structure for the multi-channel floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;      /**< number of interleaved channels, filtered with the same coefficients. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_mc_df2T_instance_f32;
+
   /**
    * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
@@ -3804,6 +4779,20 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. numChannels channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of channel-interleaved input data.
+   * @param[out] pDst       points to the block of channel-interleaved output data
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
   /**
    * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in]  S          points to an instance of the filter data structure.
@@ -3818,7 +4807,8 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
-#if defined(ARM_MATH_NEON) 
+/* Not with ARM_MATH_X86_SIMD: the host keeps the coefficient layout of the Cortex-M builds */
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_X86_SIMD)
 void arm_biquad_cascade_df2T_compute_coefs_f32(
   arm_biquad_cascade_df2T_instance_f32 * S,
   uint8_t numStages,
@@ -3852,6 +4842,22 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pState);
 
 
+  /**
+   * @brief  Initialization function for the multi-channel floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_mc_df2T_init_f32(
+        arm_biquad_cascade_mc_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -4419,6 +5425,182 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         uint8_t postShift);
 
 
+  /**
+   * @brief Instance structure for the floating-point block LMS filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;    /**< number of coefficients in the filter. */
+          float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+          float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
+          float32_t mu;        /**< step size that controls filter coefficient updates. */
+  } arm_lms_block_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point block LMS filter.
+   * @param[in]  S          points to an instance of the floating-point block LMS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process, with one coefficient update.
+   */
+  void arm_lms_block_f32(
+  const arm_lms_block_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the floating-point block LMS filter.
+   * @param[in] S          points to an instance of the floating-point block LMS filter structure.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] pCoeffs    points to coefficient buffer.
+   * @param[in] pState     points to state buffer.
+   * @param[in] mu         step size that controls filter coefficient updates.
+   * @param[in] blockSize  largest number of samples processed per call.
+   */
+  void arm_lms_block_init_f32(
+        arm_lms_block_instance_f32 * S,
+        uint16_t numTaps,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t mu,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Length of the state buffer of the floating-point frequency-domain LMS filter, in samples.
+   *
+   * The previous input block, three transform buffers of 2*numTaps values and
+   * the power estimates of the numTaps+1 frequency bins.
+   */
+#define ARM_LMS_FD_STATE_LENGTH(numTaps) (9U * (numTaps) + 1U)
+
+  /**
+   * @brief Instance structure for the floating-point frequency-domain LMS filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;                  /**< number of coefficients in the filter, and samples processed per call. */
+          uint8_t powerValid;                /**< the power estimates have been set by a first block. */
+          float32_t mu;                      /**< normalized step size that controls filter coefficient updates. */
+          float32_t lambda;                  /**< forgetting factor of the power estimates. */
+          float32_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps. */
+          arm_rfft_fast_instance_f32 rfft;   /**< real FFT of length 2*numTaps. */
+          float32_t *pInput;                 /**< previous input block, numTaps values. */
+          float32_t *pSpectrum;              /**< spectrum of the last two input blocks, 2*numTaps values. */
+          float32_t *pScratch;               /**< transform input, 2*numTaps values. */
+          float32_t *pWork;                  /**< transform output, 2*numTaps values. */
+          float32_t *pPower;                 /**< power estimates of the bins 0 to numTaps, numTaps+1 values. */
+  } arm_lms_fd_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point frequency-domain LMS filter.
+   * @param[in,out] S     points to an instance of the floating-point frequency-domain LMS filter structure.
+   * @param[in]     pSrc  points to the block of numTaps input samples.
+   * @param[in]     pRef  points to the block of numTaps reference samples.
+   * @param[out]    pOut  points to the block of numTaps output samples.
+   * @param[out]    pErr  points to the block of numTaps error samples.
+   */
+  void arm_lms_fd_f32(
+        arm_lms_fd_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr);
+
+
+  /**
+   * @brief Initialization function for the floating-point frequency-domain LMS filter.
+   * @param[in,out] S        points to an instance of the floating-point frequency-domain LMS filter structure.
+   * @param[in]     numTaps  number of filter coefficients, a power of 2 between 16 and 2048.
+   * @param[in]     pCoeffs  points to coefficient buffer, in time reversed order as for arm_lms_f32().
+   * @param[in]     pState   points to the state buffer of ARM_LMS_FD_STATE_LENGTH(numTaps) samples.
+   * @param[in]     mu       normalized step size, between 0 and 1.
+   * @param[in]     lambda   forgetting factor of the power estimates, between 0 and 1.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is not a power of 2 between 16 and 2048
+   */
+  arm_status arm_lms_fd_init_f32(
+        arm_lms_fd_instance_f32 * S,
+        uint16_t numTaps,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t mu,
+        float32_t lambda);
+
+
+  /**
+   * @brief Length of the factor buffer of the floating-point RLS filter, in samples.
+   *
+   * The lower triangular square root of the inverse correlation matrix, packed
+   * by columns, and a work vector of numTaps values.
+   */
+#define ARM_RLS_FACTOR_LENGTH(numTaps) ((numTaps) * ((numTaps) + 3U) / 2U)
+
+  /**
+   * @brief Instance structure for the floating-point RLS filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;    /**< number of coefficients in the filter. */
+          float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+          float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
+          float32_t *pFactor;  /**< points to the factor array. The array is of length ARM_RLS_FACTOR_LENGTH(numTaps). */
+          float32_t lambda;    /**< forgetting factor. */
+  } arm_rls_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point RLS filter.
+   * @param[in]  S          points to an instance of the floating-point RLS filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[in]  pRef       points to the block of reference data.
+   * @param[out] pOut       points to the block of output data.
+   * @param[out] pErr       points to the block of error data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_rls_f32(
+  const arm_rls_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the floating-point RLS filter.
+   * @param[in] S          points to an instance of the floating-point RLS filter structure.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] pCoeffs    points to coefficient buffer.
+   * @param[in] pState     points to state buffer.
+   * @param[in] pFactor    points to the factor buffer of ARM_RLS_FACTOR_LENGTH(numTaps) samples.
+   * @param[in] lambda     forgetting factor, between 0 (excluded) and 1.
+   * @param[in] delta      regularization: the initial inverse correlation matrix is the identity divided by delta.
+   * @param[in] blockSize  largest number of samples processed per call.
+   * @return    execution status
+   *              - \ref ARM_MATH_SUCCESS        : Operation successful
+   *              - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0, <code>lambda</code> is not in (0, 1] or <code>delta</code> is not positive
+   */
+  arm_status arm_rls_init_f32(
+        arm_rls_instance_f32 * S,
+        uint16_t numTaps,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t * pFactor,
+        float32_t lambda,
+        float32_t delta,
+        uint32_t blockSize);
+
+
   /**
    * @brief Correlation of floating-point sequences.
    * @param[in]  pSrcA    points to the first input sequence.
@@ -0,0 +1,468 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_neon_x86.h
+ * Description:  Neon intrinsics used by the library, implemented with SSE4.2
+ *               for x86-64 hosts (ARM_MATH_X86_SIMD)
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: x86-64 hosts (SSE4.2, optionally AVX2)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The Neon versions of the DSP functions (ARM_MATH_NEON) are written with a
+ * small subset of the Neon intrinsics. This file provides that subset on
+ * x86-64 so that the same code runs on SSE4.2: 128-bit Neon vectors map to
+ * SSE registers, 64-bit ones to the low half of an SSE register.
+ *
+ * The vector types are GCC/Clang vector extensions, like the ones of
+ * <arm_neon.h>: lanes can be read with v[i] and vectors initialised with
+ * braces, as the library does.
+ *
+ * Every intrinsic gives the result of its Neon counterpart, lane by lane,
+ * except for:
+ * - vrsqrteq_f32: SSE estimate (12 bits) instead of the Neon one (8 bits),
+ *   only used as the seed of Newton-Raphson iterations,
+ * - vmaxq_f32, vpmax_f32 and vpmin_f32 with NaN inputs.
+ * vmla and vmls are separate multiply and add, as on Neon: the library must
+ * be built with -ffp-contract=off for the compiler not to fuse them when FMA
+ * is enabled.
+ *
+ * When the compiler targets AVX2 (-mavx2), ARM_MATH_X86_AVX2 is defined and
+ * the element-wise kernels also have an 8-lane loop.
+ */
+
+#ifndef _ARM_NEON_X86_H
+#define _ARM_NEON_X86_H
+
+#if !defined(__GNUC__)
+  #error "ARM_MATH_X86_SIMD requires GCC or Clang vector extensions"
+#endif
+
+#if !defined(__SSE4_2__)
+  #error "ARM_MATH_X86_SIMD requires SSE4.2 (-msse4.2)"
+#endif
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#if defined(__AVX2__)
+  #define ARM_MATH_X86_AVX2
+#endif
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+#define ARM_NEON_X86_INLINE static __inline__ __attribute__((__always_inline__))
+
+/* Vector types */
+typedef float    float32x4_t __attribute__((vector_size(16)));
+typedef float    float32x2_t __attribute__((vector_size(8)));
+typedef int32_t  int32x4_t   __attribute__((vector_size(16)));
+typedef uint32_t uint32x4_t  __attribute__((vector_size(16)));
+typedef uint32_t uint32x2_t  __attribute__((vector_size(8)));
+typedef int16_t  int16x8_t   __attribute__((vector_size(16)));
+typedef int16_t  int16x4_t   __attribute__((vector_size(8)));
+typedef int8_t   int8x16_t   __attribute__((vector_size(16)));
+typedef int8_t   int8x8_t    __attribute__((vector_size(8)));
+
+typedef struct
+{
+  float32x4_t val[2];
+} float32x4x2_t;
+
+typedef struct
+{
+  float32x2_t val[2];
+} float32x2x2_t;
+
+/* Conversions between the Neon types and the SSE registers */
+#define ARM_NEON_X86_PS(v)   ((__m128)(v))
+#define ARM_NEON_X86_SI(v)   ((__m128i)(v))
+#define ARM_NEON_X86_LO64(v) _mm_cvtsi64_si128((long long)(v))
+
+/* Loads and stores */
+ARM_NEON_X86_INLINE float32x4_t vld1q_f32(const float * p)
+{
+  return (float32x4_t)_mm_loadu_ps(p);
+}
+
+ARM_NEON_X86_INLINE float32x2_t vld1_f32(const float * p)
+{
+  return (float32x2_t){ p[0], p[1] };
+}
+
+ARM_NEON_X86_INLINE uint32x2_t vld1_u32(const uint32_t * p)
+{
+  return (uint32x2_t){ p[0], p[1] };
+}
+
+ARM_NEON_X86_INLINE int8x16_t vld1q_s8(const int8_t * p)
+{
+  return (int8x16_t)_mm_loadu_si128((const __m128i *)p);
+}
+
+ARM_NEON_X86_INLINE int16x8_t vld1q_s16(const int16_t * p)
+{
+  return (int16x8_t)_mm_loadu_si128((const __m128i *)p);
+}
+
+ARM_NEON_X86_INLINE int32x4_t vld1q_s32(const int32_t * p)
+{
+  return (int32x4_t)_mm_loadu_si128((const __m128i *)p);
+}
+
+ARM_NEON_X86_INLINE void vst1q_f32(float * p, float32x4_t v)
+{
+  _mm_storeu_ps(p, ARM_NEON_X86_PS(v));
+}
+
+ARM_NEON_X86_INLINE void vst1q_s32(int32_t * p, int32x4_t v)
+{
+  _mm_storeu_si128((__m128i *)p, ARM_NEON_X86_SI(v));
+}
+
+ARM_NEON_X86_INLINE void vst1_u32(uint32_t * p, uint32x2_t v)
+{
+  _mm_storel_epi64((__m128i *)p, ARM_NEON_X86_LO64(v));
+}
+
+ARM_NEON_X86_INLINE void vst1_s16(int16_t * p, int16x4_t v)
+{
+  _mm_storel_epi64((__m128i *)p, ARM_NEON_X86_LO64(v));
+}
+
+ARM_NEON_X86_INLINE void vst1_s8(int8_t * p, int8x8_t v)
+{
+  _mm_storel_epi64((__m128i *)p, ARM_NEON_X86_LO64(v));
+}
+
+/* De-interleaving load and interleaving store of two vectors (complex data) */
+ARM_NEON_X86_INLINE float32x4x2_t vld2q_f32(const float * p)
+{
+  __m128 lo = _mm_loadu_ps(p);
+  __m128 hi = _mm_loadu_ps(p + 4);
+  float32x4x2_t r;
+
+  r.val[0] = (float32x4_t)_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+  r.val[1] = (float32x4_t)_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+  return r;
+}
+
+ARM_NEON_X86_INLINE void vst2q_f32(float * p, float32x4x2_t v)
+{
+  _mm_storeu_ps(p,     _mm_unpacklo_ps(ARM_NEON_X86_PS(v.val[0]), ARM_NEON_X86_PS(v.val[1])));
+  _mm_storeu_ps(p + 4, _mm_unpackhi_ps(ARM_NEON_X86_PS(v.val[0]), ARM_NEON_X86_PS(v.val[1])));
+}
+
+/* Duplication, halves and combination */
+ARM_NEON_X86_INLINE float32x4_t vdupq_n_f32(float x)
+{
+  return (float32x4_t)_mm_set1_ps(x);
+}
+
+ARM_NEON_X86_INLINE float32x2_t vdup_n_f32(float x)
+{
+  return (float32x2_t){ x, x };
+}
+
+ARM_NEON_X86_INLINE float32x2_t vget_low_f32(float32x4_t v)
+{
+  return (float32x2_t){ v[0], v[1] };
+}
+
+ARM_NEON_X86_INLINE float32x2_t vget_high_f32(float32x4_t v)
+{
+  return (float32x2_t){ v[2], v[3] };
+}
+
+ARM_NEON_X86_INLINE float32x4_t vcombine_f32(float32x2_t lo, float32x2_t hi)
+{
+  return (float32x4_t){ lo[0], lo[1], hi[0], hi[1] };
+}
+
+ARM_NEON_X86_INLINE uint32x2_t vget_low_u32(uint32x4_t v)
+{
+  return (uint32x2_t)_mm_cvtsi128_si64(ARM_NEON_X86_SI(v));
+}
+
+ARM_NEON_X86_INLINE uint32x2_t vget_high_u32(uint32x4_t v)
+{
+  return (uint32x2_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(ARM_NEON_X86_SI(v), ARM_NEON_X86_SI(v)));
+}
+
+ARM_NEON_X86_INLINE int16x4_t vget_low_s16(int16x8_t v)
+{
+  return (int16x4_t)_mm_cvtsi128_si64(ARM_NEON_X86_SI(v));
+}
+
+ARM_NEON_X86_INLINE int16x4_t vget_high_s16(int16x8_t v)
+{
+  return (int16x4_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(ARM_NEON_X86_SI(v), ARM_NEON_X86_SI(v)));
+}
+
+ARM_NEON_X86_INLINE int16x8_t vcombine_s16(int16x4_t lo, int16x4_t hi)
+{
+  return (int16x8_t)_mm_set_epi64x((long long)hi, (long long)lo);
+}
+
+ARM_NEON_X86_INLINE int8x8_t vget_low_s8(int8x16_t v)
+{
+  return (int8x8_t)_mm_cvtsi128_si64(ARM_NEON_X86_SI(v));
+}
+
+ARM_NEON_X86_INLINE int8x8_t vget_high_s8(int8x16_t v)
+{
+  return (int8x8_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(ARM_NEON_X86_SI(v), ARM_NEON_X86_SI(v)));
+}
+
+/* Permutations */
+
+/* Lanes n to 3 of a followed by lanes 0 to n - 1 of b */
+ARM_NEON_X86_INLINE float32x4_t vextq_f32(float32x4_t a, float32x4_t b, const int n)
+{
+  switch (n)
+  {
+    case 1:
+      return (float32x4_t)_mm_castsi128_ps(_mm_alignr_epi8(ARM_NEON_X86_SI(b), ARM_NEON_X86_SI(a), 4));
+    case 2:
+      return (float32x4_t)_mm_castsi128_ps(_mm_alignr_epi8(ARM_NEON_X86_SI(b), ARM_NEON_X86_SI(a), 8));
+    case 3:
+      return (float32x4_t)_mm_castsi128_ps(_mm_alignr_epi8(ARM_NEON_X86_SI(b), ARM_NEON_X86_SI(a), 12));
+    default:
+      return a;
+  }
+}
+
+ARM_NEON_X86_INLINE float32x2_t vext_f32(float32x2_t a, float32x2_t b, const int n)
+{
+  return (n == 0) ? a : (float32x2_t){ a[1], b[0] };
+}
+
+ARM_NEON_X86_INLINE float32x4x2_t vzipq_f32(float32x4_t a, float32x4_t b)
+{
+  float32x4x2_t r;
+
+  r.val[0] = (float32x4_t)_mm_unpacklo_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b));
+  r.val[1] = (float32x4_t)_mm_unpackhi_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b));
+  return r;
+}
+
+/* { a[0], b[0], a[2], b[2] } and { a[1], b[1], a[3], b[3] } */
+ARM_NEON_X86_INLINE float32x4x2_t vtrnq_f32(float32x4_t a, float32x4_t b)
+{
+  float32x4x2_t r;
+
+  r.val[0] = (float32x4_t)_mm_shuffle_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b), _MM_SHUFFLE(2, 0, 2, 0));
+  r.val[1] = (float32x4_t)_mm_shuffle_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b), _MM_SHUFFLE(3, 1, 3, 1));
+  r.val[0] = (float32x4_t)_mm_shuffle_ps(ARM_NEON_X86_PS(r.val[0]), ARM_NEON_X86_PS(r.val[0]), _MM_SHUFFLE(3, 1, 2, 0));
+  r.val[1] = (float32x4_t)_mm_shuffle_ps(ARM_NEON_X86_PS(r.val[1]), ARM_NEON_X86_PS(r.val[1]), _MM_SHUFFLE(3, 1, 2, 0));
+  return r;
+}
+
+ARM_NEON_X86_INLINE float32x4_t vrev64q_f32(float32x4_t v)
+{
+  return (float32x4_t)_mm_shuffle_ps(ARM_NEON_X86_PS(v), ARM_NEON_X86_PS(v), _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+ARM_NEON_X86_INLINE float32x2_t vrev64_f32(float32x2_t v)
+{
+  return (float32x2_t){ v[1], v[0] };
+}
+
+/* Arithmetic */
+ARM_NEON_X86_INLINE float32x4_t vaddq_f32(float32x4_t a, float32x4_t b)
+{
+  return (float32x4_t)_mm_add_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b));
+}
+
+ARM_NEON_X86_INLINE float32x4_t vsubq_f32(float32x4_t a, float32x4_t b)
+{
+  return (float32x4_t)_mm_sub_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b));
+}
+
+ARM_NEON_X86_INLINE float32x4_t vmulq_f32(float32x4_t a, float32x4_t b)
+{
+  return (float32x4_t)_mm_mul_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b));
+}
+
+ARM_NEON_X86_INLINE float32x2_t vmul_f32(float32x2_t a, float32x2_t b)
+{
+  return a * b;
+}
+
+/* a + b * c */
+ARM_NEON_X86_INLINE float32x4_t vmlaq_f32(float32x4_t a, float32x4_t b, float32x4_t c)
+{
+  return (float32x4_t)_mm_add_ps(ARM_NEON_X86_PS(a), _mm_mul_ps(ARM_NEON_X86_PS(b), ARM_NEON_X86_PS(c)));
+}
+
+ARM_NEON_X86_INLINE float32x4_t vmlaq_n_f32(float32x4_t a, float32x4_t b, float c)
+{
+  return (float32x4_t)_mm_add_ps(ARM_NEON_X86_PS(a), _mm_mul_ps(ARM_NEON_X86_PS(b), _mm_set1_ps(c)));
+}
+
+ARM_NEON_X86_INLINE float32x2_t vmla_f32(float32x2_t a, float32x2_t b, float32x2_t c)
+{
+  return a + b * c;
+}
+
+/* a - b * c */
+ARM_NEON_X86_INLINE float32x4_t vmlsq_f32(float32x4_t a, float32x4_t b, float32x4_t c)
+{
+  return (float32x4_t)_mm_sub_ps(ARM_NEON_X86_PS(a), _mm_mul_ps(ARM_NEON_X86_PS(b), ARM_NEON_X86_PS(c)));
+}
+
+ARM_NEON_X86_INLINE float32x4_t vnegq_f32(float32x4_t v)
+{
+  return (float32x4_t)_mm_xor_ps(ARM_NEON_X86_PS(v), _mm_set1_ps(-0.0f));
+}
+
+ARM_NEON_X86_INLINE float32x4_t vabsq_f32(float32x4_t v)
+{
+  return (float32x4_t)_mm_andnot_ps(_mm_set1_ps(-0.0f), ARM_NEON_X86_PS(v));
+}
+
+ARM_NEON_X86_INLINE float32x4_t vmaxq_f32(float32x4_t a, float32x4_t b)
+{
+  return (float32x4_t)_mm_max_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b));
+}
+
+ARM_NEON_X86_INLINE uint32x4_t vaddq_u32(uint32x4_t a, uint32x4_t b)
+{
+  return (uint32x4_t)_mm_add_epi32(ARM_NEON_X86_SI(a), ARM_NEON_X86_SI(b));
+}
+
+/* Pairwise operations: { op(a[0], a[1]), op(b[0], b[1]) } */
+ARM_NEON_X86_INLINE float32x2_t vpadd_f32(float32x2_t a, float32x2_t b)
+{
+  return (float32x2_t){ a[0] + a[1], b[0] + b[1] };
+}
+
+ARM_NEON_X86_INLINE float vpadds_f32(float32x2_t a)
+{
+  return a[0] + a[1];
+}
+
+ARM_NEON_X86_INLINE float32x2_t vpmax_f32(float32x2_t a, float32x2_t b)
+{
+  return (float32x2_t){ (a[0] > a[1]) ? a[0] : a[1], (b[0] > b[1]) ? b[0] : b[1] };
+}
+
+ARM_NEON_X86_INLINE float32x2_t vpmin_f32(float32x2_t a, float32x2_t b)
+{
+  return (float32x2_t){ (a[0] < a[1]) ? a[0] : a[1], (b[0] < b[1]) ? b[0] : b[1] };
+}
+
+ARM_NEON_X86_INLINE uint32x2_t vpmin_u32(uint32x2_t a, uint32x2_t b)
+{
+  return (uint32x2_t){ (a[0] < a[1]) ? a[0] : a[1], (b[0] < b[1]) ? b[0] : b[1] };
+}
+
+/* Comparisons (all ones in the lanes where true) and bitwise select */
+ARM_NEON_X86_INLINE uint32x4_t vcgtq_f32(float32x4_t a, float32x4_t b)
+{
+  return (uint32x4_t)_mm_castps_si128(_mm_cmpgt_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b)));
+}
+
+ARM_NEON_X86_INLINE uint32x4_t vcltq_f32(float32x4_t a, float32x4_t b)
+{
+  return (uint32x4_t)_mm_castps_si128(_mm_cmplt_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b)));
+}
+
+ARM_NEON_X86_INLINE uint32x4_t vceqq_f32(float32x4_t a, float32x4_t b)
+{
+  return (uint32x4_t)_mm_castps_si128(_mm_cmpeq_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b)));
+}
+
+/* Bits of a where mask is set, bits of b elsewhere */
+ARM_NEON_X86_INLINE float32x4_t vbslq_f32(uint32x4_t mask, float32x4_t a, float32x4_t b)
+{
+  __m128 m = _mm_castsi128_ps(ARM_NEON_X86_SI(mask));
+
+  return (float32x4_t)_mm_or_ps(_mm_and_ps(m, ARM_NEON_X86_PS(a)), _mm_andnot_ps(m, ARM_NEON_X86_PS(b)));
+}
+
+ARM_NEON_X86_INLINE uint32x4_t vbslq_u32(uint32x4_t mask, uint32x4_t a, uint32x4_t b)
+{
+  return (uint32x4_t)_mm_or_si128(_mm_and_si128(ARM_NEON_X86_SI(mask), ARM_NEON_X86_SI(a)),
+                                  _mm_andnot_si128(ARM_NEON_X86_SI(mask), ARM_NEON_X86_SI(b)));
+}
+
+/* Reciprocal square root estimate and Newton-Raphson step (3 - a * b) / 2 */
+ARM_NEON_X86_INLINE float32x4_t vrsqrteq_f32(float32x4_t v)
+{
+  return (float32x4_t)_mm_rsqrt_ps(ARM_NEON_X86_PS(v));
+}
+
+ARM_NEON_X86_INLINE float32x4_t vrsqrtsq_f32(float32x4_t a, float32x4_t b)
+{
+  __m128 p = _mm_mul_ps(ARM_NEON_X86_PS(a), ARM_NEON_X86_PS(b));
+
+  return (float32x4_t)_mm_mul_ps(_mm_sub_ps(_mm_set1_ps(3.0f), p), _mm_set1_ps(0.5f));
+}
+
+/* Fixed-point conversions with n fractional bits */
+
+/* Rounded toward zero and saturated, NaN giving 0, as vcvt on Neon */
+ARM_NEON_X86_INLINE int32x4_t vcvtq_n_s32_f32(float32x4_t v, const int n)
+{
+  __m128 scaled = _mm_mul_ps(ARM_NEON_X86_PS(v), _mm_set1_ps((float)(1ULL << n)));
+  __m128i r = _mm_cvttps_epi32(scaled);
+
+  /* cvttps gives 0x80000000 out of range: positive overflows become 0x7FFFFFFF */
+  r = _mm_xor_si128(r, _mm_castps_si128(_mm_cmpge_ps(scaled, _mm_set1_ps(2147483648.0f))));
+  return (int32x4_t)_mm_and_si128(r, _mm_castps_si128(_mm_cmpord_ps(scaled, scaled)));
+}
+
+ARM_NEON_X86_INLINE float32x4_t vcvtq_n_f32_s32(int32x4_t v, const int n)
+{
+  return (float32x4_t)_mm_mul_ps(_mm_cvtepi32_ps(ARM_NEON_X86_SI(v)), _mm_set1_ps(1.0f / (float)(1ULL << n)));
+}
+
+/* Widening and saturating narrowing of integers */
+ARM_NEON_X86_INLINE int32x4_t vmovl_s16(int16x4_t v)
+{
+  return (int32x4_t)_mm_cvtepi16_epi32(ARM_NEON_X86_LO64(v));
+}
+
+ARM_NEON_X86_INLINE int16x8_t vmovl_s8(int8x8_t v)
+{
+  return (int16x8_t)_mm_cvtepi8_epi16(ARM_NEON_X86_LO64(v));
+}
+
+ARM_NEON_X86_INLINE int16x4_t vqmovn_s32(int32x4_t v)
+{
+  return (int16x4_t)_mm_cvtsi128_si64(_mm_packs_epi32(ARM_NEON_X86_SI(v), ARM_NEON_X86_SI(v)));
+}
+
+ARM_NEON_X86_INLINE int8x8_t vqmovn_s16(int16x8_t v)
+{
+  return (int8x8_t)_mm_cvtsi128_si64(_mm_packs_epi16(ARM_NEON_X86_SI(v), ARM_NEON_X86_SI(v)));
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_NEON_X86_H */
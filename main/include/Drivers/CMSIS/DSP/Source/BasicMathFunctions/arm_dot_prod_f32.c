@@ -74,26 +74,47 @@ void arm_dot_prod_f32(
     float32x4_t res;
     float32x4_t accum = vdupq_n_f32(0);    
 
+#if defined(ARM_MATH_X86_AVX2)
+    __m256 accum8 = _mm256_setzero_ps();
+
+    /* Compute 8 products at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U)
+    {
+        accum8 = _mm256_add_ps(accum8, _mm256_mul_ps(_mm256_loadu_ps(pSrcA), _mm256_loadu_ps(pSrcB)));
+
+        /* Increment pointers */
+        pSrcA += 8;
+        pSrcB += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Fold the 8 partial sums into the 4 of the loop below */
+    accum = (float32x4_t)_mm_add_ps(_mm256_castps256_ps128(accum8), _mm256_extractf128_ps(accum8, 1));
+
+    /* At most 7 samples left */
+    blockSize &= 0x7U;
+#endif /* #if defined(ARM_MATH_X86_AVX2) */
+
     /* Compute 4 outputs at a time */
     blkCnt = blockSize >> 2U;
 
-    vec1 = vld1q_f32(pSrcA);
-    vec2 = vld1q_f32(pSrcB);
-
     while (blkCnt > 0U)
     {
         /* C = A[0]*B[0] + A[1]*B[1] + A[2]*B[2] + ... + A[blockSize-1]*B[blockSize-1] */
         /* Calculate dot product and then store the result in a temporary buffer. */
-        
-	accum = vmlaq_f32(accum, vec1, vec2);
-	
+        vec1 = vld1q_f32(pSrcA);
+        vec2 = vld1q_f32(pSrcB);
+
+        accum = vmlaq_f32(accum, vec1, vec2);
+
         /* Increment pointers */
         pSrcA += 4;
         pSrcB += 4; 
 
-        vec1 = vld1q_f32(pSrcA);
-        vec2 = vld1q_f32(pSrcB);
-        
         /* Decrement the loop counter */
         blkCnt--;
     }
@@ -71,6 +71,28 @@ void arm_mult_f32(
     float32x4_t vec2;
     float32x4_t res;
 
+#if defined(ARM_MATH_X86_AVX2)
+    /* Compute 8 outputs at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A * B */
+        _mm256_storeu_ps(pDst, _mm256_mul_ps(_mm256_loadu_ps(pSrcA), _mm256_loadu_ps(pSrcB)));
+
+        /* Increment pointers */
+        pSrcA += 8;
+        pSrcB += 8;
+        pDst += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* At most 7 samples left */
+    blockSize &= 0x7U;
+#endif /* #if defined(ARM_MATH_X86_AVX2) */
+
     /* Compute 4 outputs at a time */
     blkCnt = blockSize >> 2U;
 
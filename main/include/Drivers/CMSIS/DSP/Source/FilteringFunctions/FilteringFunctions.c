@@ -40,8 +40,23 @@
 #include "arm_biquad_cascade_df2T_f64.c"
 #include "arm_biquad_cascade_df2T_init_f32.c"
 #include "arm_biquad_cascade_df2T_init_f64.c"
+#include "arm_biquad_cascade_mc_df1_f32.c"
+#include "arm_biquad_cascade_mc_df1_init_f32.c"
+#include "arm_biquad_cascade_mc_df1_init_q31.c"
+#include "arm_biquad_cascade_mc_df1_q31.c"
+#include "arm_biquad_cascade_mc_df2T_f32.c"
+#include "arm_biquad_cascade_mc_df2T_init_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
+#include "arm_cic_compensate_design_f32.c"
+#include "arm_cic_decimate_init_q15.c"
+#include "arm_cic_decimate_init_q31.c"
+#include "arm_cic_decimate_q15.c"
+#include "arm_cic_decimate_q31.c"
+#include "arm_cic_interpolate_init_q15.c"
+#include "arm_cic_interpolate_init_q31.c"
+#include "arm_cic_interpolate_q15.c"
+#include "arm_cic_interpolate_q31.c"
 #include "arm_conv_f32.c"
 #include "arm_conv_fast_opt_q15.c"
 #include "arm_conv_fast_q15.c"
@@ -69,6 +84,8 @@
 #include "arm_correlate_q15.c"
 #include "arm_correlate_q31.c"
 #include "arm_correlate_q7.c"
+#include "arm_farrow_f32.c"
+#include "arm_farrow_init_f32.c"
 #include "arm_fir_decimate_f32.c"
 #include "arm_fir_decimate_fast_q15.c"
 #include "arm_fir_decimate_fast_q31.c"
@@ -80,6 +97,8 @@
 #include "arm_fir_f32.c"
 #include "arm_fir_fast_q15.c"
 #include "arm_fir_fast_q31.c"
+#include "arm_fir_fft_f32.c"
+#include "arm_fir_fft_init_f32.c"
 #include "arm_fir_init_f32.c"
 #include "arm_fir_init_q15.c"
 #include "arm_fir_init_q31.c"
@@ -99,6 +118,13 @@
 #include "arm_fir_q15.c"
 #include "arm_fir_q31.c"
 #include "arm_fir_q7.c"
+#include "arm_fir_resample_design_f32.c"
+#include "arm_fir_resample_f32.c"
+#include "arm_fir_resample_init_f32.c"
+#include "arm_fir_resample_init_q15.c"
+#include "arm_fir_resample_init_q31.c"
+#include "arm_fir_resample_q15.c"
+#include "arm_fir_resample_q31.c"
 #include "arm_fir_sparse_f32.c"
 #include "arm_fir_sparse_init_f32.c"
 #include "arm_fir_sparse_init_q15.c"
@@ -113,7 +139,11 @@
 #include "arm_iir_lattice_init_q31.c"
 #include "arm_iir_lattice_q15.c"
 #include "arm_iir_lattice_q31.c"
+#include "arm_lms_block_f32.c"
+#include "arm_lms_block_init_f32.c"
 #include "arm_lms_f32.c"
+#include "arm_lms_fd_f32.c"
+#include "arm_lms_fd_init_f32.c"
 #include "arm_lms_init_f32.c"
 #include "arm_lms_init_q15.c"
 #include "arm_lms_init_q31.c"
@@ -125,3 +155,5 @@
 #include "arm_lms_norm_q31.c"
 #include "arm_lms_q15.c"
 #include "arm_lms_q31.c"
+#include "arm_rls_f32.c"
+#include "arm_rls_init_f32.c"
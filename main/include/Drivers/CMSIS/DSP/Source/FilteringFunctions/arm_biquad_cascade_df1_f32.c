@@ -191,9 +191,12 @@ void arm_biquad_cascade_df1_f32(
 
   while (stage > 0U)
   {
+    /* Reading the pState values {x[n-1], x[n-2], y[n-1], y[n-2]}:
+       Xn = {0, 0, x[n-2], x[n-1]} and Yn = {y[n-2], y[n-1]}, as stored at the end of the stage */
+    Xn = vcombine_f32(vdup_n_f32(0.0f), vrev64_f32(vld1_f32(pState)));
+    Yn = vrev64_f32(vld1_f32(pState + 2));
+
     /* Reading the coefficients */
-    Xn = vld1q_f32(pState);
-    Yn = vld1_f32(pState + 2);
 
     b = vld1q_f32(pCoeffs);
     b = vrev64q_f32(b);  
@@ -204,8 +207,6 @@ void arm_biquad_cascade_df1_f32(
     b[0] = 0.0;
     pCoeffs += 5;
     
-    /* Reading the pState values */
-   
     /* Apply loop unrolling and compute 4 output values simultaneously. */
     /*      The variable acc hold output values that are being computed:
      *
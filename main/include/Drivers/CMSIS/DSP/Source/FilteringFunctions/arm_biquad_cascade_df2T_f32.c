@@ -46,7 +46,8 @@
   @return        none
  */
 
-#if defined(ARM_MATH_NEON) 
+/* Not with ARM_MATH_X86_SIMD: the host keeps the coefficient layout of the Cortex-M builds */
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_X86_SIMD)
 
 void arm_biquad_cascade_df2T_f32(
   const arm_biquad_cascade_df2T_instance_f32 * S,
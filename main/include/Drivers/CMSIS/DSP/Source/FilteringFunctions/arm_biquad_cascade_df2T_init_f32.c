@@ -87,7 +87,8 @@
                    The state variables are updated after each block of data is processed; the coefficients are untouched.
  */
 
-#if defined(ARM_MATH_NEON) 
+/* Not with ARM_MATH_X86_SIMD: the host keeps the coefficient layout of the Cortex-M builds */
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_X86_SIMD)
 /*
 
 Must be called after initializing the biquad instance.
@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df1_f32.c
+ * Description:  Processing function for the multi-channel floating-point Biquad cascade DirectFormI(DF1) filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/* One channel of one stage, with the operations of the scalar arm_biquad_cascade_df1_f32().
+   pState points to the x[n-1] of the channel, its other state variables are numChannels apart. */
+static void arm_biquad_mc_df1_channel_f32(
+  const float32_t * pCoeffs,
+        float32_t * pState,
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint32_t blockSize)
+{
+  float32_t acc;                                 /* Accumulator */
+  float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+  float32_t Xn1, Xn2, Yn1, Yn2;                  /* Filter state variables */
+  float32_t Xn;                                  /* Temporary input */
+  uint32_t sample;                               /* Loop counter */
+
+  b0 = pCoeffs[0];
+  b1 = pCoeffs[1];
+  b2 = pCoeffs[2];
+  a1 = pCoeffs[3];
+  a2 = pCoeffs[4];
+
+  Xn1 = pState[0];
+  Xn2 = pState[numChannels];
+  Yn1 = pState[2U * numChannels];
+  Yn2 = pState[3U * numChannels];
+
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    Xn = *pIn;
+
+    /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+
+    *pOut = acc;
+
+    Xn2 = Xn1;
+    Xn1 = Xn;
+    Yn2 = Yn1;
+    Yn1 = acc;
+
+    pIn += numChannels;
+    pOut += numChannels;
+  }
+
+  pState[0] = Xn1;
+  pState[numChannels] = Xn2;
+  pState[2U * numChannels] = Yn1;
+  pState[3U * numChannels] = Yn2;
+}
+
+/**
+  @brief         Processing function for the multi-channel floating-point Biquad cascade filter.
+  @param[in]     S          points to an instance of the multi-channel floating-point Biquad cascade structure
+  @param[in]     pSrc       points to the block of channel-interleaved input data
+  @param[out]    pDst       points to the block of channel-interleaved output data
+  @param[in]     blockSize  number of samples to process per channel
+  @return        none
+
+  @par           Details
+                   Sample <code>n</code> of channel <code>c</code> is <code>pSrc[n*numChannels + c]</code>,
+                   and all the channels are filtered with the same coefficients in a single call, instead of
+                   one call of arm_biquad_cascade_df1_f32() per channel on de-interleaved buffers.
+                   <code>pSrc</code> and <code>pDst</code> hold <code>blockSize*numChannels</code> values and
+                   may be the same buffer.
+  @par
+                   Each stage keeps the state of a group of channels in registers over the whole block: 8
+                   channels at a time with ARM_MATH_X86_AVX2, 4 with Neon (and ARM_MATH_X86_SIMD), then the
+                   remaining channels one at a time. Each channel goes through the operations of the scalar
+                   arm_biquad_cascade_df1_f32(), in the same order: its output is bit-exact with that of the
+                   single channel filter, as long as the compiler does not fuse the multiply-accumulates of
+                   one of them (-ffp-contract=off). The Neon version of arm_biquad_cascade_df1_f32() adds the
+                   5 terms in another order, and may differ in the last bit.
+ */
+void arm_biquad_cascade_mc_df1_f32(
+  const arm_biquad_casd_mc_df1_inst_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pState = S->pState;                 /* State of the current stage */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficients of the current stage */
+        uint32_t numChannels = S->numChannels;         /* Distance between two samples of a channel */
+        uint32_t stage = S->numStages;                 /* Loop counter */
+        uint32_t ch;                                   /* First channel of the current group */
+
+#if defined(ARM_MATH_NEON)
+  const float32_t *pX;                                 /* Input of the current group */
+        float32_t *pY;                                 /* Output of the current group */
+        float32x4_t b0, b1, b2, a1, a2;                /* Filter coefficients */
+        float32x4_t Xn1, Xn2, Yn1, Yn2;                /* State variables of 4 channels */
+        float32x4_t Xn, acc;
+        uint32_t sample;
+#endif
+
+  while (stage > 0U)
+  {
+    ch = 0U;
+
+#if defined(ARM_MATH_X86_AVX2)
+    {
+      __m256 vb0 = _mm256_set1_ps(pCoeffs[0]);
+      __m256 vb1 = _mm256_set1_ps(pCoeffs[1]);
+      __m256 vb2 = _mm256_set1_ps(pCoeffs[2]);
+      __m256 va1 = _mm256_set1_ps(pCoeffs[3]);
+      __m256 va2 = _mm256_set1_ps(pCoeffs[4]);
+      __m256 vXn1, vXn2, vYn1, vYn2, vXn, vacc;
+
+      /* 8 channels at a time */
+      for (; ch + 8U <= numChannels; ch += 8U)
+      {
+        vXn1 = _mm256_loadu_ps(pState + ch);
+        vXn2 = _mm256_loadu_ps(pState + numChannels + ch);
+        vYn1 = _mm256_loadu_ps(pState + 2U * numChannels + ch);
+        vYn2 = _mm256_loadu_ps(pState + 3U * numChannels + ch);
+        pX = pIn + ch;
+        pY = pDst + ch;
+
+        for (sample = 0U; sample < blockSize; sample++)
+        {
+          vXn = _mm256_loadu_ps(pX);
+
+          /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+          vacc = _mm256_mul_ps(vb0, vXn);
+          vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vb1, vXn1));
+          vacc = _mm256_add_ps(vacc, _mm256_mul_ps(vb2, vXn2));
+          vacc = _mm256_add_ps(vacc, _mm256_mul_ps(va1, vYn1));
+          vacc = _mm256_add_ps(vacc, _mm256_mul_ps(va2, vYn2));
+
+          _mm256_storeu_ps(pY, vacc);
+
+          vXn2 = vXn1;
+          vXn1 = vXn;
+          vYn2 = vYn1;
+          vYn1 = vacc;
+
+          pX += numChannels;
+          pY += numChannels;
+        }
+
+        _mm256_storeu_ps(pState + ch, vXn1);
+        _mm256_storeu_ps(pState + numChannels + ch, vXn2);
+        _mm256_storeu_ps(pState + 2U * numChannels + ch, vYn1);
+        _mm256_storeu_ps(pState + 3U * numChannels + ch, vYn2);
+      }
+    }
+#endif /* #if defined(ARM_MATH_X86_AVX2) */
+
+#if defined(ARM_MATH_NEON)
+    b0 = vdupq_n_f32(pCoeffs[0]);
+    b1 = vdupq_n_f32(pCoeffs[1]);
+    b2 = vdupq_n_f32(pCoeffs[2]);
+    a1 = vdupq_n_f32(pCoeffs[3]);
+    a2 = vdupq_n_f32(pCoeffs[4]);
+
+    /* 4 channels at a time */
+    for (; ch + 4U <= numChannels; ch += 4U)
+    {
+      Xn1 = vld1q_f32(pState + ch);
+      Xn2 = vld1q_f32(pState + numChannels + ch);
+      Yn1 = vld1q_f32(pState + 2U * numChannels + ch);
+      Yn2 = vld1q_f32(pState + 3U * numChannels + ch);
+      pX = pIn + ch;
+      pY = pDst + ch;
+
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+        Xn = vld1q_f32(pX);
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = vmulq_f32(b0, Xn);
+        acc = vmlaq_f32(acc, b1, Xn1);
+        acc = vmlaq_f32(acc, b2, Xn2);
+        acc = vmlaq_f32(acc, a1, Yn1);
+        acc = vmlaq_f32(acc, a2, Yn2);
+
+        vst1q_f32(pY, acc);
+
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = acc;
+
+        pX += numChannels;
+        pY += numChannels;
+      }
+
+      vst1q_f32(pState + ch, Xn1);
+      vst1q_f32(pState + numChannels + ch, Xn2);
+      vst1q_f32(pState + 2U * numChannels + ch, Yn1);
+      vst1q_f32(pState + 3U * numChannels + ch, Yn2);
+    }
+#endif /* #if defined(ARM_MATH_NEON) */
+
+    /* Remaining channels, one at a time */
+    for (; ch < numChannels; ch++)
+    {
+      arm_biquad_mc_df1_channel_f32(pCoeffs, pState + ch, pIn + ch, pDst + ch, numChannels, blockSize);
+    }
+
+    pCoeffs += 5U;
+    pState += 4U * numChannels;
+
+    /* The first stage goes from the input buffer to the output buffer. */
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    stage--;
+  }
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df1_q31.c
+ * Description:  Processing function for the multi-channel Q31 Biquad cascade filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/**
+  @brief         Processing function for the multi-channel Q31 Biquad cascade filter.
+  @param[in]     S          points to an instance of the multi-channel Q31 Biquad cascade structure
+  @param[in]     pSrc       points to the block of channel-interleaved input data
+  @param[out]    pDst       points to the block of channel-interleaved output data
+  @param[in]     blockSize  number of samples to process per channel
+  @return        none
+
+  @par           Details
+                   Sample <code>n</code> of channel <code>c</code> is <code>pSrc[n*numChannels + c]</code>,
+                   and all the channels are filtered with the same coefficients. <code>pSrc</code> and
+                   <code>pDst</code> hold <code>blockSize*numChannels</code> values and may be the same buffer.
+  @par
+                   Each stage processes the channels two at a time, their state in registers over the
+                   whole block: the two recursions are independent and their 64-bit multiply-accumulates
+                   overlap. Neon has only two 32x32 to 64-bit lanes per instruction, and SSE4.2 no 64-bit
+                   arithmetic shift, so there is no vector version. The output of each channel is bit-exact
+                   with that of arm_biquad_cascade_df1_q31() applied to the channel alone.
+
+  @par           Scaling and Overflow Behavior
+                   As arm_biquad_cascade_df1_q31(): the products are accumulated in a 64-bit accumulator
+                   in 2.62 format, which is shifted by <code>31 - postShift</code> bits and truncated to
+                   1.31 format without saturation.
+ */
+void arm_biquad_cascade_mc_df1_q31(
+  const arm_biquad_casd_mc_df1_inst_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pIn = pSrc;                             /* Source pointer */
+  const q31_t *pX;                                     /* Input of the current channels */
+        q31_t *pY;                                     /* Output of the current channels */
+        q31_t *pState = S->pState;                     /* State of the current stage */
+  const q31_t *pCoeffs = S->pCoeffs;                   /* Coefficients of the current stage */
+        q63_t acc, accb;                               /* Accumulators */
+        q31_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+        q31_t Xn1, Xn2, Yn1, Yn2;                      /* State variables of the first channel */
+        q31_t Xn1b, Xn2b, Yn1b, Yn2b;                  /* State variables of the second channel */
+        q31_t Xn, Xnb;                                 /* Temporary inputs */
+        uint32_t numChannels = S->numChannels;         /* Distance between two samples of a channel */
+        uint32_t lShift = 31U - (uint32_t) S->postShift;   /* Shift to be applied to the output */
+        uint32_t stage = S->numStages;                 /* Loop counters */
+        uint32_t ch, sample;
+
+  while (stage > 0U)
+  {
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    /* Two channels at a time */
+    for (ch = 0U; ch + 2U <= numChannels; ch += 2U)
+    {
+      Xn1  = pState[ch];
+      Xn1b = pState[ch + 1U];
+      Xn2  = pState[numChannels + ch];
+      Xn2b = pState[numChannels + ch + 1U];
+      Yn1  = pState[2U * numChannels + ch];
+      Yn1b = pState[2U * numChannels + ch + 1U];
+      Yn2  = pState[3U * numChannels + ch];
+      Yn2b = pState[3U * numChannels + ch + 1U];
+      pX = pIn + ch;
+      pY = pDst + ch;
+
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+        Xn  = pX[0];
+        Xnb = pX[1];
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc  = ((q63_t) b0 * Xn ) + ((q63_t) b1 * Xn1 ) + ((q63_t) b2 * Xn2 ) + ((q63_t) a1 * Yn1 ) + ((q63_t) a2 * Yn2 );
+        accb = ((q63_t) b0 * Xnb) + ((q63_t) b1 * Xn1b) + ((q63_t) b2 * Xn2b) + ((q63_t) a1 * Yn1b) + ((q63_t) a2 * Yn2b);
+
+        /* The results are converted to 1.31 */
+        acc  = acc  >> lShift;
+        accb = accb >> lShift;
+
+        pY[0] = (q31_t) acc;
+        pY[1] = (q31_t) accb;
+
+        Xn2  = Xn1;
+        Xn1  = Xn;
+        Yn2  = Yn1;
+        Yn1  = (q31_t) acc;
+        Xn2b = Xn1b;
+        Xn1b = Xnb;
+        Yn2b = Yn1b;
+        Yn1b = (q31_t) accb;
+
+        pX += numChannels;
+        pY += numChannels;
+      }
+
+      pState[ch]                         = Xn1;
+      pState[ch + 1U]                    = Xn1b;
+      pState[numChannels + ch]           = Xn2;
+      pState[numChannels + ch + 1U]      = Xn2b;
+      pState[2U * numChannels + ch]      = Yn1;
+      pState[2U * numChannels + ch + 1U] = Yn1b;
+      pState[3U * numChannels + ch]      = Yn2;
+      pState[3U * numChannels + ch + 1U] = Yn2b;
+    }
+
+    /* Last channel when their number is odd */
+    if (ch < numChannels)
+    {
+      Xn1 = pState[ch];
+      Xn2 = pState[numChannels + ch];
+      Yn1 = pState[2U * numChannels + ch];
+      Yn2 = pState[3U * numChannels + ch];
+      pX = pIn + ch;
+      pY = pDst + ch;
+
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+        Xn = *pX;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = ((q63_t) b0 * Xn) + ((q63_t) b1 * Xn1) + ((q63_t) b2 * Xn2) + ((q63_t) a1 * Yn1) + ((q63_t) a2 * Yn2);
+
+        /* The result is converted to 1.31 */
+        acc = acc >> lShift;
+
+        *pY = (q31_t) acc;
+
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q31_t) acc;
+
+        pX += numChannels;
+        pY += numChannels;
+      }
+
+      pState[ch] = Xn1;
+      pState[numChannels + ch] = Xn2;
+      pState[2U * numChannels + ch] = Yn1;
+      pState[3U * numChannels + ch] = Yn2;
+    }
+
+    pCoeffs += 5U;
+    pState += 4U * numChannels;
+
+    /* The first stage goes from the input buffer to the output buffer. */
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    stage--;
+  }
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
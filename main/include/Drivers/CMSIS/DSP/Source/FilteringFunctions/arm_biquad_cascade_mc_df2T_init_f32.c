@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df2T_init_f32.c
+ * Description:  Initialization function for the multi-channel floating-point transposed direct form II Biquad cascade filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Initialization function for the multi-channel floating-point transposed direct form II Biquad cascade filter.
+  @param[in,out] S            points to an instance of the filter data structure.
+  @param[in]     numStages    number of 2nd order stages in the filter.
+  @param[in]     numChannels  number of interleaved channels.
+  @param[in]     pCoeffs      points to the filter coefficients.
+  @param[in]     pState       points to the state buffer.
+  @return        none
+
+  @par           Coefficient and State Ordering
+                   The coefficients are those of arm_biquad_cascade_df2T_init_f32(), shared by all the channels:
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+  </pre>
+  @par
+                   Each state variable of a stage is a row of <code>numChannels</code> values, one per channel:
+  <pre>
+      {d1 of channels 0..numChannels-1, d2 of channels 0..numChannels-1}
+  </pre>
+                   The rows of stage 1 are first, then those of stage 2, and so on.
+                   The state array has a total length of <code>2*numStages*numChannels</code> values.
+                   The state variables are updated after each block of data is processed; the coefficients are untouched.
+ */
+
+void arm_biquad_cascade_mc_df2T_init_f32(
+        arm_biquad_cascade_mc_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState)
+{
+  /* Assign filter stages and channels */
+  S->numStages = numStages;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2U * (uint32_t) numStages * numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_compensate_design_f32.c
+ * Description:  Design of the FIR compensation filter of a CIC filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CIC
+  @{
+ */
+
+/**
+  @brief         Design of the FIR filter compensating the passband droop of a CIC filter.
+  @param[in]     R          rate change factor of the CIC filter
+  @param[in]     numStages  number of stages of the CIC filter
+  @param[in]     diffDelay  differential delay of the CIC filter
+  @param[in]     numTaps    number of filter coefficients to compute
+  @param[in]     cutoff     end of the compensated passband, in cycles per sample at the low rate
+  @param[out]    pCoeffs    points to the filter coefficients
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is 0 or <code>cutoff</code> is outside (0, 0.5]
+
+  @par           Details
+                   The filter runs at the low rate of the CIC filter, after the decimator or before the
+                   interpolator. Its response is the inverse of the CIC response up to <code>cutoff</code>
+                   and 0 above, windowed by a Hamming window of <code>numTaps</code> samples: the integral of
+                   the inverse Fourier transform is computed in double precision, on 16 points per tap.
+                   It is symmetric, so the order of the coefficients is that of arm_fir_decimate_f32(), and
+                   normalized to a gain of 1 at DC.
+  @par
+                   With a cutoff of 0.2 to 0.25, the filter is also the anti-aliasing filter of a
+                   decimation by 2 in arm_fir_decimate_q31(), or of an interpolation by 2. 20 to 60 taps
+                   flatten the passband to a fraction of a dB, with the 53 dB stopband of the window. The
+                   residual gain <code>G/2^postShift</code> of the CIC filter, when <code>R*diffDelay</code>
+                   is not a power of 2, can be corrected by scaling the coefficients.
+  @par
+                   For the Q15 and Q31 filters, the coefficients are converted with arm_float_to_q15() or
+                   arm_float_to_q31(). The computation takes about <code>24*numTaps^2</code> sines and cosines, and is
+                   meant for an initialization, not for the processing loop.
+ */
+
+arm_status arm_cic_compensate_design_f32(
+        uint16_t R,
+        uint8_t numStages,
+        uint8_t diffDelay,
+        uint16_t numTaps,
+        float32_t cutoff,
+        float32_t * pCoeffs)
+{
+  float64_t center = 0.5 * ((float64_t) numTaps - 1.0);     /* Delay of the filter */
+  float64_t df;                                  /* Width of an integration step */
+  float64_t f;                                   /* Frequency, in cycles per sample */
+  float64_t cic;                                 /* Response of one CIC stage */
+  float64_t inverse;                             /* Inverse of the CIC response */
+  float64_t t;                                   /* Time from the center of the filter */
+  float64_t sum;                                 /* Integral of the inverse transform */
+  float64_t gain = 0.0;                          /* Gain at DC */
+  uint32_t numSteps;                             /* Number of integration steps */
+  uint32_t n, s, k;                              /* Loop counters */
+
+  if (R == 0U || numStages == 0U || diffDelay == 0U || numTaps == 0U || !(cutoff > 0.0f) || cutoff > 0.5f)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  numSteps = 16U * (uint32_t) numTaps;
+  df = (float64_t) cutoff / numSteps;
+
+  /* Only the first half: the filter is symmetric */
+  for (n = 0U; n < ((uint32_t) numTaps + 1U) / 2U; n++)
+  {
+    t = (float64_t) n - center;
+    sum = 0.0;
+
+    /* h(t) = 2 * integral from 0 to cutoff of cos(2*pi*f*t) / |H(f)|, by the midpoint rule */
+    for (s = 0U; s < numSteps; s++)
+    {
+      f = ((float64_t) s + 0.5) * df;
+      cic = sin(3.141592653589793238462 * diffDelay * f) / ((float64_t) R * diffDelay * sin(3.141592653589793238462 * f / R));
+
+      inverse = 1.0;
+      for (k = 0U; k < numStages; k++)
+      {
+        inverse /= cic;
+      }
+
+      sum += inverse * cos(6.283185307179586476925 * f * t);
+    }
+
+    sum *= 2.0 * df;
+
+    /* Hamming window */
+    if (numTaps > 1U)
+    {
+      sum *= 0.54 - 0.46 * cos(6.283185307179586476925 * n / ((float64_t) numTaps - 1.0));
+    }
+
+    pCoeffs[n] = (float32_t) sum;
+    pCoeffs[numTaps - 1U - n] = (float32_t) sum;
+  }
+
+  for (n = 0U; n < numTaps; n++)
+  {
+    gain += pCoeffs[n];
+  }
+
+  for (n = 0U; n < numTaps; n++)
+  {
+    pCoeffs[n] = (float32_t) (pCoeffs[n] / gain);
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of CIC group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_decimate_init_q31.c
+ * Description:  Q31 CIC decimator initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CIC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 CIC decimator.
+  @param[in,out] S          points to an instance of the Q31 CIC decimator structure
+  @param[in]     numStages  number of integrator and comb stages
+  @param[in]     R          decimation factor
+  @param[in]     diffDelay  differential delay of the combs
+  @param[in]     pState     points to the state buffer
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is 0, <code>numStages</code> exceeds
+                                                    <code>ARM_CIC_MAX_STAGES</code> or the gain
+                                                    <code>(R*diffDelay)^numStages</code> exceeds 2^32
+
+  @par           Details
+                   <code>pState</code> points to the array of state variables, of
+                   <code>ARM_CIC_STATE_LENGTH(numStages, diffDelay)</code> samples: the
+                   <code>numStages</code> integrators, then the <code>diffDelay</code> past inputs of each
+                   comb. They are cleared, and <code>postShift</code> is set to <code>ceil(log2(gain))</code>.
+                   The first output sample is the one of input sample <code>R-1</code>.
+ */
+
+arm_status arm_cic_decimate_init_q31(
+        arm_cic_decimate_instance_q31 * S,
+        uint8_t numStages,
+        uint16_t R,
+        uint8_t diffDelay,
+        q63_t * pState)
+{
+  uint64_t gain = 1U;                            /* Gain of the filter */
+  uint64_t rd = (uint64_t) R * diffDelay;        /* Length of the moving averages */
+  uint32_t shift = 0U;                           /* Bit growth */
+  uint32_t k;                                    /* Loop counter */
+
+  if (numStages == 0U || numStages > ARM_CIC_MAX_STAGES || R == 0U || diffDelay == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* The output of the last comb must fit in the 64-bit registers */
+  for (k = 0U; k < numStages; k++)
+  {
+    if (gain > (1ULL << 32) / rd)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    gain *= rd;
+  }
+
+  while ((1ULL << shift) < gain)
+  {
+    shift++;
+  }
+
+  S->R = R;
+  S->numStages = numStages;
+  S->diffDelay = diffDelay;
+  S->postShift = (uint8_t) shift;
+  S->phase = 0U;
+  S->pState = pState;
+
+  /* Clear the integrators and the delay lines of the combs */
+  memset(pState, 0, ARM_CIC_STATE_LENGTH((uint32_t) numStages, diffDelay) * sizeof(q63_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of CIC group
+ */
@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_decimate_q15.c
+ * Description:  Q15 CIC decimator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CIC
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 CIC decimator.
+  @param[in,out] S          points to an instance of the Q15 CIC decimator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Details
+                   The function processes any number of input samples per call, and writes one output
+                   sample every <code>R</code> input samples, counted from the initialization: between
+                   <code>floor(blockSize/R)</code> and <code>floor(blockSize/R)+1</code> samples per call.
+                   The integrators stay in registers, with one loop per number of stages, and cost
+                   <code>N</code> 32-bit additions per input sample; the combs run once per output sample.
+ */
+uint32_t arm_cic_decimate_q15(
+        arm_cic_decimate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pComb = S->pState + S->numStages;       /* Delay lines of the combs */
+        uint32_t integ[ARM_CIC_MAX_STAGES];            /* Integrators, the last one at the end */
+        uint32_t x, acc, out;                          /* Input and output of the current stage */
+        uint32_t numStages = S->numStages;             /* Number of stages */
+        uint32_t first = ARM_CIC_MAX_STAGES - numStages;   /* Position of the first integrator */
+        uint32_t diffDelay = S->diffDelay;             /* Differential delay of the combs */
+        uint32_t R = S->R;                             /* Decimation factor */
+        uint32_t phase = S->phase;                     /* Input samples since the last output */
+        uint32_t numOutputs = 0U;                      /* Number of output samples */
+        uint32_t sample, run, k, j;                    /* Loop counters */
+
+  for (k = 0U; k < numStages; k++)
+  {
+    integ[first + k] = (uint32_t) S->pState[k];
+  }
+
+  sample = 0U;
+  while (sample < blockSize)
+  {
+    /* Input samples up to the next output sample, or to the end of the block */
+    run = R - phase;
+    if (run > blockSize - sample)
+    {
+      run = blockSize - sample;
+    }
+
+    sample += run;
+    phase += run;
+
+    /* Integrators, one case per number of stages so that they stay in registers */
+    switch (numStages)
+    {
+      case 1U:
+        while (run > 0U)
+        {
+          x = (uint32_t) (q31_t) *pSrc++;
+          integ[5] += x;
+          run--;
+        }
+        break;
+
+      case 2U:
+        while (run > 0U)
+        {
+          x = (uint32_t) (q31_t) *pSrc++;
+          integ[4] += x;
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+
+      case 3U:
+        while (run > 0U)
+        {
+          x = (uint32_t) (q31_t) *pSrc++;
+          integ[3] += x;
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+
+      case 4U:
+        while (run > 0U)
+        {
+          x = (uint32_t) (q31_t) *pSrc++;
+          integ[2] += x;
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+
+      case 5U:
+        while (run > 0U)
+        {
+          x = (uint32_t) (q31_t) *pSrc++;
+          integ[1] += x;
+          integ[2] += integ[1];
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+
+      default:
+        while (run > 0U)
+        {
+          x = (uint32_t) (q31_t) *pSrc++;
+          integ[0] += x;
+          integ[1] += integ[0];
+          integ[2] += integ[1];
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+    }
+
+    if (phase == R)
+    {
+      phase = 0U;
+
+      /* Combs: c[m] = v[m] - v[m-D], the delay line of each comb most recent sample first */
+      acc = integ[ARM_CIC_MAX_STAGES - 1U];
+      for (k = 0U; k < numStages; k++)
+      {
+        out = acc - (uint32_t) pComb[diffDelay - 1U];
+        for (j = diffDelay - 1U; j > 0U; j--)
+        {
+          pComb[j] = pComb[j - 1U];
+        }
+        pComb[0] = (q31_t) acc;
+        acc = out;
+        pComb += diffDelay;
+      }
+      pComb -= numStages * diffDelay;
+
+      /* The output fits in 16 + postShift bits: the wrapped register is exact */
+      pDst[numOutputs] = (q15_t) (((q31_t) acc) >> S->postShift);
+      numOutputs++;
+    }
+  }
+
+  for (k = 0U; k < numStages; k++)
+  {
+    S->pState[k] = (q31_t) integ[first + k];
+  }
+  S->phase = (uint16_t) phase;
+
+  return (numOutputs);
+}
+
+/**
+  @} end of CIC group
+ */
@@ -0,0 +1,246 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_decimate_q31.c
+ * Description:  Q31 CIC decimator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup CIC Cascaded Integrator-Comb (CIC) Filters
+
+  A CIC filter changes the sample rate by a large integer factor <code>R</code> without any
+  multiplication: <code>N</code> integrators at the high rate and <code>N</code> combs at the low
+  rate. It is the usual first stage of the decimation of an oversampled ADC stream, down from
+  MHz rates, where arm_fir_decimate_q31() would need a filter of several hundred taps.
+  The decimator is the cascade
+  <pre>
+      integrators:  i1[n] = i1[n-1] + x[n],  i2[n] = i2[n-1] + i1[n],  ...  iN[n] = iN[n-1] + iN-1[n]
+      selection of one sample out of R:  v[m] = iN[m*R + R-1]
+      combs:        c1[m] = v[m] - v[m-D],  c2[m] = c1[m] - c1[m-D],  ...  y[m] = cN-1[m] - cN-1[m-D]
+  </pre>
+                   which is the FIR filter <code>(1 + z^-1 + ... + z^-(R*D-1))^N</code> at the high rate
+                   followed by the selection: a moving average of <code>R*D</code> samples applied
+                   <code>N</code> times. The interpolator is the same filter, with the combs at the low
+                   rate before the insertion of <code>R-1</code> zeros between the input samples and the
+                   integrators. <code>D</code>, the differential delay, is 1 or 2 in most designs.
+
+  @par           Frequency Response
+                   The response, relative to the low sample rate, is
+  <pre>
+      |H(f)| = | sin(pi*D*f) / (R*D * sin(pi*f/R)) |^N
+  </pre>
+                   with zeros at the multiples of <code>1/D</code>, which are the frequencies that alias
+                   onto DC. Each stage adds about 13 dB of attenuation to the first sidelobe, and the
+                   passband droops: 4 stages lose about 3.6 dB at a quarter of the low rate. The droop is
+                   corrected by a short FIR filter at the low rate, which usually also decimates by 2:
+                   arm_cic_compensate_design_f32() computes its coefficients for arm_fir_decimate_q31()
+                   or arm_fir_decimate_q15().
+
+  @par           Fixed-Point Behavior
+                   The gain of the filter is <code>G = (R*D)^N</code> for the decimator and
+                   <code>(R*D)^N/R</code> for the interpolator, so its registers need
+                   <code>log2(G)</code> bits more than the input. The registers wrap around: two's complement
+                   arithmetic is exact modulo 2^32 or 2^64, and the output of the last stage, which fits in
+                   the register, is exact even when the integrators have overflowed. The Q15 functions use
+                   32-bit registers, the Q31 functions 64-bit registers, so <code>G</code> is limited to
+                   2^16 and 2^32: for example <code>N = 4</code> and <code>R*D</code> up to 16 in Q15, up to
+                   256 in Q31.
+  @par
+                   The output is the register shifted right by <code>postShift = ceil(log2(G))</code>
+                   bits, with truncation, so the gain of the function is <code>G/2^postShift</code>, 1 when
+                   <code>R*D</code> is a power of 2 and between 0.5 and 1 otherwise. The outputs are bit-exact
+                   with the FIR filter above computed in 64-bit integers and shifted the same way.
+ */
+
+/**
+  @addtogroup CIC
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 CIC decimator.
+  @param[in,out] S          points to an instance of the Q31 CIC decimator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Details
+                   The function processes any number of input samples per call, and writes one output
+                   sample every <code>R</code> input samples, counted from the initialization: between
+                   <code>floor(blockSize/R)</code> and <code>floor(blockSize/R)+1</code> samples per call.
+                   The integrators stay in registers, with one loop per number of stages, and cost
+                   <code>N</code> 64-bit additions per input sample; the combs run once per output sample.
+ */
+uint32_t arm_cic_decimate_q31(
+        arm_cic_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q63_t *pComb = S->pState + S->numStages;       /* Delay lines of the combs */
+        uint64_t integ[ARM_CIC_MAX_STAGES];            /* Integrators, the last one at the end */
+        uint64_t x, acc, out;                          /* Input and output of the current stage */
+        uint32_t numStages = S->numStages;             /* Number of stages */
+        uint32_t first = ARM_CIC_MAX_STAGES - numStages;   /* Position of the first integrator */
+        uint32_t diffDelay = S->diffDelay;             /* Differential delay of the combs */
+        uint32_t R = S->R;                             /* Decimation factor */
+        uint32_t phase = S->phase;                     /* Input samples since the last output */
+        uint32_t numOutputs = 0U;                      /* Number of output samples */
+        uint32_t sample, run, k, j;                    /* Loop counters */
+
+  for (k = 0U; k < numStages; k++)
+  {
+    integ[first + k] = (uint64_t) S->pState[k];
+  }
+
+  sample = 0U;
+  while (sample < blockSize)
+  {
+    /* Input samples up to the next output sample, or to the end of the block */
+    run = R - phase;
+    if (run > blockSize - sample)
+    {
+      run = blockSize - sample;
+    }
+
+    sample += run;
+    phase += run;
+
+    /* Integrators, one case per number of stages so that they stay in registers */
+    switch (numStages)
+    {
+      case 1U:
+        while (run > 0U)
+        {
+          x = (uint64_t) (q63_t) *pSrc++;
+          integ[5] += x;
+          run--;
+        }
+        break;
+
+      case 2U:
+        while (run > 0U)
+        {
+          x = (uint64_t) (q63_t) *pSrc++;
+          integ[4] += x;
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+
+      case 3U:
+        while (run > 0U)
+        {
+          x = (uint64_t) (q63_t) *pSrc++;
+          integ[3] += x;
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+
+      case 4U:
+        while (run > 0U)
+        {
+          x = (uint64_t) (q63_t) *pSrc++;
+          integ[2] += x;
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+
+      case 5U:
+        while (run > 0U)
+        {
+          x = (uint64_t) (q63_t) *pSrc++;
+          integ[1] += x;
+          integ[2] += integ[1];
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+
+      default:
+        while (run > 0U)
+        {
+          x = (uint64_t) (q63_t) *pSrc++;
+          integ[0] += x;
+          integ[1] += integ[0];
+          integ[2] += integ[1];
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          run--;
+        }
+        break;
+    }
+
+    if (phase == R)
+    {
+      phase = 0U;
+
+      /* Combs: c[m] = v[m] - v[m-D], the delay line of each comb most recent sample first */
+      acc = integ[ARM_CIC_MAX_STAGES - 1U];
+      for (k = 0U; k < numStages; k++)
+      {
+        out = acc - (uint64_t) pComb[diffDelay - 1U];
+        for (j = diffDelay - 1U; j > 0U; j--)
+        {
+          pComb[j] = pComb[j - 1U];
+        }
+        pComb[0] = (q63_t) acc;
+        acc = out;
+        pComb += diffDelay;
+      }
+      pComb -= numStages * diffDelay;
+
+      /* The output fits in 32 + postShift bits: the wrapped register is exact */
+      pDst[numOutputs] = (q31_t) (((q63_t) acc) >> S->postShift);
+      numOutputs++;
+    }
+  }
+
+  for (k = 0U; k < numStages; k++)
+  {
+    S->pState[k] = (q63_t) integ[first + k];
+  }
+  S->phase = (uint16_t) phase;
+
+  return (numOutputs);
+}
+
+/**
+  @} end of CIC group
+ */
@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_interpolate_q15.c
+ * Description:  Q15 CIC interpolator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CIC
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 CIC interpolator.
+  @param[in,out] S          points to an instance of the Q15 CIC interpolator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        none
+
+  @par           Details
+                   Each input sample goes through the combs, then gives <code>R</code> output samples of
+                   the integrators, the first one with the comb output at their input and the others with 0.
+                   The first integrator does not change for the zeros, so an output sample costs
+                   <code>N-1</code> 32-bit additions.
+ */
+void arm_cic_interpolate_q15(
+        arm_cic_interpolate_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pComb = S->pState + S->numStages;       /* Delay lines of the combs */
+        uint32_t integ[ARM_CIC_MAX_STAGES];            /* Integrators, the last one at the end */
+        uint32_t acc, out;                             /* Output of the current stage */
+        uint32_t numStages = S->numStages;             /* Number of stages */
+        uint32_t first = ARM_CIC_MAX_STAGES - numStages;   /* Position of the first integrator */
+        uint32_t diffDelay = S->diffDelay;             /* Differential delay of the combs */
+        uint32_t R = S->R;                             /* Interpolation factor */
+        uint32_t postShift = S->postShift;             /* Shift of the output */
+        uint32_t sample, r, k, j;                      /* Loop counters */
+
+  for (k = 0U; k < numStages; k++)
+  {
+    integ[first + k] = (uint32_t) S->pState[k];
+  }
+
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    /* Combs: c[n] = v[n] - v[n-D], the delay line of each comb most recent sample first */
+    acc = (uint32_t) (q31_t) pSrc[sample];
+    for (k = 0U; k < numStages; k++)
+    {
+      out = acc - (uint32_t) pComb[diffDelay - 1U];
+      for (j = diffDelay - 1U; j > 0U; j--)
+      {
+        pComb[j] = pComb[j - 1U];
+      }
+      pComb[0] = (q31_t) acc;
+      acc = out;
+      pComb += diffDelay;
+    }
+    pComb -= numStages * diffDelay;
+
+    /* The comb output followed by R-1 zeros: the first integrator changes once */
+    switch (numStages)
+    {
+      case 1U:
+        integ[5] += acc;
+        break;
+      case 2U:
+        integ[4] += acc;
+        break;
+      case 3U:
+        integ[3] += acc;
+        break;
+      case 4U:
+        integ[2] += acc;
+        break;
+      case 5U:
+        integ[1] += acc;
+        break;
+      default:
+        integ[0] += acc;
+        break;
+    }
+
+    /* The other integrators, one case per number of stages so that they stay in registers.
+       The output fits in 16 + postShift bits: the wrapped register is exact */
+    r = R;
+    switch (numStages)
+    {
+      case 1U:
+        while (r > 0U)
+        {
+          *pDst++ = (q15_t) (((q31_t) integ[5]) >> postShift);
+          r--;
+        }
+        break;
+
+      case 2U:
+        while (r > 0U)
+        {
+          integ[5] += integ[4];
+          *pDst++ = (q15_t) (((q31_t) integ[5]) >> postShift);
+          r--;
+        }
+        break;
+
+      case 3U:
+        while (r > 0U)
+        {
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          *pDst++ = (q15_t) (((q31_t) integ[5]) >> postShift);
+          r--;
+        }
+        break;
+
+      case 4U:
+        while (r > 0U)
+        {
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          *pDst++ = (q15_t) (((q31_t) integ[5]) >> postShift);
+          r--;
+        }
+        break;
+
+      case 5U:
+        while (r > 0U)
+        {
+          integ[2] += integ[1];
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          *pDst++ = (q15_t) (((q31_t) integ[5]) >> postShift);
+          r--;
+        }
+        break;
+
+      default:
+        while (r > 0U)
+        {
+          integ[1] += integ[0];
+          integ[2] += integ[1];
+          integ[3] += integ[2];
+          integ[4] += integ[3];
+          integ[5] += integ[4];
+          *pDst++ = (q15_t) (((q31_t) integ[5]) >> postShift);
+          r--;
+        }
+        break;
+    }
+  }
+
+  for (k = 0U; k < numStages; k++)
+  {
+    S->pState[k] = (q31_t) integ[first + k];
+  }
+}
+
+/**
+  @} end of CIC group
+ */
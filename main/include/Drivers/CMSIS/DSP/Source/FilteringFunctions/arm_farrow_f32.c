@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_farrow_f32.c
+ * Description:  Floating-point Farrow interpolator
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point Farrow interpolator.
+  @param[in,out] S          points to an instance of the floating-point Farrow interpolator structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written to <code>pDst</code>, at most <code>floor(blockSize/step)+1</code>
+
+  @par           Details
+                   Output sample <code>k</code> is the input signal at time <code>k*step - 1 - delay</code>,
+                   interpolated by the cubic through the 4 input samples around it:
+                   <code>delay</code> is the fractional delay given to arm_farrow_init_f32(), plus one sample
+                   to have the sample after the interval. For each input sample, the function computes the
+                   coefficients of the cubic in Farrow structure, between <code>x[n-2]</code> and
+                   <code>x[n-1]</code>:
+  <pre>
+      y = ((c3 * mu + c2) * mu + c1) * mu + x[n-2]
+      c2 = (x[n-3] + x[n-1]) / 2 - x[n-2]
+      c3 = (x[n] - x[n-3]) / 6 + (x[n-2] - x[n-1]) / 2
+      c1 = x[n-1] - x[n-2] - c2 - c3
+  </pre>
+                   then evaluates it at each output position <code>mu</code> in [0, 1), by steps of
+                   <code>step</code>: each output sample costs 3 multiply-accumulates.
+  @par
+                   <code>S->step</code> may be changed between two calls to follow a drifting clock, and
+                   the functions process any number of input samples per call, down to one.
+                   The error of the interpolation grows as the fourth power of the frequency: about
+                   -105 dB for a sinusoid at 2% of the sample rate, -50 dB at 10%.
+ */
+uint32_t arm_farrow_f32(
+        arm_farrow_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  float32_t xm3 = S->state[0];                         /* x[n-3] */
+  float32_t xm2 = S->state[1];                         /* x[n-2] */
+  float32_t xm1 = S->state[2];                         /* x[n-1] */
+  float32_t xn;                                        /* x[n] */
+  float32_t c1, c2, c3;                                /* Coefficients of the cubic */
+  float32_t mu = S->mu;                                /* Position of the next output sample */
+  float32_t step = S->step;                            /* Input samples per output sample */
+  uint32_t numOutputs = 0U;                            /* Number of output samples */
+  uint32_t sample;                                     /* Loop counter */
+
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    xn = pSrc[sample];
+
+    /* Farrow structure of the cubic Lagrange interpolator between x[n-2] and x[n-1] */
+    c2 = 0.5f * (xm3 + xm1) - xm2;
+    c3 = (xn - xm3) * (1.0f / 6.0f) + 0.5f * (xm2 - xm1);
+    c1 = xm1 - xm2 - c2 - c3;
+
+    while (mu < 1.0f)
+    {
+      pDst[numOutputs++] = ((c3 * mu + c2) * mu + c1) * mu + xm2;
+      mu += step;
+    }
+
+    /* The next output sample is after the next input sample */
+    mu -= 1.0f;
+
+    xm3 = xm2;
+    xm2 = xm1;
+    xm1 = xn;
+  }
+
+  S->state[0] = xm3;
+  S->state[1] = xm2;
+  S->state[2] = xm1;
+  S->mu = mu;
+
+  return (numOutputs);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_farrow_init_f32.c
+ * Description:  Floating-point Farrow interpolator initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point Farrow interpolator.
+  @param[in,out] S          points to an instance of the floating-point Farrow interpolator structure
+  @param[in]     step       input samples per output sample, fsIn/fsOut
+  @param[in]     delay      fractional delay, in [0, 1)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>step</code> is not positive or <code>delay</code> is outside [0, 1)
+
+  @par           Details
+                   The output signal is the input one delayed by <code>1 + delay</code> samples, and resampled
+                   by <code>1/step</code>: 2 to double the sample rate, 1 for a fractional delay alone. The
+                   previous input samples are cleared.
+ */
+
+arm_status arm_farrow_init_f32(
+        arm_farrow_instance_f32 * S,
+        float32_t step,
+        float32_t delay)
+{
+  if (!(step > 0.0f) || !(delay >= 0.0f) || !(delay < 1.0f))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->step = step;
+
+  /* The first output sample is at 1 - delay after x[n-2], with the first input sample as x[n] */
+  S->mu = 1.0f - delay;
+
+  S->state[0] = 0.0f;
+  S->state[1] = 0.0f;
+  S->state[2] = 0.0f;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_Resample group
+ */
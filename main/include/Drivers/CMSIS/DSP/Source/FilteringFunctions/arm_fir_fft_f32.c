@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point FIR filter processing function using
+ *               partitioned FFT convolution
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_FFT FFT Finite Impulse Response (FIR) Filter
+
+  This function implements the floating-point FIR filter of \ref FIR with a
+  fast convolution, for filters of hundreds to thousands of taps where the
+  numTaps multiply-accumulates per sample of the direct form are too slow.
+  Each call processes <code>blockSize</code> samples, with the same output as
+  arm_fir_f32() and no additional delay.
+
+  @par           Algorithm
+                   The filter is split in <code>K = ceil(numTaps / blockSize)</code> partitions of
+                   <code>blockSize</code> taps. The spectrum of each partition, zero-padded to
+                   <code>2*blockSize</code> samples, is computed once by the initialization function.
+                   Each call transforms the new input block with arm_rfft_fast_f32() and keeps the
+                   spectra of the last <code>K</code> blocks, so that the filter output is
+  <pre>
+      Y = X[n] * H[0] + X[n-1] * H[1] + ... + X[n-K+1] * H[K-1]
+  </pre>
+  @par
+                   computed with arm_cmplx_mult_cmplx_f32() and arm_add_f32(), followed by a single
+                   inverse transform. Per output sample this costs two transforms of <code>2*blockSize</code>
+                   points and <code>K</code> complex multiply-accumulates instead of <code>numTaps</code>
+                   multiply-accumulates.
+  @par
+                   With overlap-save, the transform input is the previous block followed by the new one
+                   and the output is the second half of the inverse transform. With overlap-add, the
+                   transform input is the new block followed by zeros; the output is the first half of the
+                   inverse transform plus the second half of the previous one. Both give the same result;
+                   overlap-save needs no addition in the time domain.
+
+  @par           Method selection
+                   With <code>ARM_FIR_FFT_AUTO</code>, the initialization function uses the direct form
+                   when its cost, <code>numTaps</code> per sample, is below the cost of overlap-save,
+                   about <code>3*log2(2*blockSize) + 3*K + 8</code> per sample, or when <code>blockSize</code>
+                   is not a supported FFT block size: overlap-save is used from about 40 taps.
+                   With <code>ARM_MATH_X86_SIMD</code>, whose direct form is vectorized, it is used from
+                   about 100 taps.
+
+  @par           Instance Structure
+                   The coefficient spectra, the input spectra and the work buffers of a filter are stored
+                   in the state buffer of its instance structure, of
+                   <code>ARM_FIR_FFT_STATE_LENGTH(numTaps, blockSize)</code> samples.
+                   A separate instance structure must be defined for each filter.
+                   The initialization function must be used: it computes the coefficient spectra.
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Multiplies a packed arm_rfft_fast_f32() spectrum by another.
+  @param[in]     pSrcA    points to the first spectrum
+  @param[in]     pSrcB    points to the second spectrum
+  @param[out]    pDst     points to the product
+  @param[in]     fftLen   length of the transform
+
+  @par           Details
+                   Bin 0 holds the real DC and Nyquist values, which are multiplied separately.
+ */
+static void arm_fir_fft_mult_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t fftLen)
+{
+  arm_cmplx_mult_cmplx_f32(pSrcA, pSrcB, pDst, fftLen / 2U);
+
+  pDst[0] = pSrcA[0] * pSrcB[0];
+  pDst[1] = pSrcA[1] * pSrcB[1];
+}
+
+/**
+  @brief         Processing function for the floating-point FFT FIR filter.
+  @param[in,out] S          points to an instance of the floating-point FFT FIR filter structure
+  @param[in]     pSrc       points to the block of <code>S->blockSize</code> input samples
+  @param[out]    pDst       points to the block of <code>S->blockSize</code> output samples
+  @return        none
+ */
+void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+  uint32_t blockSize = S->blockSize;             /* Number of samples per call */
+  uint32_t fftLen = 2U * blockSize;              /* Length of the transforms */
+  uint32_t numPartitions = S->numPartitions;     /* Number of filter partitions */
+  float32_t *pScratch = S->pScratch;             /* Transform scratch */
+  float32_t *pAccum = S->pAccum;                 /* Sum of the partition products */
+  uint32_t slot;                                 /* Input spectrum of the current partition */
+  uint32_t k;                                    /* Loop counter */
+
+  if (S->method == ARM_FIR_FFT_DIRECT)
+  {
+    arm_fir_f32(&S->fir, pSrc, pDst, blockSize);
+    return;
+  }
+
+  /* Transform input: previous block and new block for overlap-save,
+     new block and zeros for overlap-add. arm_rfft_fast_f32() modifies its input: transform a copy. */
+  if (S->method == ARM_FIR_FFT_OVERLAP_SAVE)
+  {
+    memcpy(S->pInput + blockSize, pSrc, blockSize * sizeof(float32_t));
+    memcpy(pScratch, S->pInput, fftLen * sizeof(float32_t));
+    memcpy(S->pInput, pSrc, blockSize * sizeof(float32_t));
+  }
+  else
+  {
+    memcpy(pScratch, pSrc, blockSize * sizeof(float32_t));
+    memset(pScratch + blockSize, 0, blockSize * sizeof(float32_t));
+  }
+
+  /* The newest input spectrum replaces the oldest one */
+  slot = (S->partition == 0U) ? numPartitions - 1U : S->partition - 1U;
+  S->partition = (uint16_t) slot;
+  arm_rfft_fast_f32(&S->rfft, pScratch, S->pSpectra + slot * fftLen, 0);
+
+  /* Y = X[n] * H[0] + X[n-1] * H[1] + ... */
+  arm_fir_fft_mult_f32(S->pSpectra + slot * fftLen, S->pCoeffSpectra, pAccum, fftLen);
+
+  for (k = 1U; k < numPartitions; k++)
+  {
+    slot = (slot + 1U == numPartitions) ? 0U : slot + 1U;
+    arm_fir_fft_mult_f32(S->pSpectra + slot * fftLen, S->pCoeffSpectra + k * fftLen, pScratch, fftLen);
+    arm_add_f32(pAccum, pScratch, pAccum, fftLen);
+  }
+
+  arm_rfft_fast_f32(&S->rfft, pAccum, pScratch, 1);
+
+  if (S->method == ARM_FIR_FFT_OVERLAP_SAVE)
+  {
+    /* The first half is circularly aliased */
+    memcpy(pDst, pScratch + blockSize, blockSize * sizeof(float32_t));
+  }
+  else
+  {
+    arm_add_f32(pScratch, S->pOverlap, pDst, blockSize);
+    memcpy(S->pOverlap, pScratch + blockSize, blockSize * sizeof(float32_t));
+  }
+}
+
+/**
+  @} end of FIR_FFT group
+ */
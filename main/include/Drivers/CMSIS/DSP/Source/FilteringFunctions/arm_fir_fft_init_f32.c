@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Floating-point FFT FIR filter initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Cost of overlap-save per output sample, in direct form taps:
+   FFT_COST * log2(2*blockSize) + PARTITION_COST * numPartitions + FIXED_COST.
+   Measured with host/bench/fir_fft_bench.cpp: the vector direct form of
+   ARM_MATH_X86_SIMD is about four times faster than the scalar one. */
+#if defined(ARM_MATH_X86_SIMD)
+#define ARM_FIR_FFT_FFT_COST        10U
+#define ARM_FIR_FFT_PARTITION_COST  3U
+#define ARM_FIR_FFT_FIXED_COST      20U
+#else
+#define ARM_FIR_FFT_FFT_COST        3U
+#define ARM_FIR_FFT_PARTITION_COST  3U
+#define ARM_FIR_FFT_FIXED_COST      8U
+#endif
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point FFT FIR filter.
+  @param[in,out] S          points to an instance of the floating-point FFT FIR filter structure
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficients buffer
+  @param[in]     pState     points to the state buffer
+  @param[in]     blockSize  number of samples processed per call
+  @param[in]     method     filtering method
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0, or an FFT method is requested with an unsupported <code>blockSize</code>
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+                   as for arm_fir_init_f32():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   The FFT methods need a <code>blockSize</code> that is a power of 2 between 16 and 2048.
+                   With <code>ARM_FIR_FFT_AUTO</code>, other block sizes use the direct form.
+  @par
+                   <code>pState</code> points to the array of state variables, of
+                   <code>ARM_FIR_FFT_STATE_LENGTH(numTaps, blockSize)</code> samples.
+                   The FFT methods read the coefficients only in this function; the direct form keeps
+                   <code>pCoeffs</code>, which must then remain valid.
+ */
+
+arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint16_t blockSize,
+        arm_fir_fft_method method)
+{
+  uint32_t fftLen = 2U * blockSize;              /* Length of the transforms */
+  uint32_t numPartitions;                        /* Number of filter partitions */
+  uint32_t log2FftLen = 0U;                      /* log2 of the transform length */
+  uint32_t k, n;                                 /* Loop counters */
+  uint32_t tap;                                  /* Index of a coefficient in time order */
+  uint32_t fftSize;                              /* blockSize is supported by the FFT methods */
+  arm_status status;
+
+  if (numTaps == 0U || blockSize == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  numPartitions = ((uint32_t) numTaps + blockSize - 1U) / blockSize;
+
+  while ((1UL << log2FftLen) < fftLen)
+  {
+    log2FftLen++;
+  }
+  fftSize = (blockSize >= 16U) && (blockSize <= 2048U) && ((blockSize & (blockSize - 1U)) == 0U);
+
+  if (method == ARM_FIR_FFT_AUTO)
+  {
+    if (fftSize && numTaps > ARM_FIR_FFT_FFT_COST * log2FftLen
+                           + ARM_FIR_FFT_PARTITION_COST * numPartitions
+                           + ARM_FIR_FFT_FIXED_COST)
+    {
+      method = ARM_FIR_FFT_OVERLAP_SAVE;
+    }
+    else
+    {
+      method = ARM_FIR_FFT_DIRECT;
+    }
+  }
+  else if (method != ARM_FIR_FFT_DIRECT && !fftSize)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+  S->numPartitions = (uint16_t) numPartitions;
+  S->partition = 0U;
+  S->method = method;
+
+  if (method == ARM_FIR_FFT_DIRECT)
+  {
+    arm_fir_init_f32(&S->fir, numTaps, pCoeffs, pState, blockSize);
+    return ARM_MATH_SUCCESS;
+  }
+
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  /* Buffers in the state array */
+  S->pCoeffSpectra = pState;
+  S->pSpectra = S->pCoeffSpectra + numPartitions * fftLen;
+  S->pInput = S->pSpectra + numPartitions * fftLen;
+  S->pAccum = S->pInput + fftLen;
+  S->pScratch = S->pAccum + fftLen;
+  S->pOverlap = S->pScratch + fftLen;
+
+  /* Spectrum of each partition: blockSize taps in time order, zero padded */
+  for (k = 0U; k < numPartitions; k++)
+  {
+    for (n = 0U; n < fftLen; n++)
+    {
+      tap = k * blockSize + n;
+      S->pScratch[n] = (n < blockSize && tap < numTaps) ? pCoeffs[numTaps - 1U - tap] : 0.0f;
+    }
+    arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pCoeffSpectra + k * fftLen, 0);
+  }
+
+  /* Clear the input spectra, the input and the overlap-add tail */
+  memset(S->pSpectra, 0, numPartitions * fftLen * sizeof(float32_t));
+  memset(S->pInput, 0, fftLen * sizeof(float32_t));
+  memset(S->pOverlap, 0, blockSize * sizeof(float32_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_FFT group
+ */
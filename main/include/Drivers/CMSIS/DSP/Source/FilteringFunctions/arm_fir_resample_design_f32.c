@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_design_f32.c
+ * Description:  Filter design for the rational resamplers
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Modified Bessel function of the first kind and order 0, by its series */
+static float64_t arm_fir_resample_bessel_i0(float64_t x)
+{
+  float64_t sum = 1.0;                           /* Sum of the series */
+  float64_t term = 1.0;                          /* Current term */
+  float64_t k = 1.0;                             /* Index of the term */
+
+  do
+  {
+    term *= (x * x) / (4.0 * k * k);
+    sum += term;
+    k += 1.0;
+  } while (term > 1e-17 * sum);
+
+  return (sum);
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Kaiser window design of the low-pass filter of a rational resampler.
+  @param[in]     L          upsample factor
+  @param[in]     M          downsample factor
+  @param[in]     numTaps    number of filter coefficients to compute
+  @param[in]     beta       parameter of the Kaiser window
+  @param[out]    pCoeffs    points to the filter coefficients
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code>, <code>M</code> or <code>numTaps</code> is 0
+
+  @par           Details
+                   The filter is the ideal low-pass filter of normalized cutoff frequency <code>1/max(L, M)</code>
+                   and gain <code>L</code>, windowed by a Kaiser window of <code>numTaps</code> samples, computed
+                   in double precision. It is symmetric, so the order of the coefficients is that of
+                   arm_fir_interpolate_f32() and arm_fir_resample_init_f32(), and delays the signal by
+                   <code>(numTaps-1)/2</code> samples of the upsampled rate.
+  @par
+                   The response is -6 dB at the cutoff frequency. <code>beta</code> trades the stopband
+                   attenuation against the width of the transition band, about <code>1.3*beta/numTaps</code>
+                   of the Nyquist frequency of the upsampled signal: 5 gives about 55 dB, 8 about 80 dB.
+                   A filter of <code>20*max(L, M)</code> taps with a <code>beta</code> of 5 is a common choice.
+  @par
+                   For the Q15 and Q31 resamplers, the coefficients are converted with arm_float_to_q15() or
+                   arm_float_to_q31(): with <code>L >= M</code> the largest is 1, which saturates to the largest
+                   fixed-point value.
+ */
+
+arm_status arm_fir_resample_design_f32(
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+        float32_t beta,
+        float32_t * pCoeffs)
+{
+  float64_t cutoff;                              /* Cutoff frequency, in cycles per sample */
+  float64_t center;                              /* Center of the filter */
+  float64_t i0Beta;                              /* Bessel function of beta */
+  float64_t t, r, window;                        /* Temporary values */
+  uint32_t n;                                    /* Loop counter */
+
+  if (L == 0U || M == 0U || numTaps == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  cutoff = 0.5 / (float64_t) ((L > M) ? L : M);
+  center = 0.5 * ((float64_t) numTaps - 1.0);
+  i0Beta = arm_fir_resample_bessel_i0((float64_t) beta);
+
+  for (n = 0U; n < numTaps; n++)
+  {
+    t = (float64_t) n - center;
+
+    /* Kaiser window, 1 for a single tap */
+    r = (numTaps > 1U) ? t / center : 0.0;
+    window = arm_fir_resample_bessel_i0((float64_t) beta * sqrt(1.0 - r * r)) / i0Beta;
+
+    /* Ideal low-pass filter of gain L */
+    if (t == 0.0)
+    {
+      pCoeffs[n] = (float32_t) (2.0 * cutoff * (float64_t) L * window);
+    }
+    else
+    {
+      pCoeffs[n] = (float32_t) (sin(6.283185307179586476925 * cutoff * t) / (3.141592653589793238462 * t)
+                                * (float64_t) L * window);
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_Resample group
+ */
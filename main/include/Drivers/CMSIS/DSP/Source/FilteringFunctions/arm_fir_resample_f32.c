@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point rational resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+
+  These functions change the sample rate by a rational factor <code>L/M</code>, for example
+  147/160 from 48 kHz to 44.1 kHz: they are equivalent to an FIR interpolator by <code>L</code>
+  (arm_fir_interpolate_f32()) followed by the selection of one sample out of <code>M</code>,
+  without computing the samples that are not selected. The filter removes the images of the
+  upsampling and the aliases of the downsampling: its normalized cutoff frequency is
+  <code>1/max(L, M)</code>, and its gain <code>L</code>. arm_fir_resample_design_f32() computes
+  one with a Kaiser window.
+
+  @par           Algorithm
+                   Output sample <code>m</code> is at time <code>t = m*M</code> of the upsampled signal.
+                   With <code>n = t / L</code> and <code>p = t % L</code>, it is the output of the polyphase
+                   component <code>p</code> of the interpolator:
+  <pre>
+      y[m] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+  </pre>
+                   so each output sample costs <code>phaseLength = ceil(numTaps/L)</code> multiply-accumulates,
+                   and each input sample <code>phaseLength*L/M</code>, where the interpolator followed by
+                   arm_fir_decimate_f32() costs <code>numTaps</code> per input sample plus the decimation filter.
+  @par
+                   The functions process any number of input samples per call, down to one, and return the
+                   number of output samples, between <code>floor(blockSize*L/M)</code> and
+                   <code>ARM_FIR_RESAMPLE_MAX_OUTPUTS(blockSize, L, M)</code>. Each input sample is written
+                   twice in a delay line of <code>2*phaseLength</code> samples, at its position and
+                   <code>phaseLength</code> samples further, so that the last <code>phaseLength</code> input
+                   samples are always contiguous: there is no copy of the state at the end of a block, and
+                   a call with one sample costs as much per sample as a call with many.
+  @par
+                   <code>pCoeffs</code> points to the <code>numTaps</code> coefficients of the filter at the
+                   upsampled rate, in the time reversed order of arm_fir_interpolate_f32(). <code>numTaps</code>
+                   need not be a multiple of <code>L</code>: <code>b[numTaps]</code> to
+                   <code>b[L*phaseLength-1]</code> are taken as 0.
+                   The initialization function copies the polyphase components, in the order of the delay
+                   line, to the beginning of the state buffer of
+                   <code>ARM_FIR_RESAMPLE_STATE_LENGTH(numTaps, L)</code> samples: <code>pCoeffs</code> is not
+                   used after it.
+  @par
+                   arm_farrow_f32() resamples by a ratio that need not be rational, or that changes over
+                   time, and delays a signal by a fraction of a sample, with a cubic Lagrange interpolator in
+                   Farrow structure.
+
+  @par           Fixed-Point Behavior
+                   The Q15 and Q31 versions accumulate the products in a 64-bit accumulator and convert the
+                   result as arm_fir_interpolate_q15() and arm_fir_interpolate_q31(): their outputs are
+                   bit-exact with the samples of the interpolator they select.
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point rational resampler.
+  @param[in,out] S          points to an instance of the floating-point rational resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Details
+                   The multiply-accumulates of each output sample go through arm_dot_prod_f32(), and
+                   its vector versions. The result may differ in the last bits from the corresponding sample
+                   of arm_fir_interpolate_f32(), which adds the products in another order.
+ */
+uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pPhases = S->pPhases;               /* Polyphase components */
+        float32_t *pDelay = S->pDelay;                 /* Delay line */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase component */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t M = S->M;                             /* Downsample factor */
+        uint32_t phase = S->phase;                     /* Time of the next output from the next input */
+        uint32_t delayIndex = S->delayIndex;           /* Oldest sample of the delay line */
+        uint32_t numOutputs = 0U;                      /* Number of output samples */
+        uint32_t sample;                               /* Loop counter */
+
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    /* The new sample replaces the oldest one, in both copies of the delay line */
+    pDelay[delayIndex] = pSrc[sample];
+    pDelay[delayIndex + phaseLen] = pSrc[sample];
+
+    delayIndex++;
+    if (delayIndex == phaseLen)
+    {
+      delayIndex = 0U;
+    }
+
+    /* pDelay[delayIndex] to pDelay[delayIndex + phaseLen - 1] are x[n-phaseLength+1] to x[n] */
+    while (phase < L)
+    {
+      arm_dot_prod_f32(pPhases + phase * phaseLen, pDelay + delayIndex, phaseLen, pDst + numOutputs);
+      numOutputs++;
+
+      phase += M;
+    }
+
+    /* The next output sample is after the next input sample */
+    phase -= L;
+  }
+
+  S->phase = (uint16_t) phase;
+  S->delayIndex = (uint16_t) delayIndex;
+
+  return (numOutputs);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_init_q31.c
+ * Description:  Q31 rational resampler initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 rational resampler.
+  @param[in,out] S          points to an instance of the Q31 rational resampler structure
+  @param[in]     L          upsample factor
+  @param[in]     M          downsample factor
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficient buffer
+  @param[in]     pState     points to the state buffer
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code>, <code>M</code> or <code>numTaps</code> is 0
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients, in the order of
+                   arm_fir_interpolate_q31():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to the array of state variables, of
+                   <code>ARM_FIR_RESAMPLE_STATE_LENGTH(numTaps, L)</code> samples. It starts with the
+                   <code>L</code> polyphase components, each of <code>phaseLength = ceil(numTaps/L)</code>
+                   coefficients in the order of the delay line that follows them:
+  <pre>
+      {b[p+L*(phaseLength-1)], ..., b[p+L], b[p]}   for p = 0, 1, ..., L-1
+  </pre>
+                   and <code>pCoeffs</code> is not used after this function. The delay line is cleared, and
+                   the first output sample is the one of the first input sample.
+ */
+
+arm_status arm_fir_resample_init_q31(
+        arm_fir_resample_instance_q31 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState)
+{
+  uint32_t phaseLen;                             /* Length of each polyphase component */
+  uint32_t p, i;                                 /* Loop counters */
+  uint32_t tap;                                  /* Index of a coefficient in time order */
+
+  if (L == 0U || M == 0U || numTaps == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  phaseLen = ((uint32_t) numTaps + L - 1U) / L;
+
+  /* Polyphase components, x[n-phaseLength+1] first as in the delay line,
+     0 past the end of the filter */
+  for (p = 0U; p < L; p++)
+  {
+    for (i = 0U; i < phaseLen; i++)
+    {
+      tap = p + L * (phaseLen - 1U - i);
+      pState[p * phaseLen + i] = (tap < numTaps) ? pCoeffs[numTaps - 1U - tap] : 0;
+    }
+  }
+
+  S->L = L;
+  S->M = M;
+  S->phaseLength = (uint16_t) phaseLen;
+  S->phase = 0U;
+  S->delayIndex = 0U;
+  S->pPhases = pState;
+  S->pDelay = pState + L * phaseLen;
+
+  /* Clear the delay line */
+  memset(S->pDelay, 0, 2U * phaseLen * sizeof(q31_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 rational resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 rational resampler.
+  @param[in,out] S          points to an instance of the Q15 rational resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+                   The products go through arm_dot_prod_q15(), and the output is bit-exact with the corresponding
+                   sample of arm_fir_interpolate_q15().
+ */
+uint32_t arm_fir_resample_q15(
+        arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const q15_t *pPhases = S->pPhases;                   /* Polyphase components */
+        q15_t *pDelay = S->pDelay;                     /* Delay line */
+        q63_t acc;                                     /* Accumulator */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase component */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t M = S->M;                             /* Downsample factor */
+        uint32_t phase = S->phase;                     /* Time of the next output from the next input */
+        uint32_t delayIndex = S->delayIndex;           /* Oldest sample of the delay line */
+        uint32_t numOutputs = 0U;                      /* Number of output samples */
+        uint32_t sample;                               /* Loop counter */
+
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    /* The new sample replaces the oldest one, in both copies of the delay line */
+    pDelay[delayIndex] = pSrc[sample];
+    pDelay[delayIndex + phaseLen] = pSrc[sample];
+
+    delayIndex++;
+    if (delayIndex == phaseLen)
+    {
+      delayIndex = 0U;
+    }
+
+    /* pDelay[delayIndex] to pDelay[delayIndex + phaseLen - 1] are x[n-phaseLength+1] to x[n] */
+    while (phase < L)
+    {
+      /* Sum of the products in 34.30 format */
+      arm_dot_prod_q15(pPhases + phase * phaseLen, pDelay + delayIndex, phaseLen, &acc);
+
+      /* Truncated to 34.15 and saturated to 1.15 */
+      pDst[numOutputs++] = (q15_t) (__SSAT((acc >> 15), 16));
+
+      phase += M;
+    }
+
+    /* The next output sample is after the next input sample */
+    phase -= L;
+  }
+
+  S->phase = (uint16_t) phase;
+  S->delayIndex = (uint16_t) delayIndex;
+
+  return (numOutputs);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
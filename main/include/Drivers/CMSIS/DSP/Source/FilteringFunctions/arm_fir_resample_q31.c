@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q31.c
+ * Description:  Q31 rational resampler
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 rational resampler.
+  @param[in,out] S          points to an instance of the Q31 rational resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+                   Thus, if the accumulator result overflows it wraps around rather than clip.
+                   In order to avoid overflows completely the input signal must be scaled down by <code>1/phaseLength</code>,
+                   since <code>phaseLength</code> additions occur per output sample.
+                   After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.31 format.
+                   The output is bit-exact with the corresponding sample of arm_fir_interpolate_q31().
+ */
+uint32_t arm_fir_resample_q31(
+        arm_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pPhases = S->pPhases;                   /* Polyphase components */
+        q31_t *pDelay = S->pDelay;                     /* Delay line */
+  const q31_t *pb;                                     /* Coefficients of the current component */
+  const q31_t *px;                                     /* Samples of the delay line */
+        q63_t acc0, acc1;                              /* Accumulators */
+        uint32_t tapCnt;                               /* Loop counter */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase component */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t M = S->M;                             /* Downsample factor */
+        uint32_t phase = S->phase;                     /* Time of the next output from the next input */
+        uint32_t delayIndex = S->delayIndex;           /* Oldest sample of the delay line */
+        uint32_t numOutputs = 0U;                      /* Number of output samples */
+        uint32_t sample;                               /* Loop counter */
+
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    /* The new sample replaces the oldest one, in both copies of the delay line */
+    pDelay[delayIndex] = pSrc[sample];
+    pDelay[delayIndex + phaseLen] = pSrc[sample];
+
+    delayIndex++;
+    if (delayIndex == phaseLen)
+    {
+      delayIndex = 0U;
+    }
+
+    /* pDelay[delayIndex] to pDelay[delayIndex + phaseLen - 1] are x[n-phaseLength+1] to x[n] */
+    while (phase < L)
+    {
+      pb = pPhases + phase * phaseLen;
+      px = pDelay + delayIndex;
+      acc0 = 0;
+      acc1 = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+      /* Loop unrolling: Compute 4 taps at a time, in two independent accumulators */
+      tapCnt = phaseLen >> 2U;
+
+      while (tapCnt > 0U)
+      {
+        acc0 += (q63_t) *px++ * *pb++;
+        acc1 += (q63_t) *px++ * *pb++;
+        acc0 += (q63_t) *px++ * *pb++;
+        acc1 += (q63_t) *px++ * *pb++;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      /* Loop unrolling: Compute remaining taps */
+      tapCnt = phaseLen % 0x4U;
+
+#else
+
+      /* Initialize tapCnt with number of taps */
+      tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+      while (tapCnt > 0U)
+      {
+        acc0 += (q63_t) *px++ * *pb++;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      /* The result is in 2.62 format, store it in 1.31 format */
+      pDst[numOutputs++] = (q31_t) ((acc0 + acc1) >> 31);
+
+      phase += M;
+    }
+
+    /* The next output sample is after the next input sample */
+    phase -= L;
+  }
+
+  S->phase = (uint16_t) phase;
+  S->delayIndex = (uint16_t) delayIndex;
+
+  return (numOutputs);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
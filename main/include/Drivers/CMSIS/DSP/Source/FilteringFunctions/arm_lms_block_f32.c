@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_block_f32.c
+ * Description:  Processing function for the floating-point block LMS filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup LMS_Block Block Least Mean Square (LMS) Filter
+
+  The block LMS filter is the LMS filter of \ref LMS with one coefficient update per block
+  instead of one per sample. The outputs of a block are computed with the same coefficients,
+  and the coefficients are then updated with the gradient of the whole block:
+  <pre>
+      y[n] = b[0] * x[n] + b[1] * x[n-1] + ... + b[numTaps-1] * x[n-numTaps+1]
+      e[n] = d[n] - y[n]
+      b[k] = b[k] + mu * (e[n0] * x[n0-k] + e[n0+1] * x[n0+1-k] + ... + e[n0+B-1] * x[n0+B-1-k])
+  </pre>
+  where <code>n0</code> is the first sample of the block and <code>B</code> its length, the
+  <code>blockSize</code> of the call. With the gradient summed rather than averaged, <code>mu</code>
+  has the meaning it has for arm_lms_f32(), and a call with one sample is a step of arm_lms_f32().
+
+  @par           Algorithm
+                   Both the outputs and the gradient are dot products of <code>numTaps</code> or
+                   <code>blockSize</code> contiguous samples of the state buffer, computed with
+                   arm_dot_prod_f32() and its vector versions: there is no dependency between the
+                   coefficient updates of the samples of a block. The cost is the
+                   <code>2*numTaps</code> multiply-accumulates per sample of arm_lms_f32().
+                   For long filters, arm_lms_fd_f32() computes the same products with FFTs.
+  @par
+                   The convergence is that of the LMS filter for a small step size. The step size must be
+                   small enough for the <code>blockSize</code> updates to be applied at once: for a white
+                   input of power <code>power</code>, the filter is stable for <code>mu</code> below about
+                   <code>2 / ((numTaps + blockSize) * power)</code>. For a coloured input, the bound
+                   decreases towards <code>2 / (blockSize * lambdaMax)</code>, where <code>lambdaMax</code>
+                   is the largest eigenvalue of the correlation matrix of the input, up to
+                   <code>numTaps</code> times its power.
+
+  @par           Instance Structure
+                   <code>pCoeffs</code> points to the coefficients in time reversed order and
+                   <code>pState</code> to a state buffer of <code>numTaps+blockSize-1</code> samples, as for
+                   arm_lms_f32(). The instance structure can be initialized statically:
+  <pre>
+      arm_lms_block_instance_f32 S = {numTaps, pState, pCoeffs, mu};
+  </pre>
+                   with the values of the state buffer set to zero.
+ */
+
+/**
+  @addtogroup LMS_Block
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point block LMS filter.
+  @param[in]     S          points to an instance of the floating-point block LMS filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     pRef       points to the block of reference data
+  @param[out]    pOut       points to the block of output data
+  @param[out]    pErr       points to the block of error data
+  @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given to arm_lms_block_init_f32()
+  @return        none
+
+  @par           Details
+                   The coefficients are updated once, at the end of the call. <code>pErr</code> is read
+                   back for the update and must not overlap the other buffers.
+ */
+void arm_lms_block_f32(
+  const arm_lms_block_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;           /* State pointer */
+        float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+        float32_t mu = S->mu;                    /* Step size */
+        uint32_t numTaps = S->numTaps;           /* Number of filter coefficients in the filter */
+        float32_t acc;                           /* Dot product */
+        uint32_t n, k;                           /* Loop counters */
+
+  /* The new samples follow the numTaps-1 previous ones in the state buffer */
+  memcpy(pState + (numTaps - 1U), pSrc, blockSize * sizeof(float32_t));
+
+  /* Outputs and errors with the coefficients of the previous block */
+  for (n = 0U; n < blockSize; n++)
+  {
+    arm_dot_prod_f32(pCoeffs, pState + n, numTaps, &acc);
+    pOut[n] = acc;
+    pErr[n] = pRef[n] - acc;
+  }
+
+  /* pCoeffs[k] multiplies pState[n + k] for output n: its gradient is the
+     dot product of the errors with the blockSize samples from pState[k] */
+  for (k = 0U; k < numTaps; k++)
+  {
+    arm_dot_prod_f32(pErr, pState + k, blockSize, &acc);
+    pCoeffs[k] += mu * acc;
+  }
+
+  /* Keep the last numTaps-1 samples for the next call */
+  memmove(pState, pState + blockSize, (numTaps - 1U) * sizeof(float32_t));
+}
+
+/**
+  @} end of LMS_Block group
+ */
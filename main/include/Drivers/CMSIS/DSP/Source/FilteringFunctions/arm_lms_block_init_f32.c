@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_block_init_f32.c
+ * Description:  Initialization function for the floating-point block LMS filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LMS_Block
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point block LMS filter.
+  @param[in]     S          points to an instance of the floating-point block LMS filter structure
+  @param[in]     numTaps    number of filter coefficients
+  @param[in]     pCoeffs    points to coefficient buffer
+  @param[in]     pState     points to state buffer
+  @param[in]     mu         step size that controls filter coefficient updates
+  @param[in]     blockSize  largest number of samples processed per call
+  @return        none
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+  <pre>
+     {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+                   The initial filter coefficients serve as a starting point for the adaptive filter.
+                   <code>pState</code> points to an array of length <code>numTaps+blockSize-1</code> samples.
+ */
+void arm_lms_block_init_f32(
+        arm_lms_block_instance_f32 * S,
+        uint16_t numTaps,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t mu,
+        uint32_t blockSize)
+{
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+  S->mu = mu;
+
+  /* Clear the state buffer */
+  memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+  S->pState = pState;
+}
+
+/**
+  @} end of LMS_Block group
+ */
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_fd_f32.c
+ * Description:  Processing function for the floating-point frequency-domain LMS filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup LMS_FD Frequency-Domain Least Mean Square (LMS) Filter
+
+  The frequency-domain LMS filter is a block LMS filter (\ref LMS_Block) whose block length is
+  the number of coefficients, with the convolution of the output and the correlation of the
+  gradient computed with FFTs, and with the step size normalized in each frequency bin. It
+  adapts filters of hundreds to thousands of taps, for noise and echo cancellation, where the
+  <code>2*numTaps</code> multiply-accumulates per sample of the time-domain filters are too slow.
+  Each call processes <code>numTaps</code> samples.
+
+  @par           Algorithm
+                   With <code>N = numTaps</code>, the filter keeps the previous input block and computes,
+                   with arm_rfft_fast_f32() of length <code>2*N</code>:
+  <pre>
+      X = FFT([x_previous, x])                   spectrum of the last two input blocks
+      W = FFT([b, 0])                            spectrum of the coefficients in time order
+      y = second half of IFFT(X * W)             overlap-save convolution
+      e = d - y
+      E = FFT([0, e])
+      P[k] = lambda * P[k] + (1 - lambda) * |X[k]|^2
+      g = first half of IFFT(2 * mu * conj(X) * E / P)
+      b = b + g
+  </pre>
+  @par
+                   <code>g</code> is the block LMS gradient, the correlation of the errors with the input,
+                   with each frequency bin divided by an estimate of its power: the bins converge at the
+                   same rate whatever the spectrum of the input, where the time-domain filters slow down
+                   on its weak frequencies. The second half of <code>IFFT(conj(X) * E / P)</code>
+                   is dropped, so that the coefficients remain a linear convolution of <code>numTaps</code>
+                   taps. The power estimates start from the mean power of the first block.
+  @par
+                   A call costs five transforms of <code>2*N</code> points, about
+                   <code>5*log2(2*N)</code> operations per sample for the <code>2*N</code> of the
+                   time-domain filters: the frequency-domain filter is faster from about 64 taps, and
+                   about ten times faster than arm_lms_f32() with 1024 taps.
+                   Without the normalization, its outputs and coefficients would be those of
+                   arm_lms_block_f32() on blocks of <code>numTaps</code> samples.
+
+  @par           Instance Structure
+                   <code>pCoeffs</code> points to the coefficients in time reversed order, as for
+                   arm_lms_f32(). They are read at the beginning of each call and updated at its end.
+                   The input block, the spectra and the power estimates are stored in a state buffer of
+                   <code>ARM_LMS_FD_STATE_LENGTH(numTaps)</code> samples. The initialization function must
+                   be used: it initializes the FFT instance.
+ */
+
+/**
+  @addtogroup LMS_FD
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point frequency-domain LMS filter.
+  @param[in,out] S     points to an instance of the floating-point frequency-domain LMS filter structure
+  @param[in]     pSrc  points to the block of <code>numTaps</code> input samples
+  @param[in]     pRef  points to the block of <code>numTaps</code> reference samples
+  @param[out]    pOut  points to the block of <code>numTaps</code> output samples
+  @param[out]    pErr  points to the block of <code>numTaps</code> error samples
+  @return        none
+ */
+void arm_lms_fd_f32(
+        arm_lms_fd_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr)
+{
+        uint32_t numTaps = S->numTaps;           /* Number of coefficients and block length */
+        float32_t *pCoeffs = S->pCoeffs;         /* Coefficients in time reversed order */
+        float32_t *pSpectrum = S->pSpectrum;     /* Input spectrum X */
+        float32_t *pScratch = S->pScratch;       /* Transform input */
+        float32_t *pWork = S->pWork;             /* Transform output */
+        float32_t *pPower = S->pPower;           /* Power estimates of the bins */
+        float32_t lambda = S->lambda;            /* Forgetting factor of the power estimates */
+        float32_t step = 2.0f * S->mu;           /* Normalized step size */
+        float32_t xr, xi, er, ei, scale, power;
+        uint32_t k;                              /* Loop counter */
+
+  /* X = FFT([x_previous, x]). arm_rfft_fast_f32() modifies its input: transform a copy */
+  memcpy(pScratch, S->pInput, numTaps * sizeof(float32_t));
+  memcpy(pScratch + numTaps, pSrc, numTaps * sizeof(float32_t));
+  memcpy(S->pInput, pSrc, numTaps * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->rfft, pScratch, pSpectrum, 0);
+
+  /* W = FFT([b, 0]), the coefficients in time order */
+  for (k = 0U; k < numTaps; k++)
+  {
+    pScratch[k] = pCoeffs[numTaps - 1U - k];
+  }
+  memset(pScratch + numTaps, 0, numTaps * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->rfft, pScratch, pWork, 0);
+
+  /* y = second half of IFFT(X * W); bin 0 holds the real DC and Nyquist values */
+  arm_cmplx_mult_cmplx_f32(pSpectrum, pWork, pScratch, numTaps);
+  pScratch[0] = pSpectrum[0] * pWork[0];
+  pScratch[1] = pSpectrum[1] * pWork[1];
+  arm_rfft_fast_f32(&S->rfft, pScratch, pWork, 1);
+
+  memcpy(pOut, pWork + numTaps, numTaps * sizeof(float32_t));
+  arm_sub_f32(pRef, pWork + numTaps, pErr, numTaps);
+
+  /* E = FFT([0, e]) */
+  memset(pScratch, 0, numTaps * sizeof(float32_t));
+  memcpy(pScratch + numTaps, pErr, numTaps * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->rfft, pScratch, pWork, 0);
+
+  /* The power estimates start from the mean power of the first block */
+  if (S->powerValid == 0U)
+  {
+    power = pSpectrum[0] * pSpectrum[0] + pSpectrum[1] * pSpectrum[1];
+    for (k = 1U; k < numTaps; k++)
+    {
+      power += pSpectrum[2U * k] * pSpectrum[2U * k] + pSpectrum[2U * k + 1U] * pSpectrum[2U * k + 1U];
+    }
+    power /= (float32_t) (numTaps + 1U);
+    for (k = 0U; k <= numTaps; k++)
+    {
+      pPower[k] = power;
+    }
+    S->powerValid = 1U;
+  }
+
+  /* 2 * mu * conj(X) * E / P: DC and Nyquist, then the complex bins */
+  pPower[0] = lambda * pPower[0] + (1.0f - lambda) * pSpectrum[0] * pSpectrum[0];
+  pPower[numTaps] = lambda * pPower[numTaps] + (1.0f - lambda) * pSpectrum[1] * pSpectrum[1];
+  pScratch[0] = step * pSpectrum[0] * pWork[0] / (pPower[0] + 0.000000119209289f);
+  pScratch[1] = step * pSpectrum[1] * pWork[1] / (pPower[numTaps] + 0.000000119209289f);
+
+  for (k = 1U; k < numTaps; k++)
+  {
+    xr = pSpectrum[2U * k];
+    xi = pSpectrum[2U * k + 1U];
+    er = pWork[2U * k];
+    ei = pWork[2U * k + 1U];
+
+    pPower[k] = lambda * pPower[k] + (1.0f - lambda) * (xr * xr + xi * xi);
+    scale = step / (pPower[k] + 0.000000119209289f);
+
+    pScratch[2U * k] = scale * (xr * er + xi * ei);
+    pScratch[2U * k + 1U] = scale * (xr * ei - xi * er);
+  }
+
+  /* The first half of the inverse transform is the gradient of b[0] to b[numTaps-1] */
+  arm_rfft_fast_f32(&S->rfft, pScratch, pWork, 1);
+
+  for (k = 0U; k < numTaps; k++)
+  {
+    pCoeffs[numTaps - 1U - k] += pWork[k];
+  }
+}
+
+/**
+  @} end of LMS_FD group
+ */
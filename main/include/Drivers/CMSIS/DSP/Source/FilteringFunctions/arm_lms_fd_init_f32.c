@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_lms_fd_init_f32.c
+ * Description:  Initialization function for the floating-point frequency-domain LMS filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LMS_FD
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point frequency-domain LMS filter.
+  @param[in,out] S        points to an instance of the floating-point frequency-domain LMS filter structure
+  @param[in]     numTaps  number of filter coefficients, and of samples processed per call
+  @param[in]     pCoeffs  points to coefficient buffer
+  @param[in]     pState   points to state buffer
+  @param[in]     mu       normalized step size that controls filter coefficient updates
+  @param[in]     lambda   forgetting factor of the power estimates
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is not a power of 2 between 16 and 2048
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+  <pre>
+     {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+                   The initial filter coefficients serve as a starting point for the adaptive filter.
+                   <code>pState</code> points to an array of <code>ARM_LMS_FD_STATE_LENGTH(numTaps)</code> samples.
+  @par
+                   <code>mu</code> is between 0 and 1, typically 0.1 to 0.5: a larger step converges
+                   faster, to a larger residual error. <code>lambda</code>, typically 0.9, trades the tracking of
+                   the input spectrum for the accuracy of the power estimates.
+ */
+arm_status arm_lms_fd_init_f32(
+        arm_lms_fd_instance_f32 * S,
+        uint16_t numTaps,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t mu,
+        float32_t lambda)
+{
+  uint32_t fftLen = 2U * numTaps;                /* Length of the transforms */
+  arm_status status;
+
+  if ((numTaps < 16U) || (numTaps > 2048U) || ((numTaps & (numTaps - 1U)) != 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->numTaps = numTaps;
+  S->powerValid = 0U;
+  S->mu = mu;
+  S->lambda = lambda;
+  S->pCoeffs = pCoeffs;
+
+  /* Buffers in the state array */
+  S->pInput = pState;
+  S->pSpectrum = S->pInput + numTaps;
+  S->pScratch = S->pSpectrum + fftLen;
+  S->pWork = S->pScratch + fftLen;
+  S->pPower = S->pWork + fftLen;
+
+  memset(pState, 0, ARM_LMS_FD_STATE_LENGTH(numTaps) * sizeof(float32_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of LMS_FD group
+ */
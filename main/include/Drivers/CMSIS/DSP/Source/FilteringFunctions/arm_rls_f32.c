@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rls_f32.c
+ * Description:  Processing function for the floating-point RLS filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup RLS Recursive Least Squares (RLS) Filter
+
+  The RLS filter is an adaptive FIR filter, with the inputs and outputs of the LMS filters of
+  \ref LMS, whose coefficients minimize the exponentially weighted sum of the squared errors
+  <pre>
+      e[0]^2 * lambda^n + e[1]^2 * lambda^(n-1) + ... + e[n]^2
+  </pre>
+  after each sample. It converges in a few times <code>numTaps</code> samples whatever the
+  spectrum of the input, where the LMS filters slow down on the eigenvalues of small input
+  power, at a cost of <code>O(numTaps^2)</code> operations per sample. The forgetting factor
+  <code>lambda</code>, just below 1, sets the memory of the filter to about
+  <code>1/(1-lambda)</code> samples: 1 for a time-invariant system, 0.99 to 0.999 to track drifts.
+
+  @par           Algorithm
+                   The filter keeps a lower triangular square root <code>L</code> of the inverse
+                   correlation matrix <code>P = L * L'</code> of the input, and updates it with Givens
+                   rotations (inverse QR-RLS). With <code>u</code> the last <code>numTaps</code> input samples
+                   in the order of the coefficients, each sample computes
+  <pre>
+      y = b' * u,  e = d - y
+      [1, (L' * u)' / sqrt(lambda)]               [gamma, 0]
+      [0, L / sqrt(lambda)         ] * rotations = [g,     L]
+      b = b + e * g / gamma
+  </pre>
+                   where <code>g / gamma</code> is the gain vector of the RLS filter. The rotations
+                   zero the elements of the first row from the last to the first, which keeps
+                   <code>L</code> triangular and its diagonal positive. Unlike the update of
+                   <code>P</code> itself, the update of its square root keeps <code>P</code> positive
+                   definite in single precision, and the filter does not diverge with
+                   <code>lambda</code> below 1.
+  @par
+                   A sample costs <code>numTaps</code> square roots and divisions and about
+                   <code>2.5*numTaps^2</code> multiplications, in dot products and rotations of
+                   contiguous columns of <code>L</code>.
+  @par
+                   The initial matrix is <code>P = I / delta</code>, a regularization that weighs
+                   little in the least squares when <code>delta</code> is small compared with the
+                   input power.
+
+  @par           Instance Structure
+                   <code>pCoeffs</code> points to the coefficients in time reversed order and
+                   <code>pState</code> to a state buffer of <code>numTaps+blockSize-1</code> samples, as for
+                   arm_lms_f32(). <code>pFactor</code> points to a buffer of
+                   <code>ARM_RLS_FACTOR_LENGTH(numTaps)</code> samples: the columns of <code>L</code>,
+                   from the diagonal down, followed by the vector <code>g</code>.
+                   The initialization function must be used: it initializes <code>L</code>.
+ */
+
+/**
+  @addtogroup RLS
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point RLS filter.
+  @param[in]     S          points to an instance of the floating-point RLS filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     pRef       points to the block of reference data
+  @param[out]    pOut       points to the block of output data
+  @param[out]    pErr       points to the block of error data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_rls_f32(
+  const arm_rls_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+        float32_t * pOut,
+        float32_t * pErr,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;           /* State pointer */
+        float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+        uint32_t numTaps = S->numTaps;           /* Number of filter coefficients in the filter */
+        float32_t *pGain = S->pFactor + numTaps * (numTaps + 1U) / 2U;  /* g, after the columns of L */
+        float32_t *pCol;                         /* Column of L, from its diagonal */
+        float32_t *pG;                           /* Rows of g rotated with pCol */
+  const float32_t *pU;                           /* Last numTaps input samples */
+        float32_t scale;                         /* 1 / sqrt(lambda) */
+        float32_t gamma;                         /* First element of the rotated first row */
+        float32_t acc, err, a, r, c, s, gj, lj;
+        uint32_t n, i, j, len;                   /* Loop counters */
+
+  arm_sqrt_f32(1.0f / S->lambda, &scale);
+
+  /* The new samples follow the numTaps-1 previous ones in the state buffer */
+  memcpy(pState + (numTaps - 1U), pSrc, blockSize * sizeof(float32_t));
+
+  for (n = 0U; n < blockSize; n++)
+  {
+    pU = pState + n;
+
+    /* A priori output and error */
+    arm_dot_prod_f32(pCoeffs, pU, numTaps, &acc);
+    err = pRef[n] - acc;
+    pOut[n] = acc;
+    pErr[n] = err;
+
+    /* Rotations from the last column of L, of length 1, to the first */
+    memset(pGain, 0, numTaps * sizeof(float32_t));
+    gamma = 1.0f;
+    pCol = S->pFactor + numTaps * (numTaps + 1U) / 2U;
+
+    for (i = numTaps; i > 0U; i--)
+    {
+      len = numTaps - i + 1U;
+      pCol -= len;
+
+      /* Element of the first row: column i-1 of L, rows i-1 to numTaps-1, times u */
+      arm_dot_prod_f32(pCol, pU + (i - 1U), len, &a);
+      a *= scale;
+
+      arm_sqrt_f32(gamma * gamma + a * a, &r);
+      c = gamma / r;
+      s = a / r;
+      gamma = r;
+
+      /* g has no element above row i-1: rotate rows i-1 to numTaps-1 */
+      pG = pGain + (i - 1U);
+      for (j = 0U; j < len; j++)
+      {
+        gj = pG[j];
+        lj = scale * pCol[j];
+        pG[j] = c * gj + s * lj;
+        pCol[j] = c * lj - s * gj;
+      }
+    }
+
+    /* b = b + e * g / gamma */
+    arm_scale_f32(pGain, err / gamma, pGain, numTaps);
+    arm_add_f32(pCoeffs, pGain, pCoeffs, numTaps);
+  }
+
+  /* Keep the last numTaps-1 samples for the next call */
+  memmove(pState, pState + blockSize, (numTaps - 1U) * sizeof(float32_t));
+}
+
+/**
+  @} end of RLS group
+ */
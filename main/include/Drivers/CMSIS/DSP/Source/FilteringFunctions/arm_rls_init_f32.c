@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rls_init_f32.c
+ * Description:  Initialization function for the floating-point RLS filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup RLS
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point RLS filter.
+  @param[in]     S          points to an instance of the floating-point RLS filter structure
+  @param[in]     numTaps    number of filter coefficients
+  @param[in]     pCoeffs    points to coefficient buffer
+  @param[in]     pState     points to state buffer
+  @param[in]     pFactor    points to factor buffer
+  @param[in]     lambda     forgetting factor
+  @param[in]     delta      regularization of the initial inverse correlation matrix
+  @param[in]     blockSize  largest number of samples processed per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0, <code>lambda</code> is not in (0, 1] or <code>delta</code> is not positive
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+  <pre>
+     {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+                   The initial filter coefficients serve as a starting point for the adaptive filter.
+                   <code>pState</code> points to an array of length <code>numTaps+blockSize-1</code> samples
+                   and <code>pFactor</code> to an array of <code>ARM_RLS_FACTOR_LENGTH(numTaps)</code> samples.
+  @par
+                   The square root of the inverse correlation matrix starts as the identity divided by
+                   <code>sqrt(delta)</code>. A typical <code>delta</code> is 0.01 times the input power.
+ */
+arm_status arm_rls_init_f32(
+        arm_rls_instance_f32 * S,
+        uint16_t numTaps,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t * pFactor,
+        float32_t lambda,
+        float32_t delta,
+        uint32_t blockSize)
+{
+  float32_t diag;                                /* Diagonal of the initial square root */
+  float32_t *pCol = pFactor;                     /* Column of the square root, from its diagonal */
+  uint32_t i;                                    /* Loop counter */
+
+  if ((numTaps == 0U) || !(lambda > 0.0f) || (lambda > 1.0f) || !(delta > 0.0f))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+  S->pFactor = pFactor;
+  S->lambda = lambda;
+
+  /* L = I / sqrt(delta), packed by columns, and g = 0 */
+  memset(pFactor, 0, ARM_RLS_FACTOR_LENGTH(numTaps) * sizeof(float32_t));
+  arm_sqrt_f32(1.0f / delta, &diag);
+  for (i = 0U; i < numTaps; i++)
+  {
+    *pCol = diag;
+    pCol += numTaps - i;
+  }
+
+  /* Clear the state buffer */
+  memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+  S->pState = pState;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of RLS group
+ */
@@ -62,7 +62,118 @@
  * @return     		The function returns either
  * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
  */
-#if defined(ARM_MATH_NEON)
+#if defined(ARM_MATH_X86_SIMD)
+
+/*
+ * x86-64 host version: each lane computes one output column, and the products
+ * are added in the order of the scalar version, so that the results are the same.
+ */
+arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;          /* Input data matrix pointer A */
+  const float32_t *pIn2;                         /* Input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* Output data matrix pointer */
+  float32_t sum;                                 /* Accumulator */
+  uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t col, row = numRowsA, k;               /* Loop counters */
+  arm_status status;                             /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* row loop */
+    while (row > 0U)
+    {
+      col = 0U;
+
+#if defined(ARM_MATH_X86_AVX2)
+      /* Compute 8 columns at a time */
+      while (col + 8U <= numColsB)
+      {
+        __m256 acc = _mm256_setzero_ps();
+
+        pIn2 = pSrcB->pData + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          /* c(m,n..n+7) += a(m,k) * b(k,n..n+7) */
+          acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_set1_ps(pInA[k]), _mm256_loadu_ps(pIn2)));
+          pIn2 += numColsB;
+        }
+
+        _mm256_storeu_ps(pOut + col, acc);
+        col += 8U;
+      }
+#endif /* #if defined(ARM_MATH_X86_AVX2) */
+
+      /* Compute 4 columns at a time */
+      while (col + 4U <= numColsB)
+      {
+        __m128 acc = _mm_setzero_ps();
+
+        pIn2 = pSrcB->pData + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          /* c(m,n..n+3) += a(m,k) * b(k,n..n+3) */
+          acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(pInA[k]), _mm_loadu_ps(pIn2)));
+          pIn2 += numColsB;
+        }
+
+        _mm_storeu_ps(pOut + col, acc);
+        col += 4U;
+      }
+
+      /* Remaining columns */
+      while (col < numColsB)
+      {
+        sum = 0.0f;
+        pIn2 = pSrcB->pData + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          sum += pInA[k] * *pIn2;
+          pIn2 += numColsB;
+        }
+
+        pOut[col] = sum;
+        col++;
+      }
+
+      /* Next row of A and of the destination */
+      pInA += numColsA;
+      pOut += numColsB;
+
+      /* Decrement row loop counter */
+      row--;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+#elif defined(ARM_MATH_NEON)
 
 #define GROUPOFROWS 8
 
@@ -527,7 +638,7 @@ arm_status arm_mat_mult_f32(
   return (status);
 }
 
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
 
 /**
  * @} end of MatrixMult group
@@ -57,7 +57,8 @@
   @param[out]    pResult    mean value returned here.
   @return        none
  */
-#if defined(ARM_MATH_NEON_EXPERIMENTAL)
+/* Not with ARM_MATH_X86_SIMD: the host keeps the sequential sum of the Cortex-M builds */
+#if defined(ARM_MATH_NEON_EXPERIMENTAL) && !defined(ARM_MATH_X86_SIMD)
 void arm_mean_f32(
   const float32_t * pSrc,
   uint32_t blockSize,
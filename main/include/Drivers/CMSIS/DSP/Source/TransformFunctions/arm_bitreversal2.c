@@ -42,6 +42,23 @@ void arm_bitreversal_32(
   const uint16_t bitRevLen, 
   const uint16_t *pBitRevTab)
 {
+#if defined(ARM_MATH_NEON)
+  uint32_t a, b, i;
+  uint32x2_t va, vb;
+
+  /* Each complex value is swapped as one 64-bit vector, in table order: the swaps of
+     the mixed-radix tables share indices */
+  for (i = 0; i < bitRevLen; i += 2)
+  {
+     a = pBitRevTab[i    ] >> 2;
+     b = pBitRevTab[i + 1] >> 2;
+
+     va = vld1_u32(pSrc + a);
+     vb = vld1_u32(pSrc + b);
+     vst1_u32(pSrc + a, vb);
+     vst1_u32(pSrc + b, va);
+  }
+#else
   uint32_t a, b, i, tmp;
 
   for (i = 0; i < bitRevLen; )
@@ -61,6 +78,7 @@ void arm_bitreversal_32(
 
     i += 2;
   }
+#endif /* #if defined(ARM_MATH_NEON) */
 }
 
 
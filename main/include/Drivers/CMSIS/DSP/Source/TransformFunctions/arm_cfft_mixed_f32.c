@@ -0,0 +1,311 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Mixed-radix complex FFT for lengths 2^a * 3^b * 5^c
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup ComplexFFTMixed Mixed-Radix Complex FFT Functions
+
+  @par
+                   arm_cfft_f32() covers the powers of 2 from 16 to 4096. Signals sampled at
+                   multiples of 50 or 60 Hz are better analysed with lengths such as 60, 120, 240,
+                   480 or 960, which would otherwise have to be zero-padded to the next power of 2.
+                   The mixed-radix CFFT supports every length of the form <code>2^a * 3^b * 5^c</code>
+                   with the same data format as arm_cfft_f32(): <code>2*fftLen</code> interleaved
+                   values, transformed in-place, the inverse transform being scaled by
+                   <code>1/fftLen</code>.
+  @par           Algorithm
+                   The length is factored into radix-8, radix-4 or radix-2, radix-5 and radix-3
+                   stages. Each stage combines <code>radix</code> transforms of length <code>Lp</code>
+                   into one of length <code>L = radix*Lp</code>:
+  <pre>
+      X[k1 + Lp*k2] = sum(r = 0..radix-1) W_L^(r*k1) * W_radix^(r*k2) * X_r[k1]
+  </pre>
+  @par
+                   The stages alternate between the data buffer and the work buffer of the instance
+                   (Stockham autosort), so the output is in natural order without bit or digit
+                   reversal. The inverse transform conjugates its input and output.
+  @par           Initialization
+                   There are no constant tables: arm_cfft_mixed_init_f32() factors the length and
+                   computes the <code>fftLen</code> twiddle factors in double precision into the
+                   state buffer, which also holds the work buffer. The instance can then be used
+                   for forward and inverse transforms of that length.
+ */
+
+/**
+  @addtogroup ComplexFFTMixed
+  @{
+ */
+
+/* Radix-4 DFT of (a0, a1, a2, a3) */
+#define ARM_CFFT_MIXED_DFT4(a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i) \
+  do                                                                                                          \
+  {                                                                                                           \
+    float32_t t0r = (a0r) + (a2r), t0i = (a0i) + (a2i);                                                       \
+    float32_t t1r = (a0r) - (a2r), t1i = (a0i) - (a2i);                                                       \
+    float32_t t2r = (a1r) + (a3r), t2i = (a1i) + (a3i);                                                       \
+    float32_t t3r = (a1r) - (a3r), t3i = (a1i) - (a3i);                                                       \
+    b0r = t0r + t2r; b0i = t0i + t2i;                                                                         \
+    b2r = t0r - t2r; b2i = t0i - t2i;                                                                         \
+    b1r = t1r + t3i; b1i = t1i - t3r;                                                                         \
+    b3r = t1r - t3i; b3i = t1i + t3r;                                                                         \
+  } while (0)
+
+/**
+  @brief         Radix DFT of one group of the stage, in-place on x.
+  @param[in,out] xr      real parts
+  @param[in,out] xi      imaginary parts
+  @param[in]     radix   2, 3, 4, 5 or 8
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_dft_f32(
+        float32_t * xr,
+        float32_t * xi,
+        uint32_t radix)
+{
+  const float32_t c3 = 0.866025403784438647f;            /* sin(2*pi/3) */
+  const float32_t c51 = 0.309016994374947424f;           /* cos(2*pi/5) */
+  const float32_t c52 = -0.809016994374947424f;          /* cos(4*pi/5) */
+  const float32_t s51 = 0.951056516295153572f;           /* sin(2*pi/5) */
+  const float32_t s52 = 0.587785252292473129f;           /* sin(4*pi/5) */
+  const float32_t c8 = 0.707106781186547524f;            /* cos(pi/4) */
+  float32_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  float32_t m1r, m1i, m2r, m2i, n1r, n1i, n2r, n2i;
+  float32_t er[4], ei[4], odr[4], odi[4];
+
+  switch (radix)
+  {
+  case 2U:
+    t1r = xr[0] - xr[1]; t1i = xi[0] - xi[1];
+    xr[0] = xr[0] + xr[1]; xi[0] = xi[0] + xi[1];
+    xr[1] = t1r; xi[1] = t1i;
+    break;
+
+  case 3U:
+    /* X1,2 = x0 - (x1 + x2)/2 -/+ i*sin(2*pi/3)*(x1 - x2) */
+    t1r = xr[1] + xr[2]; t1i = xi[1] + xi[2];
+    t2r = c3 * (xr[1] - xr[2]); t2i = c3 * (xi[1] - xi[2]);
+    m1r = xr[0] - 0.5f * t1r; m1i = xi[0] - 0.5f * t1i;
+    xr[0] = xr[0] + t1r; xi[0] = xi[0] + t1i;
+    xr[1] = m1r + t2i; xi[1] = m1i - t2r;
+    xr[2] = m1r - t2i; xi[2] = m1i + t2r;
+    break;
+
+  case 4U:
+    ARM_CFFT_MIXED_DFT4(xr[0], xi[0], xr[1], xi[1], xr[2], xi[2], xr[3], xi[3],
+                        er[0], ei[0], er[1], ei[1], er[2], ei[2], er[3], ei[3]);
+    xr[0] = er[0]; xi[0] = ei[0];
+    xr[1] = er[1]; xi[1] = ei[1];
+    xr[2] = er[2]; xi[2] = ei[2];
+    xr[3] = er[3]; xi[3] = ei[3];
+    break;
+
+  case 5U:
+    t1r = xr[1] + xr[4]; t1i = xi[1] + xi[4];
+    t2r = xr[2] + xr[3]; t2i = xi[2] + xi[3];
+    t3r = xr[1] - xr[4]; t3i = xi[1] - xi[4];
+    t4r = xr[2] - xr[3]; t4i = xi[2] - xi[3];
+    m1r = xr[0] + c51 * t1r + c52 * t2r; m1i = xi[0] + c51 * t1i + c52 * t2i;
+    m2r = xr[0] + c52 * t1r + c51 * t2r; m2i = xi[0] + c52 * t1i + c51 * t2i;
+    n1r = s51 * t3r + s52 * t4r; n1i = s51 * t3i + s52 * t4i;
+    n2r = s52 * t3r - s51 * t4r; n2i = s52 * t3i - s51 * t4i;
+    xr[0] = xr[0] + t1r + t2r; xi[0] = xi[0] + t1i + t2i;
+    /* X1,4 = m1 -/+ i*n1, X2,3 = m2 -/+ i*n2 */
+    xr[1] = m1r + n1i; xi[1] = m1i - n1r;
+    xr[4] = m1r - n1i; xi[4] = m1i + n1r;
+    xr[2] = m2r + n2i; xi[2] = m2i - n2r;
+    xr[3] = m2r - n2i; xi[3] = m2i + n2r;
+    break;
+
+  default:
+    /* Radix 8: DFT4 of the even and odd samples, odd ones twiddled by W_8^k */
+    ARM_CFFT_MIXED_DFT4(xr[0], xi[0], xr[2], xi[2], xr[4], xi[4], xr[6], xi[6],
+                        er[0], ei[0], er[1], ei[1], er[2], ei[2], er[3], ei[3]);
+    ARM_CFFT_MIXED_DFT4(xr[1], xi[1], xr[3], xi[3], xr[5], xi[5], xr[7], xi[7],
+                        odr[0], odi[0], odr[1], odi[1], odr[2], odi[2], odr[3], odi[3]);
+    t1r = c8 * (odr[1] + odi[1]); t1i = c8 * (odi[1] - odr[1]);
+    t2r = odi[2];                 t2i = -odr[2];
+    t3r = c8 * (odi[3] - odr[3]); t3i = -c8 * (odr[3] + odi[3]);
+    xr[0] = er[0] + odr[0]; xi[0] = ei[0] + odi[0];
+    xr[4] = er[0] - odr[0]; xi[4] = ei[0] - odi[0];
+    xr[1] = er[1] + t1r;    xi[1] = ei[1] + t1i;
+    xr[5] = er[1] - t1r;    xi[5] = ei[1] - t1i;
+    xr[2] = er[2] + t2r;    xi[2] = ei[2] + t2i;
+    xr[6] = er[2] - t2r;    xi[6] = ei[2] - t2i;
+    xr[3] = er[3] + t3r;    xi[3] = ei[3] + t3i;
+    xr[7] = er[3] - t3r;    xi[7] = ei[3] - t3i;
+    break;
+  }
+}
+
+/**
+  @brief         One stage: combines radix transforms of length Lp into transforms of length radix*Lp.
+  @param[in]     pSrc      points to the Sp*radix input transforms of length Lp
+  @param[out]    pDst      points to the Sp output transforms of length radix*Lp
+  @param[in]     radix     radix of the stage
+  @param[in]     Lp        length of the input transforms
+  @param[in]     Sp        number of output transforms
+  @param[in]     pTwiddle  points to the twiddle factors W_N^k
+  @param[in]     twStride  N / (radix*Lp)
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_stage_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t radix,
+        uint32_t Lp,
+        uint32_t Sp,
+  const float32_t * pTwiddle,
+        uint32_t twStride)
+{
+  float32_t xr[8], xi[8];                        /* Group being transformed */
+  float32_t wr[8], wi[8];                        /* Twiddle factors of the group */
+  float32_t ar, ai;
+  uint32_t L = radix * Lp;                       /* Length of the output transforms */
+  uint32_t k1, s, r;
+  const float32_t *pIn;
+  float32_t *pOut;
+
+  for (k1 = 0U; k1 < Lp; k1++)
+  {
+    /* W_L^(r*k1) = W_N^(r*k1*N/L), with r*k1 < L */
+    for (r = 1U; r < radix; r++)
+    {
+      wr[r] = pTwiddle[2U * (r * k1 * twStride)];
+      wi[r] = pTwiddle[2U * (r * k1 * twStride) + 1U];
+    }
+
+    for (s = 0U; s < Sp; s++)
+    {
+      pIn = pSrc + 2U * (s * Lp + k1);
+      xr[0] = pIn[0];
+      xi[0] = pIn[1];
+      for (r = 1U; r < radix; r++)
+      {
+        ar = pIn[2U * r * Sp * Lp];
+        ai = pIn[2U * r * Sp * Lp + 1U];
+        xr[r] = ar * wr[r] - ai * wi[r];
+        xi[r] = ar * wi[r] + ai * wr[r];
+      }
+
+      arm_cfft_mixed_dft_f32(xr, xi, radix);
+
+      pOut = pDst + 2U * (s * L + k1);
+      for (r = 0U; r < radix; r++)
+      {
+        pOut[2U * r * Lp] = xr[r];
+        pOut[2U * r * Lp + 1U] = xi[r];
+      }
+    }
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point mixed-radix complex FFT.
+  @param[in]     S         points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in,out] p1        points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag  flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+ */
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag)
+{
+  uint32_t fftLen = S->fftLen;                   /* Length of the transform */
+  float32_t *pSrc = p1;                          /* Input of the stage */
+  float32_t *pDst = S->pBuffer;                  /* Output of the stage */
+  float32_t *pTmp;
+  float32_t invL;
+  uint32_t Lp = 1U;                              /* Length of the transforms combined by the stage */
+  uint32_t Sp = fftLen;                          /* Number of transforms of length Lp */
+  uint32_t stage, radix, i;
+
+  /* Inverse transform: conj(FFT(conj(x))) / fftLen */
+  if (ifftFlag == 1U)
+  {
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[2U * i + 1U] = -p1[2U * i + 1U];
+    }
+  }
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    radix = S->radix[stage];
+    Sp /= radix;
+
+    /* Constant radix, so that each case gets its own loop */
+    switch (radix)
+    {
+    case 2U:
+      arm_cfft_mixed_stage_f32(pSrc, pDst, 2U, Lp, Sp, S->pTwiddle, Sp);
+      break;
+    case 3U:
+      arm_cfft_mixed_stage_f32(pSrc, pDst, 3U, Lp, Sp, S->pTwiddle, Sp);
+      break;
+    case 4U:
+      arm_cfft_mixed_stage_f32(pSrc, pDst, 4U, Lp, Sp, S->pTwiddle, Sp);
+      break;
+    case 5U:
+      arm_cfft_mixed_stage_f32(pSrc, pDst, 5U, Lp, Sp, S->pTwiddle, Sp);
+      break;
+    default:
+      arm_cfft_mixed_stage_f32(pSrc, pDst, 8U, Lp, Sp, S->pTwiddle, Sp);
+      break;
+    }
+
+    Lp *= radix;
+    pTmp = pSrc;
+    pSrc = pDst;
+    pDst = pTmp;
+  }
+
+  if (pSrc != p1)
+  {
+    memcpy(p1, pSrc, 2U * fftLen * sizeof(float32_t));
+  }
+
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t) fftLen;
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[2U * i] = p1[2U * i] * invL;
+      p1[2U * i + 1U] = -p1[2U * i + 1U] * invL;
+    }
+  }
+}
+
+/**
+  @} end of ComplexFFTMixed group
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix complex FFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFTMixed
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+  @param[out]    S       points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     fftLen  length of the FFT: <code>2^a * 3^b * 5^c</code>, at least 2
+  @param[in]     pState  points to the state buffer of <code>ARM_CFFT_MIXED_STATE_LENGTH(fftLen)</code> samples
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> has a prime factor other than 2, 3 and 5
+
+  @par           Details
+                   The powers of 2 use radix-8 stages, and a radix-4 or radix-2 stage for the
+                   remaining factor, followed by the radix-5 and radix-3 stages.
+                   The twiddle factors are computed in double precision.
+ */
+
+arm_status arm_cfft_mixed_init_f32(
+        arm_cfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pState)
+{
+  uint32_t n = fftLen;                           /* Factor left */
+  uint32_t numStages = 0U;
+  uint32_t k;
+  float64_t angle;
+
+  if (fftLen < 2U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Factor the length */
+  while (n % 8U == 0U)
+  {
+    S->radix[numStages++] = 8U;
+    n /= 8U;
+  }
+  if (n % 4U == 0U)
+  {
+    S->radix[numStages++] = 4U;
+    n /= 4U;
+  }
+  else if (n % 2U == 0U)
+  {
+    S->radix[numStages++] = 2U;
+    n /= 2U;
+  }
+  while (n % 5U == 0U)
+  {
+    S->radix[numStages++] = 5U;
+    n /= 5U;
+  }
+  while (n % 3U == 0U)
+  {
+    S->radix[numStages++] = 3U;
+    n /= 3U;
+  }
+  if (n != 1U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->fftLen = fftLen;
+  S->numStages = (uint16_t) numStages;
+  S->pTwiddle = pState;
+  S->pBuffer = pState + 2U * fftLen;
+
+  /* W_N^k = exp(-2*pi*i*k/N) */
+  for (k = 0U; k < fftLen; k++)
+  {
+    angle = 6.283185307179586476925 * (float64_t) k / (float64_t) fftLen;
+    S->pTwiddle[2U * k] = (float32_t) cos(angle);
+    S->pTwiddle[2U * k + 1U] = (float32_t) -sin(angle);
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFTMixed group
+ */
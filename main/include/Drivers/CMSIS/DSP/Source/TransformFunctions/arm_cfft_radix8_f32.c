@@ -42,6 +42,222 @@
   return        none
 */
 
+#if defined(ARM_MATH_NEON)
+
+/* Radix-8 butterflies on four lanes, one butterfly per lane, with the operations of the
+   scalar version: xr[m] and xi[m] hold input m, replaced by output m, and output m is
+   multiplied by cr[m] + i ci[m] unless cr is NULL */
+static inline void arm_radix8_butterfly_lanes_f32(
+  float32x4_t * xr,
+  float32x4_t * xi,
+  const float32x4_t * cr,
+  const float32x4_t * ci)
+{
+   float32x4_t r1, r2, r3, r4, r5, r6, r7, r8;
+   float32x4_t s1, s2, s3, s4, s5, s6, s7, s8;
+   float32x4_t t1, t2;
+   const float32x4_t C81 = vdupq_n_f32(0.70710678118f);
+   uint32_t m;
+
+   r1 = vaddq_f32(xr[0], xr[4]);
+   r5 = vsubq_f32(xr[0], xr[4]);
+   r2 = vaddq_f32(xr[1], xr[5]);
+   r6 = vsubq_f32(xr[1], xr[5]);
+   r3 = vaddq_f32(xr[2], xr[6]);
+   r7 = vsubq_f32(xr[2], xr[6]);
+   r4 = vaddq_f32(xr[3], xr[7]);
+   r8 = vsubq_f32(xr[3], xr[7]);
+   t1 = vsubq_f32(r1, r3);
+   r1 = vaddq_f32(r1, r3);
+   r3 = vsubq_f32(r2, r4);
+   r2 = vaddq_f32(r2, r4);
+   s1 = vaddq_f32(xi[0], xi[4]);
+   s5 = vsubq_f32(xi[0], xi[4]);
+   s2 = vaddq_f32(xi[1], xi[5]);
+   s6 = vsubq_f32(xi[1], xi[5]);
+   s3 = vaddq_f32(xi[2], xi[6]);
+   s7 = vsubq_f32(xi[2], xi[6]);
+   s4 = vaddq_f32(xi[3], xi[7]);
+   s8 = vsubq_f32(xi[3], xi[7]);
+   t2 = vsubq_f32(s1, s3);
+   s1 = vaddq_f32(s1, s3);
+   s3 = vsubq_f32(s2, s4);
+   s2 = vaddq_f32(s2, s4);
+   xr[0] = vaddq_f32(r1, r2);
+   xi[0] = vaddq_f32(s1, s2);
+   xr[4] = vsubq_f32(r1, r2);
+   xi[4] = vsubq_f32(s1, s2);
+   xr[2] = vaddq_f32(t1, s3);
+   xi[2] = vsubq_f32(t2, r3);
+   xr[6] = vsubq_f32(t1, s3);
+   xi[6] = vaddq_f32(t2, r3);
+   r1 = vmulq_f32(vsubq_f32(r6, r8), C81);
+   r6 = vmulq_f32(vaddq_f32(r6, r8), C81);
+   s1 = vmulq_f32(vsubq_f32(s6, s8), C81);
+   s6 = vmulq_f32(vaddq_f32(s6, s8), C81);
+   t1 = vsubq_f32(r5, r1);
+   r5 = vaddq_f32(r5, r1);
+   r8 = vsubq_f32(r7, r6);
+   r7 = vaddq_f32(r7, r6);
+   t2 = vsubq_f32(s5, s1);
+   s5 = vaddq_f32(s5, s1);
+   s8 = vsubq_f32(s7, s6);
+   s7 = vaddq_f32(s7, s6);
+   xr[1] = vaddq_f32(r5, s7);
+   xi[1] = vsubq_f32(s5, r7);
+   xr[7] = vsubq_f32(r5, s7);
+   xi[7] = vaddq_f32(s5, r7);
+   xr[5] = vaddq_f32(t1, s8);
+   xi[5] = vsubq_f32(t2, r8);
+   xr[3] = vsubq_f32(t1, s8);
+   xi[3] = vaddq_f32(t2, r8);
+
+   if (cr != NULL)
+   {
+      for (m = 1; m < 8; m++)
+      {
+         r1 = xr[m];
+         s1 = xi[m];
+         xr[m] = vaddq_f32(vmulq_f32(cr[m], r1), vmulq_f32(ci[m], s1));
+         xi[m] = vsubq_f32(vmulq_f32(cr[m], s1), vmulq_f32(ci[m], r1));
+      }
+   }
+}
+
+/* Transposition of a 4x4 block: lane j of v[i] becomes lane i of v[j] */
+static inline void arm_radix8_transpose_f32(float32x4_t * v)
+{
+   float32x4x2_t t0 = vtrnq_f32(v[0], v[1]);
+   float32x4x2_t t1 = vtrnq_f32(v[2], v[3]);
+
+   v[0] = vcombine_f32(vget_low_f32(t0.val[0]), vget_low_f32(t1.val[0]));
+   v[1] = vcombine_f32(vget_low_f32(t0.val[1]), vget_low_f32(t1.val[1]));
+   v[2] = vcombine_f32(vget_high_f32(t0.val[0]), vget_high_f32(t1.val[0]));
+   v[3] = vcombine_f32(vget_high_f32(t0.val[1]), vget_high_f32(t1.val[1]));
+}
+
+/* Same butterflies as the scalar version, four at a time:
+   - stages with twiddles: the butterflies j to j + 3 of a group, whose inputs are
+     consecutive samples (the first one, j = 0, is multiplied by the twiddle 1 + 0i of
+     the table, which leaves finite values unchanged),
+   - last stage: four groups of eight consecutive samples, transposed so that each
+     lane holds one group.
+   The results of finite inputs are those of the scalar version. */
+void arm_radix8_butterfly_f32(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  const float32_t * pCoef,
+  uint16_t twidCoefModifier)
+{
+   float32x4_t xr[8], xi[8];                      /* Inputs then outputs of four butterflies */
+   float32x4_t cr[8], ci[8];                      /* Twiddles of the outputs */
+   float32x4x2_t v;
+   float32_t twR[4], twI[4];
+   float32_t * pGroup;
+   uint32_t n1, n2, i1, j, k, l, m;
+
+   n1 = fftLen;
+   n2 = n1 >> 3;
+
+   while (n2 >= 8U)
+   {
+      for (j = 0; j < n2; j += 4)
+      {
+         for (m = 1; m < 8; m++)
+         {
+            for (l = 0; l < 4; l++)
+            {
+               k = 2U * m * (j + l) * twidCoefModifier;
+               twR[l] = pCoef[k];
+               twI[l] = pCoef[k + 1];
+            }
+            cr[m] = vld1q_f32(twR);
+            ci[m] = vld1q_f32(twI);
+         }
+
+         for (i1 = j; i1 < fftLen; i1 += n1)
+         {
+            for (m = 0; m < 8; m++)
+            {
+               v = vld2q_f32(pSrc + 2U * (i1 + m * n2));
+               xr[m] = v.val[0];
+               xi[m] = v.val[1];
+            }
+
+            arm_radix8_butterfly_lanes_f32(xr, xi, cr, ci);
+
+            for (m = 0; m < 8; m++)
+            {
+               v.val[0] = xr[m];
+               v.val[1] = xi[m];
+               vst2q_f32(pSrc + 2U * (i1 + m * n2), v);
+            }
+         }
+      }
+
+      twidCoefModifier <<= 3;
+      n1 = n2;
+      n2 = n2 >> 3;
+   }
+
+   /* Last stage (n2 = 1): no twiddles. A transform of 8 samples is a single butterfly,
+      computed in the first lane. */
+   if (fftLen < 32U)
+   {
+      for (m = 0; m < 8; m++)
+      {
+         xr[m] = vdupq_n_f32(pSrc[2U * m]);
+         xi[m] = vdupq_n_f32(pSrc[2U * m + 1U]);
+      }
+
+      arm_radix8_butterfly_lanes_f32(xr, xi, NULL, NULL);
+
+      for (m = 0; m < 8; m++)
+      {
+         pSrc[2U * m] = xr[m][0];
+         pSrc[2U * m + 1U] = xi[m][0];
+      }
+      return;
+   }
+
+   for (i1 = 0; i1 < fftLen; i1 += 32)
+   {
+      pGroup = pSrc + 2U * i1;
+
+      for (l = 0; l < 4; l++)
+      {
+         v = vld2q_f32(pGroup + 16U * l);
+         xr[l] = v.val[0];
+         xi[l] = v.val[1];
+         v = vld2q_f32(pGroup + 16U * l + 8U);
+         xr[l + 4] = v.val[0];
+         xi[l + 4] = v.val[1];
+      }
+      arm_radix8_transpose_f32(xr);
+      arm_radix8_transpose_f32(xr + 4);
+      arm_radix8_transpose_f32(xi);
+      arm_radix8_transpose_f32(xi + 4);
+
+      arm_radix8_butterfly_lanes_f32(xr, xi, NULL, NULL);
+
+      arm_radix8_transpose_f32(xr);
+      arm_radix8_transpose_f32(xr + 4);
+      arm_radix8_transpose_f32(xi);
+      arm_radix8_transpose_f32(xi + 4);
+      for (l = 0; l < 4; l++)
+      {
+         v.val[0] = xr[l];
+         v.val[1] = xi[l];
+         vst2q_f32(pGroup + 16U * l, v);
+         v.val[0] = xr[l + 4];
+         v.val[1] = xi[l + 4];
+         vst2q_f32(pGroup + 16U * l + 8U, v);
+      }
+   }
+}
+
+#else
+
 void arm_radix8_butterfly_f32(
   float32_t * pSrc,
   uint16_t fftLen,
@@ -283,3 +499,5 @@ void arm_radix8_butterfly_f32(
       twidCoefModifier <<= 3;
    } while (n2 > 7);
 }
+
+#endif /* #if defined(ARM_MATH_NEON) */
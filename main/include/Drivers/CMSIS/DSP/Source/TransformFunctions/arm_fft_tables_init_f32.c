@@ -0,0 +1,333 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fft_tables_init_f32.c
+ * Description:  Run-time generation of the floating-point FFT tables
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup FFTTablesInit Run-Time FFT Tables
+
+  @par
+                   The initialization functions of this group compute the twiddle factors and
+                   the bit reversal table of arm_cfft_f32() and arm_rfft_fast_f32() for one
+                   length, into an arena provided by the application, instead of pointing the
+                   instance at the constant tables of arm_common_tables.c. The tables have the
+                   layout of the constant ones, so the processing functions are unchanged.
+  @par
+                   The arena is typically a static buffer in DTCM (the default RAM) or in AXI
+                   SRAM (section <code>.axisram</code>), sized with \ref ARM_CFFT_TABLES_SIZE_F32
+                   and \ref ARM_RFFT_FAST_TABLES_SIZE_F32. Built with
+                   <code>ARM_DSP_CONFIG_TABLES</code> and no FFT table selected (CMake options
+                   <code>CONFIGTABLE</code> and <code>FFTGEN</code>), the application no longer
+                   links any floating-point FFT table: about 120 KB of flash for all the
+                   lengths, 40 KB for the 4096-point CFFT alone.
+  @par
+                   The first octant of the twiddle factors is computed with a double precision
+                   sine/cosine recurrence and the rest by symmetry, so the init only calls
+                   <code>sin()</code> twice per table.
+ */
+
+/**
+  @addtogroup FFTTablesInit
+  @{
+ */
+
+/**
+  @brief         Allocates a block of the arena, 8-byte aligned.
+  @param[in,out] A     points to the arena
+  @param[in]     size  size of the block in bytes
+  @return        start of the block, or NULL if the arena is too small
+ */
+static void * arm_fft_table_arena_alloc(
+  arm_fft_table_arena * A,
+  uint32_t size)
+{
+  uint32_t offset = (A->used + 7U) & ~7U;
+
+  if (offset > A->size || size > A->size - offset)
+  {
+    return NULL;
+  }
+
+  A->used = offset + size;
+  return A->pBase + offset;
+}
+
+/**
+  @brief         Generates the interleaved cosine and sine of <code>2*pi*k/M</code>.
+  @param[out]    pDst    points to the table of <code>2*count</code> values
+  @param[in]     M       period of the table in entries, a multiple of 8
+  @param[in]     count   number of entries, at most M
+  @param[in]     cosOfs  0: cosine first in each pair (CFFT), 1: sine first (RFFT)
+ */
+static void arm_fft_twiddle_gen_f32(
+  float32_t * pDst,
+  uint32_t M,
+  uint32_t count,
+  uint32_t cosOfs)
+{
+  uint32_t sinOfs = 1U - cosOfs;
+  uint32_t k;
+  float64_t c = 1.0, s = 0.0;
+  float64_t alpha, beta, t;
+
+  /* Singleton's recurrence: (c, s) is rotated by 2*pi/M using
+     alpha = 2*sin^2(pi/M) and beta = sin(2*pi/M), which keeps the
+     rounding error growth linear in k */
+  t = sin(3.141592653589793238463 / (float64_t) M);
+  alpha = 2.0 * t * t;
+  beta = sin(6.283185307179586476925 / (float64_t) M);
+
+  /* First octant */
+  for (k = 0U; k <= M / 8U && k < count; k++)
+  {
+    pDst[2U * k + cosOfs] = (float32_t) c;
+    pDst[2U * k + sinOfs] = (float32_t) s;
+
+    t = c - (alpha * c + beta * s);
+    s = s - (alpha * s - beta * c);
+    c = t;
+  }
+
+  /* Second octant: cos(x) = sin(pi/2 - x) */
+  for (; k <= M / 4U && k < count; k++)
+  {
+    pDst[2U * k + cosOfs] = pDst[2U * (M / 4U - k) + sinOfs];
+    pDst[2U * k + sinOfs] = pDst[2U * (M / 4U - k) + cosOfs];
+  }
+
+  /* Other quadrants: rotation by pi/2 */
+  for (; k < count; k++)
+  {
+    pDst[2U * k + cosOfs] = -pDst[2U * (k - M / 4U) + sinOfs];
+    pDst[2U * k + sinOfs] = pDst[2U * (k - M / 4U) + cosOfs];
+  }
+}
+
+/**
+  @brief         Position of bin k in the output of the arm_cfft_f32() stages.
+  @param[in]     k       frequency bin
+  @param[in]     fftLen  length of the FFT
+  @param[in]     r       radix of the first stage: 1, 2 or 4
+  @param[in]     digits  number of radix-8 stages
+  @return        index of the complex sample holding bin k before the bit reversal
+ */
+static uint32_t arm_cfft_bitrev_source(
+  uint32_t k,
+  uint32_t fftLen,
+  uint32_t r,
+  uint32_t digits)
+{
+  uint32_t q = k / r;
+  uint32_t rev = 0U;
+  uint32_t d;
+
+  /* The radix-2 or radix-4 stage leaves the bins k = h mod r in the block h,
+     in which the radix-8 stages leave them in base-8 digit-reversed order */
+  for (d = 0U; d < digits; d++)
+  {
+    rev = (rev << 3U) | (q & 7U);
+    q >>= 3U;
+  }
+
+  return (k % r) * (fftLen / r) + rev;
+}
+
+/**
+  @brief         Generates the bit reversal table of arm_cfft_f32().
+  @param[out]    pTable  points to the table of <code>ARM_CFFT_BITREV_LENGTH_F32(fftLen)</code> entries
+  @param[in]     fftLen  length of the FFT
+  @return        number of entries written
+  @par
+                   Each pair of entries holds the offsets, in bytes, of two complex samples
+                   swapped by arm_bitreversal_32(). The permutation is applied cycle by cycle,
+                   each cycle being started from its smallest index.
+ */
+static uint16_t arm_cfft_bitrev_gen_f32(
+  uint16_t * pTable,
+  uint32_t fftLen)
+{
+  uint32_t digits = 0U;
+  uint32_t r = fftLen;
+  uint32_t length = 0U;
+  uint32_t s, j, next;
+
+  while (r >= 8U)
+  {
+    r >>= 3U;
+    digits++;
+  }
+
+  for (s = 1U; s < fftLen; s++)
+  {
+    /* Skip fixed points and the cycles already visited from a smaller index */
+    j = arm_cfft_bitrev_source(s, fftLen, r, digits);
+    while (j > s)
+    {
+      j = arm_cfft_bitrev_source(j, fftLen, r, digits);
+    }
+    if (j != s || arm_cfft_bitrev_source(s, fftLen, r, digits) == s)
+    {
+      continue;
+    }
+
+    /* Sample j receives its source sample, which becomes the next to fill */
+    j = s;
+    next = arm_cfft_bitrev_source(j, fftLen, r, digits);
+    while (next != s)
+    {
+      pTable[length++] = (uint16_t) (8U * j);
+      pTable[length++] = (uint16_t) (8U * next);
+      j = next;
+      next = arm_cfft_bitrev_source(j, fftLen, r, digits);
+    }
+  }
+
+  return (uint16_t) length;
+}
+
+/**
+  @brief         Initializes an arena for the run-time FFT tables.
+  @param[out]    A      points to the arena
+  @param[in]     pBase  points to the arena memory, 8-byte aligned
+  @param[in]     size   size of the arena memory in bytes
+  @return        none
+ */
+void arm_fft_table_arena_init(
+  arm_fft_table_arena * A,
+  void * pBase,
+  uint32_t size)
+{
+  A->pBase = (uint8_t *) pBase;
+  A->size = size;
+  A->used = 0U;
+}
+
+/**
+  @brief         Initialization function for the floating-point CFFT/CIFFT with run-time tables.
+  @param[out]    S       points to an instance of the floating-point CFFT structure
+  @param[in]     fftLen  length of the FFT: a power of 2 from 16 to 4096
+  @param[in,out] A       points to the arena receiving <code>ARM_CFFT_TABLES_SIZE_F32(fftLen)</code> bytes
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not supported
+                   - \ref ARM_MATH_LENGTH_ERROR   : the arena is too small; it is left unchanged
+
+  @par           Details
+                   The instance can be used with arm_cfft_f32() as the constant instances
+                   <code>arm_cfft_sR_f32_lenN</code>.
+ */
+arm_status arm_cfft_tables_init_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  arm_fft_table_arena * A)
+{
+  uint32_t used = A->used;
+  float32_t *pTwiddle;
+  uint16_t *pBitRevTable;
+
+  if (fftLen < 16U || fftLen > 4096U || (fftLen & (fftLen - 1U)) != 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  pTwiddle = (float32_t *) arm_fft_table_arena_alloc(A, 2U * fftLen * sizeof(float32_t));
+  pBitRevTable = (uint16_t *) arm_fft_table_arena_alloc(A,
+                   ARM_CFFT_BITREV_LENGTH_F32(fftLen) * sizeof(uint16_t));
+  if (pTwiddle == NULL || pBitRevTable == NULL)
+  {
+    A->used = used;
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  arm_fft_twiddle_gen_f32(pTwiddle, fftLen, fftLen, 0U);
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = arm_cfft_bitrev_gen_f32(pBitRevTable, fftLen);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Initialization function for the floating-point real FFT with run-time tables.
+  @param[out]    S       points to an instance of the floating-point real FFT structure
+  @param[in]     fftLen  length of the real sequence: a power of 2 from 32 to 4096
+  @param[in,out] A       points to the arena receiving <code>ARM_RFFT_FAST_TABLES_SIZE_F32(fftLen)</code> bytes
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not supported
+                   - \ref ARM_MATH_LENGTH_ERROR   : the arena is too small; it is left unchanged
+
+  @par           Details
+                   The instance can be used with arm_rfft_fast_f32() as one initialized by
+                   arm_rfft_fast_init_f32().
+ */
+arm_status arm_rfft_fast_tables_init_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  arm_fft_table_arena * A)
+{
+  uint32_t used = A->used;
+  float32_t *pTwiddleRFFT;
+  arm_status status;
+
+  if (fftLen < 32U || fftLen > 4096U || (fftLen & (fftLen - 1U)) != 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_cfft_tables_init_f32(&S->Sint, fftLen / 2U, A);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  pTwiddleRFFT = (float32_t *) arm_fft_table_arena_alloc(A, fftLen * sizeof(float32_t));
+  if (pTwiddleRFFT == NULL)
+  {
+    A->used = used;
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  /* exp(i*(pi/2 - 2*pi*k/fftLen)) = (sin, cos) of 2*pi*k/fftLen */
+  arm_fft_twiddle_gen_f32(pTwiddleRFFT, fftLen, fftLen / 2U, 1U);
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FFTTablesInit group
+ */
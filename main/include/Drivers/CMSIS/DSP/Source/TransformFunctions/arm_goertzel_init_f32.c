@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Initialization function for the floating-point Goertzel filter bank
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point Goertzel filter bank.
+  @param[out]    S          points to an instance of the floating-point Goertzel structure
+  @param[in]     numBins    number of frequency bins
+  @param[in]     pBins      points to the <code>numBins</code> bin frequencies, in bins of <code>blockSize</code> points
+  @param[out]    pCoeffs    points to the <code>ARM_GOERTZEL_COEFFS_PER_BIN*numBins</code> coefficients
+  @param[in]     blockSize  number of samples of the analysed block
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code> or <code>blockSize</code> is 0
+
+  @par           Details
+                   For each bin, <code>pCoeffs</code> receives the coefficient of the
+                   modified recursion, <code>-4*sin(w/2)^2</code> when <code>cos(w) >= 0</code> and
+                   <code>4*cos(w/2)^2</code> otherwise, its sign selecting the recursion, then the
+                   real and imaginary parts of the output coefficients of <code>s[N-1]</code> and
+                   <code>d[N-1]</code>, computed in double precision.
+ */
+arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+  const float32_t * pBins,
+        float32_t * pCoeffs,
+        uint16_t blockSize)
+{
+  float32_t *pC = pCoeffs;                       /* Coefficients of the current bin */
+  float64_t w, h, c, sn;
+  uint32_t bin;
+
+  if (numBins == 0U || blockSize == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    w = 6.283185307179586476925 * (float64_t) pBins[bin] / (float64_t) blockSize;
+
+    h = w * ((float64_t) blockSize - 0.5);
+    c = cos(w * (float64_t) blockSize);
+    sn = sin(w * (float64_t) blockSize);
+
+    if (cos(w) >= 0.0)
+    {
+      /* X = exp(-i*w*(N-1)) * s - exp(-i*w*N) * (s - d) */
+      pC[0] = (float32_t) (-4.0 * sin(0.5 * w) * sin(0.5 * w));
+      pC[1] = (float32_t) (2.0 * sin(h) * sin(0.5 * w));
+      pC[2] = (float32_t) (2.0 * cos(h) * sin(0.5 * w));
+      pC[3] = (float32_t) c;
+      pC[4] = (float32_t) -sn;
+    }
+    else
+    {
+      /* X = exp(-i*w*(N-1)) * s - exp(-i*w*N) * (d - s) */
+      pC[0] = (float32_t) (4.0 * cos(0.5 * w) * cos(0.5 * w));
+      pC[1] = (float32_t) (2.0 * cos(h) * cos(0.5 * w));
+      pC[2] = (float32_t) (-2.0 * sin(h) * cos(0.5 * w));
+      pC[3] = (float32_t) -c;
+      pC[4] = (float32_t) sn;
+    }
+
+    pC += ARM_GOERTZEL_COEFFS_PER_BIN;
+  }
+
+  S->numBins = numBins;
+  S->blockSize = blockSize;
+  S->pCoeffs = pCoeffs;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Goertzel group
+ */
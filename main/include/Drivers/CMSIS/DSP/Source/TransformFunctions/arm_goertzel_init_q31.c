@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Initialization function for the Q31 Goertzel filter bank
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Converts a value of [-1, 1] to 1.31 format, with saturation of 1.0.
+  @param[in]     x  value to convert
+  @return        rounded 1.31 value
+ */
+static q31_t arm_goertzel_to_q31(
+  float64_t x)
+{
+  x *= 2147483648.0;
+
+  if (x >= 2147483647.0)
+  {
+    return INT32_MAX;
+  }
+
+  return (q31_t) (x >= 0.0 ? x + 0.5 : x - 0.5);
+}
+
+/**
+  @brief         Initialization function for the Q31 Goertzel filter bank.
+  @param[out]    S          points to an instance of the Q31 Goertzel structure
+  @param[in]     numBins    number of frequency bins
+  @param[in]     pBins      points to the <code>numBins</code> bin frequencies, in bins of <code>blockSize</code> points
+  @param[out]    pCoeffs    points to the <code>ARM_GOERTZEL_COEFFS_PER_BIN*numBins</code> coefficients
+  @param[in]     blockSize  number of samples of the analysed block
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code> or <code>blockSize</code> is 0
+
+  @par           Scaling and Overflow Behavior
+                   The state of a bin is the input filtered by the impulse response
+                   <code>h[m] = sin((m+1)*w)/sin(w)</code>, so over a block
+                   <code>|s[n]| <= G * max|x|</code> with <code>G = sum(|h[m]|, m < N)</code>.
+                   G is about <code>(2/pi) * N / |sin(w)|</code>, and <code>N*(N+1)/2</code> for the
+                   bins 0 and <code>N/2</code> where the recursion is a double integrator.
+                   The initialization function computes G for every bin with the same
+                   recursion in double precision, and sets <code>S->shift</code> to the smallest
+                   power of 2 above the largest G and <code>N</code>: the input is shifted down
+                   by <code>shift</code> bits, so neither the states nor the bins can overflow.
+  @par
+                   The bins are returned in 1.31 format scaled by <code>2^-shift</code>: a full
+                   scale sine on an integer bin gives a bin of magnitude <code>N/2 * 2^-shift</code>.
+                   Bins away from 0 and <code>N/2</code> cost about <code>log2(N) + 1</code> bits,
+                   as the Q31 FFT of the same length; a bin within a few bins of 0 or
+                   <code>N/2</code> costs up to twice as many. <code>2*cos(w)</code> is stored in
+                   2.30 format, saturated to <code>2 - 2^-30</code> for the bin 0.
+ */
+arm_status arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+  const float32_t * pBins,
+        q31_t * pCoeffs,
+        uint16_t blockSize)
+{
+  q31_t *pC = pCoeffs;                           /* Coefficients of the current bin */
+  float64_t w, c, h0, h1, h2, gain, maxGain;
+  uint32_t bin, m, shift;
+
+  if (numBins == 0U || blockSize == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  maxGain = (float64_t) blockSize;
+
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    w = 6.283185307179586476925 * (float64_t) pBins[bin] / (float64_t) blockSize;
+    c = 2.0 * cos(w);
+
+    /* 2*cos(w) in 2.30 format has the bits of cos(w) in 1.31 format */
+    pC[0] = arm_goertzel_to_q31(0.5 * c);
+    pC[1] = arm_goertzel_to_q31(cos(w * (float64_t) (blockSize - 1U)));
+    pC[2] = arm_goertzel_to_q31(-sin(w * (float64_t) (blockSize - 1U)));
+    pC[3] = arm_goertzel_to_q31(cos(w * (float64_t) blockSize));
+    pC[4] = arm_goertzel_to_q31(-sin(w * (float64_t) blockSize));
+    pC += ARM_GOERTZEL_COEFFS_PER_BIN;
+
+    /* L1 norm of the impulse response over the block */
+    h1 = 0.0;
+    h0 = 1.0;
+    gain = 0.0;
+    for (m = 0U; m < blockSize; m++)
+    {
+      gain += fabs(h0);
+      h2 = h1;
+      h1 = h0;
+      h0 = c * h1 - h2;
+    }
+
+    if (gain > maxGain)
+    {
+      maxGain = gain;
+    }
+  }
+
+  shift = 0U;
+  while (shift < 31U && (float64_t) (1UL << shift) < maxGain)
+  {
+    shift++;
+  }
+
+  S->numBins = numBins;
+  S->blockSize = blockSize;
+  S->shift = (uint8_t) shift;
+  S->pCoeffs = pCoeffs;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Goertzel group
+ */
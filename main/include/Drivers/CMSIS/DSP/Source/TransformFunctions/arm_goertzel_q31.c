@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel filter bank
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 Goertzel filter bank.
+  @param[in]     S     points to an instance of the Q31 Goertzel structure
+  @param[in]     pSrc  points to the block of <code>blockSize</code> input samples
+  @param[out]    pDst  points to the <code>numBins</code> complex bins
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The input is shifted down by <code>S->shift</code> bits and the bins are
+                   returned in 1.31 format scaled by <code>2^-shift</code>, see
+                   arm_goertzel_init_q31(). The products are accumulated in 64 bits and the
+                   states saturated, which only matters for the rounding errors.
+ */
+void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst)
+{
+  const q31_t *pC = S->pCoeffs;                  /* Coefficients of the current bin */
+  uint32_t blockSize = S->blockSize;
+  uint32_t shift = S->shift;
+  uint32_t bin = S->numBins;
+  uint32_t n;
+  q31_t c0, c1;                                  /* 2*cos(w) of the two bins, 2.30 format */
+  q31_t s0, s1, s2;                              /* States of the first bin */
+  q31_t t0, t1, t2;                              /* States of the second bin */
+  q31_t x;
+
+  /* Two bins at a time */
+  while (bin >= 2U)
+  {
+    c0 = pC[0];
+    c1 = pC[ARM_GOERTZEL_COEFFS_PER_BIN];
+    s1 = s2 = 0;
+    t1 = t2 = 0;
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      x = pSrc[n] >> shift;
+      s0 = clip_q63_to_q31((((q63_t) c0 * s1) >> 30) + x - s2);
+      t0 = clip_q63_to_q31((((q63_t) c1 * t1) >> 30) + x - t2);
+      s2 = s1;
+      s1 = s0;
+      t2 = t1;
+      t1 = t0;
+    }
+
+    pDst[0] = clip_q63_to_q31(((q63_t) pC[1] * s1 - (q63_t) pC[3] * s2) >> 31);
+    pDst[1] = clip_q63_to_q31(((q63_t) pC[2] * s1 - (q63_t) pC[4] * s2) >> 31);
+    pC += ARM_GOERTZEL_COEFFS_PER_BIN;
+
+    pDst[2] = clip_q63_to_q31(((q63_t) pC[1] * t1 - (q63_t) pC[3] * t2) >> 31);
+    pDst[3] = clip_q63_to_q31(((q63_t) pC[2] * t1 - (q63_t) pC[4] * t2) >> 31);
+    pC += ARM_GOERTZEL_COEFFS_PER_BIN;
+
+    pDst += 4U;
+    bin -= 2U;
+  }
+
+  /* Last bin */
+  if (bin > 0U)
+  {
+    c0 = pC[0];
+    s1 = s2 = 0;
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      x = pSrc[n] >> shift;
+      s0 = clip_q63_to_q31((((q63_t) c0 * s1) >> 30) + x - s2);
+      s2 = s1;
+      s1 = s0;
+    }
+
+    pDst[0] = clip_q63_to_q31(((q63_t) pC[1] * s1 - (q63_t) pC[3] * s2) >> 31);
+    pDst[1] = clip_q63_to_q31(((q63_t) pC[2] * s1 - (q63_t) pC[4] * s2) >> 31);
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
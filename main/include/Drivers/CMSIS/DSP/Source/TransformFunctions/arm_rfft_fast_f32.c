@@ -28,6 +28,15 @@
 
 #include "arm_math.h"
 
+#if defined(ARM_MATH_NEON)
+/* Lanes in reverse order: the decreasing pointer of the split and merge stages */
+static inline float32x4_t arm_rfft_reverse_f32(float32x4_t v)
+{
+   v = vrev64q_f32(v);
+   return vcombine_f32(vget_high_f32(v), vget_low_f32(v));
+}
+#endif
+
 void stage_rfft_f32(
   const arm_rfft_fast_instance_f32 * S,
         float32_t * p,
@@ -41,7 +50,11 @@ void stage_rfft_f32(
         float32_t xAR, xAI, xBR, xBI;               /* temporary variables */
         float32_t t1a, t1b;                         /* temporary variables */
         float32_t p0, p1, p2, p3;                   /* temporary variables */
-
+#if defined(ARM_MATH_NEON)
+        float32x4x2_t xA, xB, tw, out;              /* four bins, real and imaginary parts */
+        float32x4_t t1aV, t1bV;
+        const float32x4_t half = vdupq_n_f32(0.5f);
+#endif
 
    k = (S->Sint).fftLen - 1;
 
@@ -70,7 +83,35 @@ void stage_rfft_f32(
    pB  = p + 2*k;
    pA += 2;
 
-   do
+#if defined(ARM_MATH_NEON)
+   /* Four bins at a time, with the operations of the loop below */
+   while (k >= 4U)
+   {
+      xA = vld2q_f32(pA);
+      xB = vld2q_f32(pB - 6);
+      xB.val[0] = arm_rfft_reverse_f32(xB.val[0]);
+      xB.val[1] = arm_rfft_reverse_f32(xB.val[1]);
+      tw = vld2q_f32(pCoeff);
+
+      t1aV = vsubq_f32(xB.val[0], xA.val[0]);
+      t1bV = vaddq_f32(xB.val[1], xA.val[1]);
+
+      /* 0.5f * (xAR + xBR + p0 + p3), 0.5f * (xAI - xBI + p1 - p2) */
+      out.val[0] = vmulq_f32(half, vaddq_f32(vaddq_f32(vaddq_f32(xA.val[0], xB.val[0]),
+                   vmulq_f32(tw.val[0], t1aV)), vmulq_f32(tw.val[1], t1bV)));
+      out.val[1] = vmulq_f32(half, vsubq_f32(vaddq_f32(vsubq_f32(xA.val[1], xB.val[1]),
+                   vmulq_f32(tw.val[1], t1aV)), vmulq_f32(tw.val[0], t1bV)));
+      vst2q_f32(pOut, out);
+
+      pOut += 8;
+      pCoeff += 8;
+      pA += 8;
+      pB -= 8;
+      k -= 4U;
+   }
+#endif
+
+   while (k > 0U)
    {
       /*
          function X = my_split_rfft(X, ifftFlag)
@@ -111,7 +152,7 @@ void stage_rfft_f32(
       pA += 2;
       pB -= 2;
       k--;
-   } while (k > 0U);
+   }
 }
 
 /* Prepares data for inverse cfft */
@@ -127,6 +168,11 @@ void merge_rfft_f32(
         float32_t *pB = p;                          /* decreasing pointer */
         float32_t xAR, xAI, xBR, xBI;               /* temporary variables */
         float32_t t1a, t1b, r, s, t, u;             /* temporary variables */
+#if defined(ARM_MATH_NEON)
+        float32x4x2_t xA, xB, tw, out;              /* four bins, real and imaginary parts */
+        float32x4_t t1aV, t1bV;
+        const float32x4_t half = vdupq_n_f32(0.5f);
+#endif
 
    k = (S->Sint).fftLen - 1;
 
@@ -141,6 +187,34 @@ void merge_rfft_f32(
    pB  =  p + 2*k ;
    pA +=  2	   ;
 
+#if defined(ARM_MATH_NEON)
+   /* Four bins at a time, with the operations of the loop below */
+   while (k >= 4U)
+   {
+      xA = vld2q_f32(pA);
+      xB = vld2q_f32(pB - 6);
+      xB.val[0] = arm_rfft_reverse_f32(xB.val[0]);
+      xB.val[1] = arm_rfft_reverse_f32(xB.val[1]);
+      tw = vld2q_f32(pCoeff);
+
+      t1aV = vsubq_f32(xA.val[0], xB.val[0]);
+      t1bV = vaddq_f32(xA.val[1], xB.val[1]);
+
+      /* 0.5f * (xAR + xBR - r - s), 0.5f * (xAI - xBI + t - u) */
+      out.val[0] = vmulq_f32(half, vsubq_f32(vsubq_f32(vaddq_f32(xA.val[0], xB.val[0]),
+                   vmulq_f32(tw.val[0], t1aV)), vmulq_f32(tw.val[1], t1bV)));
+      out.val[1] = vmulq_f32(half, vsubq_f32(vaddq_f32(vsubq_f32(xA.val[1], xB.val[1]),
+                   vmulq_f32(tw.val[1], t1aV)), vmulq_f32(tw.val[0], t1bV)));
+      vst2q_f32(pOut, out);
+
+      pOut += 8;
+      pCoeff += 8;
+      pA += 8;
+      pB -= 8;
+      k -= 4U;
+   }
+#endif
+
    while (k > 0U)
    {
       /* G is half of the frequency complex spectrum */
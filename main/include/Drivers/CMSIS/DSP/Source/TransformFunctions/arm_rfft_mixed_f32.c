@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_f32.c
+ * Description:  Mixed-radix real FFT for lengths 2 * 2^a * 3^b * 5^c
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup RealFFTMixed Mixed-Radix Real FFT Functions
+
+  @par
+                   Real FFT of any even length whose half is a mixed-radix CFFT length
+                   (see \ref ComplexFFTMixed), with the input and output formats of
+                   arm_rfft_fast_f32(): the forward transform returns bins 0 to
+                   <code>fftLen/2-1</code>, the real part of bin <code>fftLen/2</code> being
+                   packed in the imaginary part of bin 0.
+  @par
+                   The <code>fftLen</code> real samples are transformed as <code>fftLen/2</code>
+                   complex samples by arm_cfft_mixed_f32(), followed by a split stage that
+                   separates the spectra of the even and odd samples. The inverse transform merges
+                   them before the inverse CFFT. As for arm_rfft_fast_f32(), the input buffer is
+                   modified.
+ */
+
+/**
+  @addtogroup RealFFTMixed
+  @{
+ */
+
+/**
+  @brief         Split stage of the forward transform.
+  @param[in]     S     points to an instance of the floating-point mixed-radix RFFT structure
+  @param[in]     p     points to the CFFT of the even (real part) and odd (imaginary part) samples
+  @param[out]    pOut  points to the packed real FFT
+ */
+static void arm_rfft_mixed_split_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut)
+{
+  uint32_t M = S->Sint.fftLen;                   /* Length of the CFFT */
+  const float32_t *pTw = S->pTwiddleRFFT;        /* W_N^k */
+  float32_t er, ei, dr, di, wr, wi;
+  uint32_t k;
+
+  /* X[0] and X[M] are real */
+  pOut[0] = p[0] + p[1];
+  pOut[1] = p[0] - p[1];
+
+  for (k = 1U; k < M; k++)
+  {
+    /* E = (Z[k] + conj(Z[M-k])) / 2, D = (Z[k] - conj(Z[M-k])) / 2 */
+    er = 0.5f * (p[2U * k] + p[2U * (M - k)]);
+    ei = 0.5f * (p[2U * k + 1U] - p[2U * (M - k) + 1U]);
+    dr = 0.5f * (p[2U * k] - p[2U * (M - k)]);
+    di = 0.5f * (p[2U * k + 1U] + p[2U * (M - k) + 1U]);
+    wr = pTw[2U * k];
+    wi = pTw[2U * k + 1U];
+
+    /* X[k] = E - i * W_N^k * D */
+    pOut[2U * k] = er + (wr * di + wi * dr);
+    pOut[2U * k + 1U] = ei - (wr * dr - wi * di);
+  }
+}
+
+/**
+  @brief         Merge stage of the inverse transform.
+  @param[in]     S     points to an instance of the floating-point mixed-radix RFFT structure
+  @param[in]     p     points to the packed real FFT
+  @param[out]    pOut  points to the CFFT of the even (real part) and odd (imaginary part) samples
+ */
+static void arm_rfft_mixed_merge_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut)
+{
+  uint32_t M = S->Sint.fftLen;                   /* Length of the CFFT */
+  const float32_t *pTw = S->pTwiddleRFFT;        /* W_N^k */
+  float32_t er, ei, dr, di, wr, wi;
+  uint32_t k;
+
+  /* Z[0] = (X[0] + X[M]) / 2 + i * (X[0] - X[M]) / 2 */
+  pOut[0] = 0.5f * (p[0] + p[1]);
+  pOut[1] = 0.5f * (p[0] - p[1]);
+
+  for (k = 1U; k < M; k++)
+  {
+    /* E = (X[k] + conj(X[M-k])) / 2, D = (X[k] - conj(X[M-k])) / 2 */
+    er = 0.5f * (p[2U * k] + p[2U * (M - k)]);
+    ei = 0.5f * (p[2U * k + 1U] - p[2U * (M - k) + 1U]);
+    dr = 0.5f * (p[2U * k] - p[2U * (M - k)]);
+    di = 0.5f * (p[2U * k + 1U] + p[2U * (M - k) + 1U]);
+    wr = pTw[2U * k];
+    wi = pTw[2U * k + 1U];
+
+    /* Z[k] = E + i * conj(W_N^k) * D */
+    pOut[2U * k] = er - (wr * di - wi * dr);
+    pOut[2U * k + 1U] = ei + (wr * dr + wi * di);
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point mixed-radix real FFT.
+  @param[in]     S         points to an instance of the floating-point mixed-radix RFFT structure
+  @param[in]     p         points to input buffer (Source buffer is modified by this function)
+  @param[out]    pOut      points to output buffer
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        none
+ */
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag)
+{
+  if (ifftFlag == 1U)
+  {
+    arm_rfft_mixed_merge_f32(S, p, pOut);
+    arm_cfft_mixed_f32(&S->Sint, pOut, 1U);
+  }
+  else
+  {
+    arm_cfft_mixed_f32(&S->Sint, p, 0U);
+    arm_rfft_mixed_split_f32(S, p, pOut);
+  }
+}
+
+/**
+  @} end of RealFFTMixed group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix real FFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup RealFFTMixed
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix RFFT/RIFFT.
+  @param[out]    S       points to an instance of the floating-point mixed-radix RFFT structure
+  @param[in]     fftLen  length of the real sequence: even, <code>fftLen/2</code> being a mixed-radix CFFT length
+  @param[in]     pState  points to the state buffer of <code>ARM_RFFT_MIXED_STATE_LENGTH(fftLen)</code> samples
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not supported
+ */
+
+arm_status arm_rfft_mixed_init_f32(
+        arm_rfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pState)
+{
+  uint32_t k;
+  float64_t angle;
+  arm_status status;
+
+  if (fftLen % 2U != 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_cfft_mixed_init_f32(&S->Sint, fftLen / 2U, pState);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pState + ARM_CFFT_MIXED_STATE_LENGTH(fftLen / 2U);
+
+  /* W_N^k = exp(-2*pi*i*k/N) for the fftLen/2 bins of the split stage */
+  for (k = 0U; k < fftLen / 2U; k++)
+  {
+    angle = 6.283185307179586476925 * (float64_t) k / (float64_t) fftLen;
+    S->pTwiddleRFFT[2U * k] = (float32_t) cos(angle);
+    S->pTwiddleRFFT[2U * k + 1U] = (float32_t) -sin(angle);
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of RealFFTMixed group
+ */
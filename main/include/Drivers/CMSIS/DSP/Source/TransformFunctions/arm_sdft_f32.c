@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup SlidingDFT Sliding DFT
+
+  @par
+                   Tracks a few bins of the DFT of the last <code>N</code> samples, updated
+                   at every sample: the spectrum of a sliding window without an FFT per hop.
+                   Each bin <code>k</code> (an integer below <code>N</code>) follows
+  <pre>
+      X[n] = r*W * X[n-1] + W * (x[n] - r^N * x[n-N]),      W = exp(2*pi*i*k/N)
+  </pre>
+                   which gives <code>sum(r^j * x[n-j] * exp(-2*pi*i*k*(N-1-j)/N), j < N)</code>:
+                   for <code>r = 1</code>, the DFT bin of the window <code>x[n-N+1]</code> to
+                   <code>x[n]</code>. The cost is 6 multiplications per sample and per bin.
+  @par
+                   With <code>r = 1</code> the recursion is marginally stable: the rounding
+                   errors are never forgotten, and grow with the square root of the number of
+                   samples in floating point. A damping <code>r < 1</code> (0.9999 for example)
+                   bounds them to about <code>eps/(1-r)</code> of full scale, at the price of an
+                   exponential window weighting the oldest sample by <code>r^(N-1)</code>.
+  @par
+                   The delay line holds the last <code>N</code> input samples, after the bins in
+                   the state buffer of <code>ARM_SDFT_STATE_LENGTH(numBins, N)</code> samples.
+                   Each call processes the bins one after the other over the whole block, and
+                   returns the bins of the window ending at the last sample.
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the <code>numBins</code> complex bins
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pC = S->pCoeffs;              /* Coefficients of the current bin */
+  float32_t *pBins = S->pState;                  /* Complex bins */
+  float32_t *pDelay = S->pState + 2U * S->numBins;   /* Last windowLen input samples */
+  uint32_t windowLen = S->windowLen;
+  uint32_t index = S->index;                     /* Position of x[n-N] in the delay line */
+  float32_t dampingN = S->dampingN;
+  uint32_t bin, n, j;
+  float32_t re, im, t, d, old;
+
+  for (bin = 0U; bin < S->numBins; bin++)
+  {
+    re = pBins[0];
+    im = pBins[1];
+    j = index;
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* x[n-N] comes from the delay line, or from this block once it is longer than the window */
+      old = (n < windowLen) ? pDelay[j] : pSrc[n - windowLen];
+      d = pSrc[n] - dampingN * old;
+
+      /* X = r*W * X + W * d */
+      t = pC[0] * re - pC[1] * im + pC[2] * d;
+      im = pC[0] * im + pC[1] * re + pC[3] * d;
+      re = t;
+
+      j = (j + 1U == windowLen) ? 0U : j + 1U;
+    }
+
+    pBins[0] = re;
+    pBins[1] = im;
+    pDst[0] = re;
+    pDst[1] = im;
+
+    pC += ARM_SDFT_COEFFS_PER_BIN;
+    pBins += 2U;
+    pDst += 2U;
+  }
+
+  /* Keep the last windowLen samples */
+  for (n = 0U; n < blockSize; n++)
+  {
+    pDelay[index] = pSrc[n];
+    index = (index + 1U == windowLen) ? 0U : index + 1U;
+  }
+
+  S->index = (uint16_t) index;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
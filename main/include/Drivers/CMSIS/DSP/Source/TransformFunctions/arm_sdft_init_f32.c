@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_f32.c
+ * Description:  Initialization function for the floating-point sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding DFT.
+  @param[out]    S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     numBins    number of frequency bins
+  @param[in]     pBins      points to the <code>numBins</code> bin indexes, below <code>windowLen</code>
+  @param[in]     damping    damping factor r of the recursion, in ]0, 1], 1.0 for none
+  @param[out]    pCoeffs    points to the <code>ARM_SDFT_COEFFS_PER_BIN*numBins</code> coefficients
+  @param[in]     pState     points to the state buffer of <code>ARM_SDFT_STATE_LENGTH(numBins, windowLen)</code> samples
+  @param[in]     windowLen  length of the sliding window
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code> or <code>windowLen</code> is 0,
+                                                    a bin is not below <code>windowLen</code>, or
+                                                    <code>damping</code> is out of range
+
+  @par           Details
+                   For each bin, <code>pCoeffs</code> receives <code>r*W</code> then <code>W</code>,
+                   computed in double precision. The bins and the delay line start at zero.
+ */
+arm_status arm_sdft_init_f32(
+        arm_sdft_instance_f32 * S,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        float32_t damping,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        uint16_t windowLen)
+{
+  float32_t *pC = pCoeffs;                       /* Coefficients of the current bin */
+  float64_t w;
+  uint32_t bin;
+
+  if (numBins == 0U || windowLen == 0U || !(damping > 0.0f && damping <= 1.0f))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    if (pBins[bin] >= windowLen)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    w = 6.283185307179586476925 * (float64_t) pBins[bin] / (float64_t) windowLen;
+
+    pC[0] = (float32_t) ((float64_t) damping * cos(w));
+    pC[1] = (float32_t) ((float64_t) damping * sin(w));
+    pC[2] = (float32_t) cos(w);
+    pC[3] = (float32_t) sin(w);
+    pC += ARM_SDFT_COEFFS_PER_BIN;
+  }
+
+  S->numBins = numBins;
+  S->windowLen = windowLen;
+  S->index = 0U;
+  S->dampingN = (float32_t) pow((float64_t) damping, (float64_t) windowLen);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  memset(pState, 0, ARM_SDFT_STATE_LENGTH(numBins, windowLen) * sizeof(float32_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
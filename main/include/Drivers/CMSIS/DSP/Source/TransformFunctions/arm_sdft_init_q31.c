@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q31.c
+ * Description:  Initialization function for the Q31 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 sliding DFT.
+  @param[out]    S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     numBins    number of frequency bins
+  @param[in]     pBins      points to the <code>numBins</code> bin indexes, below <code>windowLen</code>
+  @param[in]     damping    damping factor r of the recursion, in 1.31 format, positive
+  @param[out]    pCoeffs    points to the <code>ARM_SDFT_COEFFS_PER_BIN*numBins</code> coefficients
+  @param[in]     pState     points to the state buffer of <code>ARM_SDFT_STATE_LENGTH(numBins, windowLen)</code> samples
+  @param[in]     windowLen  length of the sliding window, at least 2
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code> is 0, <code>windowLen</code>
+                                                    is below 2, a bin is not below <code>windowLen</code>,
+                                                    or <code>damping</code> is not positive
+
+  @par           Scaling and Overflow Behavior
+                   A bin sums <code>N</code> input samples weighted by at most 1, so
+                   <code>|X| <= N * max|x|</code>. <code>S->shift</code> is set to
+                   <code>ceil(log2(N))</code>: the input is shifted down by <code>shift</code>
+                   bits and the bins, in 1.31 format scaled by <code>2^-shift</code>, cannot
+                   overflow. A full scale sine on bin <code>k</code> gives a bin of magnitude
+                   <code>N/2 * 2^-shift</code>, as the Q31 FFT of the same length.
+  @par
+                   The coefficients <code>r*W</code> are rounded towards zero, so that
+                   <code>|r*W| <= r < 1</code> and the recursion cannot diverge. The truncations of the 64-bit products, two LSBs
+                   per sample at most, are then forgotten at the rate <code>r</code>: with
+                   <code>r = 0x7FFF0000</code> (1 - 2^-15) they stay below 2^16 LSBs of the scaled
+                   bins, while <code>r = 0x7FFFFFFF</code> keeps them for about 2^31 samples.
+ */
+arm_status arm_sdft_init_q31(
+        arm_sdft_instance_q31 * S,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        q31_t damping,
+        q31_t * pCoeffs,
+        q31_t * pState,
+        uint16_t windowLen)
+{
+  q31_t *pC = pCoeffs;                           /* Coefficients of the current bin */
+  float64_t w, r, value;
+  uint32_t bin, shift;
+
+  if (numBins == 0U || windowLen < 2U || damping <= 0)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  r = (float64_t) damping / 2147483648.0;
+
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    if (pBins[bin] >= windowLen)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    w = 6.283185307179586476925 * (float64_t) pBins[bin] / (float64_t) windowLen;
+
+    /* r*W rounded towards zero, W rounded to nearest and saturated */
+    pC[0] = (q31_t) (r * cos(w) * 2147483648.0);
+    pC[1] = (q31_t) (r * sin(w) * 2147483648.0);
+    value = cos(w) * 2147483648.0;
+    pC[2] = (value >= 2147483647.0) ? INT32_MAX : (q31_t) (value >= 0.0 ? value + 0.5 : value - 0.5);
+    value = sin(w) * 2147483648.0;
+    pC[3] = (value >= 2147483647.0) ? INT32_MAX : (q31_t) (value >= 0.0 ? value + 0.5 : value - 0.5);
+    pC += ARM_SDFT_COEFFS_PER_BIN;
+  }
+
+  shift = 0U;
+  while ((1UL << shift) < windowLen)
+  {
+    shift++;
+  }
+
+  S->numBins = numBins;
+  S->windowLen = windowLen;
+  S->index = 0U;
+  S->shift = (uint8_t) shift;
+  S->dampingN = (q31_t) (pow(r, (float64_t) windowLen) * 2147483648.0);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  memset(pState, 0, ARM_SDFT_STATE_LENGTH(numBins, windowLen) * sizeof(q31_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
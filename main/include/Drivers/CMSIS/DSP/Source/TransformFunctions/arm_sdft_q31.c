@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q31.c
+ * Description:  Q31 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the <code>numBins</code> complex bins
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The input is shifted down by <code>S->shift</code> bits and the bins are
+                   returned in 1.31 format scaled by <code>2^-shift</code>, see
+                   arm_sdft_init_q31(). The products are accumulated in 64 bits and the bins
+                   saturated, which only matters for the rounding errors.
+ */
+void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pC = S->pCoeffs;                  /* Coefficients of the current bin */
+  q31_t *pBins = S->pState;                      /* Complex bins */
+  q31_t *pDelay = S->pState + 2U * S->numBins;   /* Last windowLen input samples */
+  uint32_t windowLen = S->windowLen;
+  uint32_t index = S->index;                     /* Position of x[n-N] in the delay line */
+  uint32_t shift = S->shift;
+  q31_t dampingN = S->dampingN;
+  uint32_t bin, n, j;
+  q31_t re, im, t, d, old;
+
+  for (bin = 0U; bin < S->numBins; bin++)
+  {
+    re = pBins[0];
+    im = pBins[1];
+    j = index;
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* x[n-N] comes from the delay line, or from this block once it is longer than the window */
+      old = (n < windowLen) ? pDelay[j] : pSrc[n - windowLen];
+      d = (pSrc[n] >> shift) - (q31_t) (((q63_t) dampingN * (old >> shift)) >> 31);
+
+      /* X = r*W * X + W * d */
+      t = clip_q63_to_q31(((((q63_t) pC[0] * re) - ((q63_t) pC[1] * im)) >> 31)
+                          + (((q63_t) pC[2] * d) >> 31));
+      im = clip_q63_to_q31(((((q63_t) pC[0] * im) + ((q63_t) pC[1] * re)) >> 31)
+                           + (((q63_t) pC[3] * d) >> 31));
+      re = t;
+
+      j = (j + 1U == windowLen) ? 0U : j + 1U;
+    }
+
+    pBins[0] = re;
+    pBins[1] = im;
+    pDst[0] = re;
+    pDst[1] = im;
+
+    pC += ARM_SDFT_COEFFS_PER_BIN;
+    pBins += 2U;
+    pDst += 2U;
+  }
+
+  /* Keep the last windowLen samples */
+  for (n = 0U; n < blockSize; n++)
+  {
+    pDelay[index] = pSrc[n];
+    index = (index + 1U == windowLen) ? 0U : index + 1U;
+  }
+
+  S->index = (uint16_t) index;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
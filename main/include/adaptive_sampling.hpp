@@ -0,0 +1,129 @@
+/**
+ * Adaptive sampling period of the sensor models.
+ *
+ * Each polled model (CO2 input, DHT11, motion input, CO2 classifier) keeps a
+ * SamplingTracker in its state and asks it for the time to its next sample.
+ * The tracker follows the signal with an exponentially weighted mean and
+ * variance; a sample is a transient when it moves faster than policy.slope
+ * or leaves the band of 3 standard deviations (at least policy.noise)
+ * around the mean. A transient drops the period to minPeriod; every steady
+ * sample then stretches it by policy.backoff, up to maxPeriod, or up to
+ * occupiedMaxPeriod while the room is occupied (motion input coupled to the
+ * model's occupied port).
+ *
+ * SamplingPolicy::fixed(p) has minPeriod == maxPeriod == p: the model polls
+ * at p like before and nothing else is coupled.
+ */
+
+#ifndef RT_ADAPTIVE_SAMPLING_HPP
+#define RT_ADAPTIVE_SAMPLING_HPP
+
+#include <cmath>
+
+namespace cadmium
+{
+
+    // Bounds and triggers of one model's sampling period
+    struct SamplingPolicy
+    {
+        double minPeriod;         // Period during transients (s)
+        double maxPeriod;         // Period in steady state (s)
+        double occupiedMaxPeriod; // Longest period while the room is occupied (s)
+        double backoff;           // Period growth per steady sample
+        float noise;              // Deviations below this are noise (signal units)
+        float slope;              // Rate of change that makes a transient (signal units/s)
+
+        // Constant period, no tracking
+        static constexpr SamplingPolicy fixed(double period)
+        {
+            return {period, period, period, 1.0, 0.0f, 0.0f};
+        }
+
+        [[nodiscard]] constexpr bool adaptive() const { return maxPeriod > minPeriod; }
+    };
+
+    // Running statistics of a sampled signal and current period (trivially copyable, lives in model states)
+    struct SamplingTracker
+    {
+        float mean;         // Exponentially weighted mean
+        float variance;     // Exponentially weighted variance
+        float last;         // Previous sample
+        double period;      // Current sampling period (0: no sample yet)
+        double sinceSample; // Time since the previous sample up to the last external transition (s)
+
+        /**
+         * Account for a new sample taken elapsed seconds after the previous
+         * one and return the time to the next sample. Models add the e of
+         * their external transitions to sinceSample and pass
+         * sinceSample + sigma here, since an external transition may have
+         * moved the sample away from one period.
+         */
+        double next(float value, double elapsed, bool occupied, const SamplingPolicy &policy)
+        {
+            sinceSample = 0.0;
+            if (!policy.adaptive())
+            {
+                period = policy.minPeriod;
+                return period;
+            }
+            if (period == 0.0)
+            {
+                mean = last = value;
+                variance = 0.0f;
+                period = policy.minPeriod;
+                return period;
+            }
+
+            float deviation = value - mean;
+            float band = 3.0f * std::sqrt(variance);
+            band = band > policy.noise ? band : policy.noise;
+            float rate = elapsed > 0.0 ? std::fabs(value - last) / static_cast<float>(elapsed) : 0.0f;
+            bool transient = std::fabs(deviation) > band || rate > policy.slope;
+
+            constexpr float alpha = 0.1f;
+            mean += alpha * deviation;
+            variance = (1.0f - alpha) * (variance + alpha * deviation * deviation);
+            last = value;
+
+            double cap = occupied ? policy.occupiedMaxPeriod : policy.maxPeriod;
+            period = transient ? policy.minPeriod : period * policy.backoff;
+            period = period < cap ? period : cap;
+            period = period > policy.minPeriod ? period : policy.minPeriod;
+            return period;
+        }
+
+        /**
+         * The room became occupied: time left to the next sample, shortened
+         * to the occupied cap.
+         */
+        double occupiedRemaining(double remaining, const SamplingPolicy &policy) const
+        {
+            return remaining < policy.occupiedMaxPeriod ? remaining : policy.occupiedMaxPeriod;
+        }
+    };
+
+    // Sampling policies of the polled models of a room
+    struct RoomSampling
+    {
+        SamplingPolicy co2 = SamplingPolicy::fixed(0.8);         // AnalogInput, on the raw ADC count
+        SamplingPolicy temperature = SamplingPolicy::fixed(2.0); // DHT11 (°C)
+        SamplingPolicy motion = SamplingPolicy::fixed(0.5);      // PIR level (0/1)
+        SamplingPolicy classifier = SamplingPolicy::fixed(0.1);  // CO2 band evaluation (ppm)
+
+        /**
+         * Adaptive policies: 0.4 to 8 s for CO2 (2 s while occupied),
+         * 1 s (DHT11 minimum) to 30 s for temperature, 0.25 to 2 s for motion,
+         * classifier run on every new CO2 value with a 30 s heartbeat.
+         */
+        static constexpr RoomSampling adaptive()
+        {
+            return {{0.4, 8.0, 2.0, 1.5, 4.0f, 10.0f},
+                    {1.0, 30.0, 5.0, 1.5, 0.3f, 0.05f},
+                    {0.25, 2.0, 1.0, 1.5, 0.5f, 0.25f},
+                    {0.1, 30.0, 30.0, 2.0, 10.0f, 1e9f}};
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_ADAPTIVE_SAMPLING_HPP
@@ -0,0 +1,208 @@
+/**
+ * Shared ADC scan sequence.
+ *
+ * With one AnalogInput per room every room would start, poll and stop ADC1 on
+ * its own. AdcScanner instead programs the regular sequencer once with one rank
+ * per room and converts the whole sequence at every period; the frame goes to
+ * every room, where ScanChannelInput picks its rank and runs the usual CO2
+ * conversion (co2Update) on it.
+ */
+
+#ifndef RT_ADC_SCAN_HPP
+#define RT_ADC_SCAN_HPP
+
+#include <cadmium/modeling/devs/atomic.hpp>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include "CO2polling.hpp"
+#include "boot_sequencer.hpp"
+
+extern "C"
+{
+#include "stm32h7xx_hal.h"
+}
+
+namespace cadmium
+{
+
+    constexpr std::size_t ADC_SCAN_MAX_RANKS = 16; // Length of the regular sequence of an H7 ADC
+
+    // One conversion of the whole sequence, raw samples in rank order
+    struct ScanFrame
+    {
+        uint16_t raw[ADC_SCAN_MAX_RANKS];
+        uint8_t count;
+    };
+
+    inline std::ostream &operator<<(std::ostream &out, const ScanFrame &frame)
+    {
+        out << "Scan:";
+        for (std::size_t r = 0; r < frame.count; r++)
+        {
+            out << " " << frame.raw[r];
+        }
+        return out;
+    }
+
+    // Regular sequencer rank constant of position index (0 = rank 1)
+    inline uint32_t adcRegularRank(std::size_t index)
+    {
+        static constexpr uint32_t ranks[ADC_SCAN_MAX_RANKS] = {
+            ADC_REGULAR_RANK_1, ADC_REGULAR_RANK_2, ADC_REGULAR_RANK_3, ADC_REGULAR_RANK_4,
+            ADC_REGULAR_RANK_5, ADC_REGULAR_RANK_6, ADC_REGULAR_RANK_7, ADC_REGULAR_RANK_8,
+            ADC_REGULAR_RANK_9, ADC_REGULAR_RANK_10, ADC_REGULAR_RANK_11, ADC_REGULAR_RANK_12,
+            ADC_REGULAR_RANK_13, ADC_REGULAR_RANK_14, ADC_REGULAR_RANK_15, ADC_REGULAR_RANK_16};
+        return ranks[index];
+    }
+
+    // State of the AdcScanner model
+    struct AdcScanState
+    {
+        ScanFrame frame; // Last converted sequence
+        double sigma;    // Time until next scan
+
+        constexpr AdcScanState() : frame{}, sigma(0.0) {}
+    };
+
+    inline std::ostream &operator<<(std::ostream &out, const AdcScanState &state)
+    {
+        out << state.frame;
+        return out;
+    }
+
+    /**
+     * AdcScanner: converts the regular sequence of an ADC every period and
+     * sends the frame on out.
+     */
+    class AdcScanner : public Atomic<AdcScanState>
+    {
+    public:
+        Port<ScanFrame> out; // Raw samples of the last scan
+
+        ADC_HandleTypeDef *adc; // ADC already initialised by MX_ADCx_Init()
+        double period;          // Time between two scans
+
+        /**
+         * Constructor: reprograms the regular sequence of adc with channels
+         * (at most ADC_SCAN_MAX_RANKS, in rank order).
+         * @param id - Unique model identifier
+         * @param handle - ADC handle
+         * @param channels - ADC_CHANNEL_x of each rank
+         * @param count - Number of ranks
+         * @param scanPeriod - Time between two scans (s)
+         */
+        AdcScanner(const std::string &id, ADC_HandleTypeDef *handle, const uint32_t *channels, std::size_t count, double scanPeriod)
+            : Atomic<AdcScanState>(id, AdcScanState()), adc(handle), period(scanPeriod)
+        {
+            out = addOutPort<ScanFrame>("out");
+
+            if (count > ADC_SCAN_MAX_RANKS)
+            {
+                count = ADC_SCAN_MAX_RANKS;
+            }
+            state.frame.count = static_cast<uint8_t>(count);
+
+            // The sequence can only be changed once the ADC is calibrated
+            BootSequencer::awaitAdcCalibration();
+            adc->Init.ScanConvMode = ADC_SCAN_ENABLE;
+            adc->Init.NbrOfConversion = count;
+            adc->Init.EOCSelection = ADC_EOC_SINGLE_CONV; // Poll rank by rank
+            HAL_ADC_Init(adc);
+            for (std::size_t r = 0; r < count; r++)
+            {
+                ADC_ChannelConfTypeDef config = {};
+                config.Channel = channels[r];
+                config.Rank = adcRegularRank(r);
+                config.SamplingTime = ADC_SAMPLETIME_64CYCLES_5;
+                config.SingleDiff = ADC_SINGLE_ENDED;
+                config.OffsetNumber = ADC_OFFSET_NONE;
+                HAL_ADC_ConfigChannel(adc, &config);
+            }
+        }
+
+        // Internal transition: convert the whole sequence
+        void internalTransition(AdcScanState &state) const override
+        {
+            HAL_ADC_Start(adc);
+            for (std::size_t r = 0; r < state.frame.count; r++)
+            {
+                if (HAL_ADC_PollForConversion(adc, 20) != HAL_OK)
+                {
+                    break; // Keep the previous samples of the remaining ranks
+                }
+                state.frame.raw[r] = HwTrace::adc(static_cast<uint8_t>(r), static_cast<uint16_t>(HAL_ADC_GetValue(adc)));
+            }
+            HAL_ADC_Stop(adc);
+            state.sigma = period;
+        }
+
+        // External transition: no input port
+        void externalTransition(AdcScanState &state, double e) const override
+        {
+        }
+
+        // Output function: send the frame converted at the previous scan
+        void output(const AdcScanState &state) const override
+        {
+            out->addMessage(state.frame);
+        }
+
+        [[nodiscard]] double timeAdvance(const AdcScanState &state) const override
+        {
+            return state.sigma;
+        }
+    };
+
+    /**
+     * ScanChannelInput: CO2 input of one room fed by an AdcScanner. Outputs
+     * the ppm value of its rank as soon as a frame arrives.
+     */
+    class ScanChannelInput : public Atomic<AnalogInputState>
+    {
+    public:
+        Port<ScanFrame> in; // Frames from the scanner
+        Port<float> out;    // Output port (ppm), same as AnalogInput
+
+        std::size_t rank; // Position of the room's channel in the sequence
+
+        ScanChannelInput(const std::string &id, std::size_t channelRank)
+            : Atomic<AnalogInputState>(id, AnalogInputState()), rank(channelRank)
+        {
+            in = addInPort<ScanFrame>("in");
+            out = addOutPort<float>("out");
+            state.sigma = std::numeric_limits<double>::infinity(); // Passive until the first frame
+        }
+
+        // Internal transition: value sent, wait for the next frame
+        void internalTransition(AnalogInputState &state) const override
+        {
+            state.sigma = std::numeric_limits<double>::infinity();
+        }
+
+        // External transition: convert this room's sample of the last frame
+        void externalTransition(AnalogInputState &state, double e) const override
+        {
+            const ScanFrame &frame = in->getBag().back();
+            if (rank < frame.count)
+            {
+                state.raw = frame.raw[rank];
+                co2Update(state, state.raw);
+                state.sigma = 0.0;
+            }
+        }
+
+        void output(const AnalogInputState &state) const override
+        {
+            out->addMessage(state.output);
+        }
+
+        [[nodiscard]] double timeAdvance(const AnalogInputState &state) const override
+        {
+            return state.sigma;
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_ADC_SCAN_HPP
@@ -11,7 +11,7 @@ struct atomic_modelState
     bool led_on;
     bool fastToggle;
     bool buttonPressed;
-    atomic_modelState() : sigma(0.0), led_on(false), fastToggle(true), buttonPressed(false) {}
+    constexpr atomic_modelState() : sigma(0.0), led_on(false), fastToggle(true), buttonPressed(false) {}
 };
 
 std::ostream &operator<<(std::ostream &out, const atomic_modelState &state)
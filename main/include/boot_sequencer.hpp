@@ -0,0 +1,252 @@
+/**
+ * Boot sequencer.
+ *
+ * Models no longer configure their pins one HAL_GPIO_Init() at a time while
+ * the model tree is built. They register their pin configuration here, and
+ * commit() then enables every requested GPIO clock with a single RCC write and
+ * programs each port with one write per configuration register (OSPEEDR,
+ * OTYPER, PUPDR, AFR, MODER), in the same order as HAL_GPIO_Init().
+ *
+ * ADC calibration is started right after MX_ADC1_Init() and runs in the
+ * background while the timers and the models are set up; it is awaited just
+ * before the first event.
+ *
+ * Boot phases are time stamped with CycleCounter (DWT on the board) from the
+ * static initialisation of main.cpp, and report() prints the breakdown.
+ */
+
+#ifndef RT_BOOT_SEQUENCER_HPP
+#define RT_BOOT_SEQUENCER_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include "profiler.hpp"
+
+extern "C"
+{
+#include "stm32h7xx_hal.h"
+}
+
+namespace cadmium
+{
+
+    constexpr std::size_t BOOT_MAX_PHASES = 12; // Phases recorded by mark()
+    constexpr std::size_t BOOT_PORTS = 7;       // GPIOA..GPIOG are batched; other ports use HAL_GPIO_Init
+
+    // Pending configuration of one GPIO port, accumulated by requestPin()
+    struct PortImage
+    {
+        uint32_t mask2;  // Pins touched, two bits per pin (MODER, PUPDR)
+        uint32_t out1;   // Output/AF pins, one bit per pin (OTYPER)
+        uint32_t out2;   // Output/AF pins, two bits per pin (OSPEEDR)
+        uint32_t moder;
+        uint32_t otyper;
+        uint32_t ospeedr;
+        uint32_t pupdr;
+        uint32_t afrMask[2];
+        uint32_t afr[2];
+    };
+
+    class BootSequencer
+    {
+    public:
+        /**
+         * Queue the configuration of the pins of init.Pin on port (same
+         * meaning as HAL_GPIO_Init). Applied by commit(), or at once when the
+         * boot is already committed. EXTI modes go through HAL_GPIO_Init.
+         */
+        static void requestPin(GPIO_TypeDef *port, const GPIO_InitTypeDef &init)
+        {
+            std::size_t index = portIndex(port);
+            if (index == NO_PORT || (init.Mode & ~(PIN_MODE_MASK | PIN_TYPE_MASK)) != 0)
+            {
+                GPIO_InitTypeDef copy = init;
+                HAL_GPIO_Init(port, &copy);
+                return;
+            }
+            clocks |= 1U << index;
+            PortImage &image = images[index];
+            uint32_t mode = init.Mode & PIN_MODE_MASK;
+            for (uint32_t pin = 0; pin < 16; pin++)
+            {
+                if (!(init.Pin & (1U << pin)))
+                {
+                    continue;
+                }
+                uint32_t two = 3U << (2 * pin);
+                image.mask2 |= two;
+                image.moder = (image.moder & ~two) | (mode << (2 * pin));
+                if (mode == PIN_OUTPUT || mode == PIN_AF)
+                {
+                    image.out1 |= 1U << pin;
+                    image.out2 |= two;
+                    image.ospeedr = (image.ospeedr & ~two) | ((init.Speed & 3U) << (2 * pin));
+                    image.otyper = (image.otyper & ~(1U << pin)) | (((init.Mode & PIN_TYPE_MASK) >> 4) << pin);
+                }
+                uint32_t pull = mode == PIN_ANALOG ? 0U : (init.Pull & 3U);
+                image.pupdr = (image.pupdr & ~two) | (pull << (2 * pin));
+                if (mode == PIN_AF)
+                {
+                    uint32_t shift = 4 * (pin & 7U);
+                    image.afrMask[pin >> 3] |= 0xFU << shift;
+                    image.afr[pin >> 3] = (image.afr[pin >> 3] & ~(0xFU << shift)) | ((init.Alternate & 0xFU) << shift);
+                }
+            }
+            if (committed)
+            {
+                apply();
+            }
+        }
+
+        // Queue GPIO clock enables (RCC_AHB4ENR bits) for ports driven outside the models
+        static void requestClocks(uint32_t ahb4Mask)
+        {
+            clocks |= ahb4Mask;
+            if (committed)
+            {
+                apply();
+            }
+        }
+
+        // Enable the requested clocks and write the queued pin configurations
+        static void commit()
+        {
+            apply();
+            committed = true;
+        }
+
+        // Start the offset calibration of a disabled ADC without waiting for it
+        static void beginAdcCalibration(ADC_HandleTypeDef *adc)
+        {
+            calibrating = adc;
+            LL_ADC_StartCalibration(adc->Instance, LL_ADC_CALIB_OFFSET, LL_ADC_SINGLE_ENDED);
+        }
+
+        // Wait for the calibration started by beginAdcCalibration(); call before the first conversion
+        static void awaitAdcCalibration()
+        {
+            if (calibrating != nullptr)
+            {
+                while (LL_ADC_IsCalibrationOnGoing(calibrating->Instance))
+                {
+                }
+                calibrating = nullptr;
+            }
+        }
+
+        // Close the current boot phase
+        static void mark(const char *phase)
+        {
+            if (phaseCount < BOOT_MAX_PHASES)
+            {
+                phases[phaseCount] = phase;
+                stamps[phaseCount] = CycleCounter::now();
+                phaseCount++;
+            }
+        }
+
+        /**
+         * Report the phases line by line ("boot;<phase>;<count>;<us>") and the
+         * total from static initialisation to the last mark.
+         */
+        static void report(void (*sink)(const char *line))
+        {
+            char line[96];
+            uint32_t previous = epoch;
+            for (std::size_t i = 0; i < phaseCount; i++)
+            {
+                std::snprintf(line, sizeof(line), "boot;%s;%lu;%lu\n", phases[i],
+                              (unsigned long)(stamps[i] - previous), (unsigned long)toMicros(stamps[i] - previous));
+                sink(line);
+                previous = stamps[i];
+            }
+            std::snprintf(line, sizeof(line), "boot;total_%s;%lu;%lu\n", CycleCounter::unit(),
+                          (unsigned long)(previous - epoch), (unsigned long)toMicros(previous - epoch));
+            sink(line);
+        }
+
+    private:
+        static constexpr std::size_t NO_PORT = ~std::size_t(0);
+        static constexpr uint32_t PIN_MODE_MASK = 0x3U;  // Mode field of GPIO_InitTypeDef::Mode
+        static constexpr uint32_t PIN_TYPE_MASK = 0x10U; // Open-drain bit of GPIO_InitTypeDef::Mode
+        static constexpr uint32_t PIN_OUTPUT = 0x1U;
+        static constexpr uint32_t PIN_AF = 0x2U;
+        static constexpr uint32_t PIN_ANALOG = 0x3U;
+
+        static inline PortImage images[BOOT_PORTS] = {};
+        static inline uint32_t clocks = 0; // RCC_AHB4ENR bits still to enable
+        static inline bool committed = false;
+        static inline ADC_HandleTypeDef *calibrating = nullptr;
+
+        static inline const char *phases[BOOT_MAX_PHASES] = {};
+        static inline uint32_t stamps[BOOT_MAX_PHASES] = {};
+        static inline std::size_t phaseCount = 0;
+        // Time stamp taken during the static initialisation of main.cpp
+        static inline uint32_t epoch = (CycleCounter::enable(), CycleCounter::now());
+
+        // Ports A..G, in RCC_AHB4ENR bit order
+        static GPIO_TypeDef *portAt(std::size_t index)
+        {
+            GPIO_TypeDef *const ports[BOOT_PORTS] = {GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOF, GPIOG};
+            return ports[index];
+        }
+
+        static std::size_t portIndex(const GPIO_TypeDef *port)
+        {
+            for (std::size_t i = 0; i < BOOT_PORTS; i++)
+            {
+                if (portAt(i) == port)
+                {
+                    return i;
+                }
+            }
+            return NO_PORT;
+        }
+
+        static void apply()
+        {
+            if (clocks)
+            {
+                RCC->AHB4ENR = RCC->AHB4ENR | clocks; // Not |=: compound assignment to a volatile is deprecated in C++20
+                (void)RCC->AHB4ENR; // Read back: delay after an RCC peripheral clock enabling
+                clocks = 0;
+            }
+            for (std::size_t i = 0; i < BOOT_PORTS; i++)
+            {
+                PortImage &image = images[i];
+                if (!image.mask2)
+                {
+                    continue;
+                }
+                GPIO_TypeDef *port = portAt(i);
+                if (image.out1)
+                {
+                    port->OSPEEDR = (port->OSPEEDR & ~image.out2) | image.ospeedr;
+                    port->OTYPER = (port->OTYPER & ~image.out1) | image.otyper;
+                }
+                port->PUPDR = (port->PUPDR & ~image.mask2) | image.pupdr;
+                for (std::size_t r = 0; r < 2; r++)
+                {
+                    if (image.afrMask[r])
+                    {
+                        port->AFR[r] = (port->AFR[r] & ~image.afrMask[r]) | image.afr[r];
+                    }
+                }
+                port->MODER = (port->MODER & ~image.mask2) | image.moder;
+                image = PortImage{};
+            }
+        }
+
+        static uint32_t toMicros(uint32_t ticks)
+        {
+#if defined(__arm__)
+            return (uint32_t)((uint64_t)ticks * 1000000U / SystemCoreClock);
+#else
+            return ticks / 1000U;
+#endif
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_BOOT_SEQUENCER_HPP
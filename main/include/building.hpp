@@ -0,0 +1,210 @@
+/**
+ * Building coupled model: N rooms on one MCU.
+ *
+ * building_coupled<Config> instantiates Config::hardware(i) rooms of
+ * room_coupled<Config> (room.hpp). The CO2 sensors of all rooms are converted
+ * by one AdcScanner over Config::scanInputs (one ADC1 sequence, up to 16
+ * ranks) and the servos share the channels of one PWM timer.
+ *
+ * BuildingScaling measures, for a given number of rooms and in virtual time
+ * (HeapRootCoordinator<VirtualClock>, drivers really called):
+ *  - the heap used by the model and its coordinator, per room,
+ *  - the events processed per second of CPU time,
+ *  - the CPU load of one room in real time, and the number of rooms the
+ *    clock can keep in real time (SystemCoreClock on the board).
+ */
+
+#ifndef RT_BUILDING_HPP
+#define RT_BUILDING_HPP
+
+#include <cstdio>
+#include <malloc.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "cadmium/modeling/devs/coupled.hpp"
+#include "room.hpp"
+#include "adc_scan.hpp"
+#include "heap_coordinator.hpp"
+#include "boot_sequencer.hpp"
+#include "profiler.hpp"
+
+namespace cadmium
+{
+
+    // Channel of the shared scan and its analog pin
+    struct ScanInput
+    {
+        uint32_t channel;
+        GPIO_TypeDef *port;
+        uint16_t pin;
+    };
+
+    /**
+     * Rooms of the scaling build: each room keeps the LED, motion and DHT11
+     * pins of the lab (one board), reads its CO2 sensor on rank i of an
+     * 8-channel ADC1 scan and drives its servo on TIM4 channel i % 4 (PD12..15).
+     * Beyond 8 rooms the ranks wrap (external analog multiplexer).
+     */
+    struct BuildingRoom
+    {
+        static constexpr bool sharedScan = true;
+        static constexpr std::size_t scanLength = 8;
+        static constexpr double scanPeriod = 0.8; // Same rate as AnalogInput
+
+        static inline const ScanInput scanInputs[scanLength] = {
+            {ADC_CHANNEL_16, GPIOA, GPIO_PIN_0}, {ADC_CHANNEL_15, GPIOA, GPIO_PIN_3},
+            {ADC_CHANNEL_3, GPIOA, GPIO_PIN_6}, {ADC_CHANNEL_7, GPIOA, GPIO_PIN_7},
+            {ADC_CHANNEL_5, GPIOB, GPIO_PIN_1}, {ADC_CHANNEL_10, GPIOC, GPIO_PIN_0},
+            {ADC_CHANNEL_13, GPIOC, GPIO_PIN_3}, {ADC_CHANNEL_4, GPIOC, GPIO_PIN_4}};
+
+        static RoomHardware hardware(std::size_t index)
+        {
+            static constexpr uint32_t channels[4] = {TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3, TIM_CHANNEL_4};
+
+            RoomHardware hw = LabRoom::hardware(index);
+            hw.co2Adc = nullptr;
+            hw.co2Port = nullptr;
+            hw.co2Rank = index % scanLength;
+            hw.servoChannel = channels[index % 4];
+            hw.servoPort = GPIOD;
+            hw.servo = {
+                .Pin = static_cast<uint32_t>(GPIO_PIN_12 << (index % 4)),
+                .Mode = GPIO_MODE_AF_PP,
+                .Pull = GPIO_NOPULL,
+                .Speed = GPIO_SPEED_FREQ_LOW,
+                .Alternate = GPIO_AF2_TIM4};
+            return hw;
+        }
+    };
+
+    template <class Config>
+    struct building_coupled : public Coupled
+    {
+        static_assert(Config::sharedScan, "building rooms read their CO2 sensor from the shared scan");
+
+        /**
+         * Constructor
+         * @param id - Unique model identifier
+         * @param rooms - Number of rooms
+         * @param adc - ADC converting the CO2 sensors (initialised by MX_ADCx_Init())
+         */
+        building_coupled(const std::string &id, std::size_t rooms, ADC_HandleTypeDef *adc) : Coupled(id)
+        {
+            uint32_t channels[Config::scanLength];
+            for (std::size_t r = 0; r < Config::scanLength; r++)
+            {
+                const ScanInput &input = Config::scanInputs[r];
+                channels[r] = input.channel;
+                BootSequencer::requestPin(input.port, {.Pin = input.pin, .Mode = GPIO_MODE_ANALOG, .Pull = GPIO_NOPULL, .Speed = GPIO_SPEED_FREQ_LOW, .Alternate = 0});
+            }
+            auto scanner = addComponent<Profiled<AdcScanner>>("scanner", adc, channels, Config::scanLength, Config::scanPeriod);
+
+            uint32_t started = 0; // TIM channels already set to PWM, one bit per channel
+            for (std::size_t i = 0; i < rooms; i++)
+            {
+                RoomHardware hw = Config::hardware(i);
+                auto room = addComponent<room_coupled<Config>>("room" + std::to_string(i), hw);
+                addCoupling(scanner->out, room->scan);
+
+                uint32_t bit = 1U << (hw.servoChannel >> 2);
+                if (!(started & bit))
+                {
+                    startServoChannel(hw.servoTimer, hw.servoChannel);
+                    started |= bit;
+                }
+            }
+
+            BootSequencer::commit();
+        }
+
+    private:
+        // PWM mode 1, duty cycle 0 until the first command
+        static void startServoChannel(TIM_HandleTypeDef *timer, uint32_t channel)
+        {
+            TIM_OC_InitTypeDef config = {};
+            config.OCMode = TIM_OCMODE_PWM1;
+            config.Pulse = 0;
+            config.OCPolarity = TIM_OCPOLARITY_HIGH;
+            config.OCFastMode = TIM_OCFAST_DISABLE;
+            HAL_TIM_PWM_ConfigChannel(timer, &config, channel);
+            HAL_TIM_PWM_Start(timer, channel);
+        }
+    };
+
+    class BuildingScaling
+    {
+    public:
+        /**
+         * Build a building of the given number of rooms, simulate it for
+         * seconds of virtual time and report one line
+         * "building;<rooms>;<heap_bytes>;<bytes_per_room>;<events>;<transitions>;<events_per_s>;<room_load_ppm>;<max_rooms>".
+         * room_load_ppm is the CPU time one room needs per second of real time.
+         */
+        template <class Config>
+        static void measure(std::size_t rooms, double seconds, ADC_HandleTypeDef *adc, void (*sink)(const char *line))
+        {
+            std::size_t before = heapInUse();
+            auto model = std::make_shared<building_coupled<Config>>("building", rooms, adc);
+            HeapRootCoordinator<VirtualClock> coordinator(model);
+            std::size_t bytes = heapInUse() - before;
+
+            // Slices of one virtual second keep every CycleCounter difference below one wrap
+            coordinator.start();
+            uint64_t busy = 0;
+            for (double elapsed = 0; elapsed < seconds; elapsed += 1.0)
+            {
+                uint32_t begin = CycleCounter::now();
+                coordinator.simulate(1.0);
+                busy += CycleCounter::now() - begin;
+            }
+            coordinator.stop();
+
+            double busySeconds = static_cast<double>(busy) / tickRate();
+            double roomLoad = busySeconds / seconds / rooms;
+            unsigned long events = coordinator.getEventCount();
+
+            char line[128];
+            std::snprintf(line, sizeof(line), "building;%lu;%lu;%lu;%lu;%lu;%lu;%lu;%lu\n",
+                          (unsigned long)rooms, (unsigned long)bytes, (unsigned long)(bytes / rooms), events, coordinator.getTransitionCount(),
+                          (unsigned long)(busySeconds > 0 ? events / busySeconds : 0),
+                          (unsigned long)(roomLoad * 1e6), (unsigned long)(roomLoad > 0 ? 1.0 / roomLoad : 0));
+            sink(line);
+        }
+
+        // measure() for 1, 2, 4, ... up to maxRooms rooms, after a header line
+        template <class Config>
+        static void sweep(std::size_t maxRooms, double seconds, ADC_HandleTypeDef *adc, void (*sink)(const char *line))
+        {
+            sink("building;rooms;heap_bytes;bytes_per_room;events;transitions;events_per_s;room_load_ppm;max_rooms\n");
+            for (std::size_t rooms = 1; rooms <= maxRooms; rooms *= 2)
+            {
+                measure<Config>(rooms, seconds, adc, sink);
+            }
+        }
+
+        // Bytes currently allocated on the heap
+        static std::size_t heapInUse()
+        {
+#if defined(__arm__)
+            return mallinfo().uordblks; // newlib
+#else
+            return mallinfo2().uordblks;
+#endif
+        }
+
+    private:
+        // CycleCounter ticks per second
+        static double tickRate()
+        {
+#if defined(__arm__)
+            return SystemCoreClock;
+#else
+            return 1e9;
+#endif
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_BUILDING_HPP
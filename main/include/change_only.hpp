@@ -0,0 +1,136 @@
+/**
+ * Change-only output adapter.
+ *
+ * Most models send their current value at every internal transition whether
+ * it changed or not (the CO2 input every 0.8 s, the PIR level every 0.5 s, the
+ * DHT11 trigger every 2 s), and every message costs the receivers an external
+ * transition, a log line and often a GPIO or timer write.
+ *
+ * ChangeOnly<M> wraps the atomic model M and, after each output() call, drops
+ * port by port the message equal to the last one sent on that port. A
+ * floating-point port can be given a deadband: a value within it of the last
+ * value sent counts as unchanged. The reference stays the last value sent, so
+ * a slow drift still goes out once it exceeds the deadband.
+ *
+ * Ports of bool, integer and floating-point messages are filtered, other
+ * types (ScanFrame...) are passed through. The last values sent live in the
+ * wrapper, not in the model state: after a checkpoint restore the first
+ * message of every port is sent again.
+ */
+
+#ifndef RT_CHANGE_ONLY_HPP
+#define RT_CHANGE_ONLY_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "cadmium/modeling/devs/atomic.hpp"
+#include "wrapped_model.hpp"
+
+namespace cadmium
+{
+
+    // What a ChangeOnly<> model sends
+    struct ChangeOnlyConfig
+    {
+        bool enabled = true;      // false: every message goes out, as without the wrapper
+        float ppmDeadband = 5.0f; // CO2 input: change (ppm) needed to send the value again
+    };
+
+    template <class M>
+    class ChangeOnly : public M
+    {
+        using Reader = double (*)(const PortInterface &);
+
+        // Filter of one output port
+        struct Filter
+        {
+            PortInterface *port;
+            Reader latest;   // Last message of the port as a double, nullptr for types passed through
+            double deadband; // Largest change still considered equal
+            double sent;     // Last value sent
+            bool primed;     // A value was sent
+        };
+
+        std::vector<Filter> filters;
+        bool enabled;
+        unsigned long dropped; // Messages suppressed
+
+        template <typename T>
+        static double latestOf(const PortInterface &port)
+        {
+            return static_cast<double>(static_cast<const _Port<T> &>(port).getBag().back());
+        }
+
+        template <typename... T>
+        static Reader readerOf(const PortInterface &port)
+        {
+            Reader reader = nullptr;
+            ((reader = reader == nullptr && dynamic_cast<const _Port<T> *>(&port) != nullptr ? &latestOf<T> : reader), ...);
+            return reader;
+        }
+
+    public:
+        template <typename... Args>
+        explicit ChangeOnly(Args &&...args) : M(std::forward<Args>(args)...), enabled(true), dropped(0)
+        {
+            for (const auto &port : this->getOutPorts())
+            {
+                Reader reader = readerOf<bool, uint8_t, uint16_t, int, unsigned, float, double>(*port);
+                filters.push_back({port.get(), reader, 0.0, 0.0, false});
+            }
+        }
+
+        // Apply the given settings (deadbands are set per port with deadband())
+        void configure(const ChangeOnlyConfig &config)
+        {
+            enabled = config.enabled;
+        }
+
+        // Changes of at most band on port are not sent
+        void deadband(const std::shared_ptr<PortInterface> &port, double band)
+        {
+            for (Filter &filter : filters)
+            {
+                if (filter.port == port.get())
+                {
+                    filter.deadband = band;
+                }
+            }
+        }
+
+        [[nodiscard]] unsigned long droppedMessages() const { return dropped; }
+
+        void output() override
+        {
+            WrappedModel<M>::output(*this);
+            if (!enabled)
+            {
+                return;
+            }
+            for (Filter &filter : filters)
+            {
+                if (filter.latest == nullptr || filter.port->empty())
+                {
+                    continue;
+                }
+                double value = filter.latest(*filter.port);
+                if (filter.primed && std::fabs(value - filter.sent) <= filter.deadband)
+                {
+                    filter.port->clear();
+                    dropped++;
+                }
+                else
+                {
+                    filter.sent = value;
+                    filter.primed = true;
+                }
+            }
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_CHANGE_ONLY_HPP
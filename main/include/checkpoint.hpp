@@ -0,0 +1,473 @@
+/**
+ * Checkpoint and warm restart of the model state.
+ *
+ * Wrapping an atomic model in Persistent<> registers its state (a trivially
+ * copyable struct) in CheckpointRegistry. Checkpoint<Store>::save() writes the
+ * registered states as one snapshot into the next slot of Store, and
+ * Checkpoint<Store>::restore() copies the newest valid snapshot back into the
+ * states, so that after a reset or a brown-out the CO2 smoothing buffer, the
+ * servo command index and the button state resume where they were instead of
+ * starting over.
+ *
+ * A snapshot is a CheckpointHeader, the states in registration order and a
+ * CRC-32 computed by the CRC peripheral over both. It is only restored when
+ * its format and layout (hash of the ids and sizes of the registered states)
+ * match the running firmware. Elapsed times are not saved: a restored model
+ * resumes as if its last transition had happened at boot.
+ *
+ * Stores are rings of fixed-size slots split in two pages, written in turn
+ * (wear levelling) with the sequence number deciding the newest snapshot; a
+ * page is erased only when the ring enters it, so the previous snapshot
+ * survives a reset during the write:
+ *  - BackupSramStore (default): the 4 KB backup SRAM, 8 slots,
+ *  - FlashSectorStore (DEVS_CHECKPOINT_FLASH): sectors 6 and 7 of flash
+ *    bank 2, taken out of the FLASH region of STM32H743XX_FLASH.ld by the
+ *    same CMake option, 512 slots. A sector erase blocks for about one
+ *    second once every 256 snapshots.
+ *
+ * Without DEVS_CHECKPOINT, Persistent<M> is an alias of M and costs nothing.
+ */
+
+#ifndef RT_CHECKPOINT_HPP
+#define RT_CHECKPOINT_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "cadmium/modeling/devs/atomic.hpp"
+
+extern "C"
+{
+#include "stm32h7xx_hal.h"
+#include "crc.h"
+}
+
+#ifndef CHECKPOINT_PERIOD
+#define CHECKPOINT_PERIOD 60.0 // Seconds between two snapshots
+#endif
+
+namespace cadmium
+{
+
+    constexpr std::size_t CHECKPOINT_MAX_MODELS = 16;   // Registered states (others are not saved)
+    constexpr std::size_t CHECKPOINT_SLOT_SIZE = 512;   // Bytes per snapshot slot, a multiple of the 32-byte flash word
+    constexpr uint32_t CHECKPOINT_MAGIC = 0x4B435644;   // "DVCK"
+    constexpr uint16_t CHECKPOINT_FORMAT = 1;           // Version of the snapshot layout below
+
+    // Start of every snapshot, followed by the states and a CRC-32 of header and states
+    struct CheckpointHeader
+    {
+        uint32_t magic;
+        uint16_t format;
+        uint16_t length;   // Bytes of states
+        uint32_t layout;   // CheckpointRegistry::layout() of the firmware that wrote it
+        uint32_t sequence; // Incremented at every save; the highest valid one is restored
+    };
+
+    /**
+     * States saved in a snapshot, in registration (construction) order. The
+     * table is static and filled by Persistent<>, so saving never allocates.
+     */
+    class CheckpointRegistry
+    {
+    public:
+        struct Entry
+        {
+            void *state;
+            uint16_t size;
+            uint32_t idHash;
+        };
+
+        static void add(const std::string &id, void *state, std::size_t size)
+        {
+            if (used < CHECKPOINT_MAX_MODELS)
+            {
+                table[used++] = {state, static_cast<uint16_t>(size), fnv1a(id.data(), id.size(), 2166136261u)};
+            }
+        }
+
+        static void remove(const void *state)
+        {
+            for (std::size_t i = 0; i < used; i++)
+            {
+                if (table[i].state == state)
+                {
+                    std::memmove(&table[i], &table[i + 1], (used - i - 1) * sizeof(Entry));
+                    used--;
+                    return;
+                }
+            }
+        }
+
+        static const Entry *entries(std::size_t &count)
+        {
+            count = used;
+            return table;
+        }
+
+        // Bytes of all registered states
+        static std::size_t length()
+        {
+            std::size_t bytes = 0;
+            for (std::size_t i = 0; i < used; i++)
+            {
+                bytes += table[i].size;
+            }
+            return bytes;
+        }
+
+        // Hash of the ids and sizes of the registered states, in order
+        static uint32_t layout()
+        {
+            uint32_t hash = 2166136261u;
+            for (std::size_t i = 0; i < used; i++)
+            {
+                hash = fnv1a(&table[i].idHash, sizeof(table[i].idHash), hash);
+                hash = fnv1a(&table[i].size, sizeof(table[i].size), hash);
+            }
+            return hash;
+        }
+
+    private:
+        static inline Entry table[CHECKPOINT_MAX_MODELS] = {};
+        static inline std::size_t used = 0;
+
+        static uint32_t fnv1a(const void *data, std::size_t size, uint32_t hash)
+        {
+            const uint8_t *bytes = static_cast<const uint8_t *>(data);
+            for (std::size_t i = 0; i < size; i++)
+            {
+                hash = (hash ^ bytes[i]) * 16777619u;
+            }
+            return hash;
+        }
+    };
+
+#ifdef DEVS_CHECKPOINT
+    /**
+     * Persistent<M>: the atomic model M with its state registered for
+     * checkpoints. Constructor arguments are forwarded to M.
+     */
+    template <class M>
+    class Persistent : public M
+    {
+    public:
+        template <typename... Args>
+        explicit Persistent(Args &&...args) : M(std::forward<Args>(args)...)
+        {
+            static_assert(std::is_trivially_copyable_v<std::remove_reference_t<decltype(this->state)>>, "checkpointed states are saved byte by byte");
+            CheckpointRegistry::add(this->getId(), &this->state, sizeof(this->state));
+        }
+
+        ~Persistent()
+        {
+            CheckpointRegistry::remove(&this->state);
+        }
+    };
+#else
+    template <class M>
+    using Persistent = M;
+#endif
+
+    // Backup SRAM: 4 KB kept through resets and brown-outs (and on VBAT with the backup regulator)
+    struct BackupSramStore
+    {
+        static constexpr std::size_t slotsPerPage = 4;
+        static constexpr std::size_t pages = 2;
+
+        static void init()
+        {
+            HAL_PWR_EnableBkUpAccess();
+            __HAL_RCC_BKPRAM_CLK_ENABLE();
+            HAL_PWREx_EnableBkUpReg();
+        }
+
+        static const uint8_t *slot(std::size_t index)
+        {
+            return reinterpret_cast<const uint8_t *>(D3_BKPSRAM_BASE + index * CHECKPOINT_SLOT_SIZE);
+        }
+
+        static bool erase(std::size_t page)
+        {
+            std::memset(reinterpret_cast<void *>(D3_BKPSRAM_BASE + page * slotsPerPage * CHECKPOINT_SLOT_SIZE), 0xFF,
+                        slotsPerPage * CHECKPOINT_SLOT_SIZE);
+            return true;
+        }
+
+        static bool program(std::size_t index, const uint8_t *data)
+        {
+            std::memcpy(reinterpret_cast<void *>(D3_BKPSRAM_BASE + index * CHECKPOINT_SLOT_SIZE), data, CHECKPOINT_SLOT_SIZE);
+            return true;
+        }
+    };
+
+    // Sectors 6 and 7 of flash bank 2 (programmed by 32-byte flash words)
+    struct FlashSectorStore
+    {
+        static constexpr std::size_t slotsPerPage = FLASH_SECTOR_SIZE / CHECKPOINT_SLOT_SIZE;
+        static constexpr std::size_t pages = 2;
+        static constexpr uint32_t firstSector = FLASH_SECTOR_6;
+
+        static void init() {}
+
+        static uintptr_t address(std::size_t index)
+        {
+            return FLASH_BANK2_BASE + firstSector * FLASH_SECTOR_SIZE + index * CHECKPOINT_SLOT_SIZE;
+        }
+
+        static const uint8_t *slot(std::size_t index)
+        {
+            return reinterpret_cast<const uint8_t *>(address(index));
+        }
+
+        static bool erase(std::size_t page)
+        {
+            FLASH_EraseInitTypeDef erase = {};
+            erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+            erase.Banks = FLASH_BANK_2;
+            erase.Sector = firstSector + page;
+            erase.NbSectors = 1;
+            erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+            uint32_t error = 0;
+            HAL_FLASH_Unlock();
+            bool ok = HAL_FLASHEx_Erase(&erase, &error) == HAL_OK;
+            HAL_FLASH_Lock();
+            return ok;
+        }
+
+        static bool program(std::size_t index, const uint8_t *data)
+        {
+            constexpr std::size_t word = FLASH_NB_32BITWORD_IN_FLASHWORD * 4;
+            bool ok = true;
+            HAL_FLASH_Unlock();
+            for (std::size_t offset = 0; ok && offset < CHECKPOINT_SLOT_SIZE; offset += word)
+            {
+                ok = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, address(index) + offset, reinterpret_cast<uintptr_t>(data + offset)) == HAL_OK;
+            }
+            HAL_FLASH_Lock();
+            return ok;
+        }
+    };
+
+#ifdef DEVS_CHECKPOINT_FLASH
+    using CheckpointStore = FlashSectorStore;
+#else
+    using CheckpointStore = BackupSramStore;
+#endif
+
+    /**
+     * Snapshots of the registered states in Store. MX_CRC_Init() must have
+     * been called before the first save or restore.
+     */
+    template <class Store = CheckpointStore>
+    class Checkpoint
+    {
+    public:
+        static constexpr std::size_t slots = Store::slotsPerPage * Store::pages;
+
+        // Write the registered states into the next slot; false when they do not fit or the store failed
+        static bool save()
+        {
+            scan();
+            std::size_t length = CheckpointRegistry::length();
+            if (sizeof(CheckpointHeader) + length + sizeof(uint32_t) > CHECKPOINT_SLOT_SIZE)
+            {
+                return false;
+            }
+
+            std::memset(buffer, 0xFF, sizeof(buffer));
+            CheckpointHeader header = {CHECKPOINT_MAGIC, CHECKPOINT_FORMAT, static_cast<uint16_t>(length),
+                                       CheckpointRegistry::layout(), sequence + 1};
+            std::memcpy(buffer, &header, sizeof(header));
+            std::size_t count;
+            const CheckpointRegistry::Entry *entries = CheckpointRegistry::entries(count);
+            std::size_t offset = sizeof(header);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                std::memcpy(buffer + offset, entries[i].state, entries[i].size);
+                offset += entries[i].size;
+            }
+            uint32_t crc = crc32(buffer, offset);
+            std::memcpy(buffer + offset, &crc, sizeof(crc));
+
+            // A slot already written means the ring has wrapped: move to the start of a page and erase it
+            std::size_t index = next;
+            if (!blank(index))
+            {
+                if (index % Store::slotsPerPage != 0)
+                {
+                    index = (index / Store::slotsPerPage + 1) * Store::slotsPerPage % slots;
+                }
+                if (!Store::erase(index / Store::slotsPerPage))
+                {
+                    return false;
+                }
+            }
+            if (!Store::program(index, buffer))
+            {
+                next = (index + 1) % slots; // Never write twice to a failed slot
+                return false;
+            }
+            newest = index;
+            next = (index + 1) % slots;
+            sequence = header.sequence;
+            return true;
+        }
+
+        // Copy the newest valid snapshot into the registered states; false when there is none
+        static bool restore()
+        {
+            scan();
+            if (newest == slots)
+            {
+                return false;
+            }
+            std::size_t count;
+            const CheckpointRegistry::Entry *entries = CheckpointRegistry::entries(count);
+            const uint8_t *data = Store::slot(newest) + sizeof(CheckpointHeader);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                std::memcpy(entries[i].state, data, entries[i].size);
+                data += entries[i].size;
+            }
+            return true;
+        }
+
+        // Sequence number of the last snapshot written or found (0: none)
+        static uint32_t lastSequence()
+        {
+            scan();
+            return sequence;
+        }
+
+    private:
+        static inline bool scanned = false;
+        static inline std::size_t newest = 0;   // Slot of the newest valid snapshot (slots: none)
+        static inline std::size_t next = 0;     // Slot of the next save
+        static inline uint32_t sequence = 0;    // Sequence of the newest snapshot
+        alignas(32) static inline uint8_t buffer[CHECKPOINT_SLOT_SIZE];
+
+        static uint32_t crc32(const uint8_t *data, std::size_t length)
+        {
+            return HAL_CRC_Calculate(&hcrc, reinterpret_cast<uint32_t *>(const_cast<uint8_t *>(data)), static_cast<uint32_t>(length));
+        }
+
+        static bool blank(std::size_t index)
+        {
+            const uint8_t *slot = Store::slot(index);
+            for (std::size_t i = 0; i < CHECKPOINT_SLOT_SIZE; i++)
+            {
+                if (slot[i] != 0xFF)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static bool valid(std::size_t index, uint32_t layout, std::size_t length, CheckpointHeader &header)
+        {
+            const uint8_t *slot = Store::slot(index);
+            std::memcpy(&header, slot, sizeof(header));
+            if (header.magic != CHECKPOINT_MAGIC || header.format != CHECKPOINT_FORMAT || header.layout != layout || header.length != length ||
+                sizeof(header) + length + sizeof(uint32_t) > CHECKPOINT_SLOT_SIZE)
+            {
+                return false;
+            }
+            uint32_t crc;
+            std::memcpy(&crc, slot + sizeof(header) + length, sizeof(crc));
+            return crc == crc32(slot, sizeof(header) + length);
+        }
+
+        // Find the newest valid snapshot once; the next save goes to the slot after it
+        static void scan()
+        {
+            if (scanned)
+            {
+                return;
+            }
+            scanned = true;
+            Store::init();
+            newest = slots;
+            uint32_t layout = CheckpointRegistry::layout();
+            std::size_t length = CheckpointRegistry::length();
+            for (std::size_t i = 0; i < slots; i++)
+            {
+                CheckpointHeader header;
+                if (valid(i, layout, length, header) && (newest == slots || static_cast<int32_t>(header.sequence - sequence) > 0))
+                {
+                    newest = i;
+                    sequence = header.sequence;
+                }
+            }
+            next = newest == slots ? 0 : (newest + 1) % slots;
+        }
+    };
+
+    // State of the CheckpointWriter model
+    struct CheckpointWriterState
+    {
+        double sigma;         // Time until the next snapshot
+        unsigned long saved;  // Snapshots written
+        unsigned long failed; // Snapshots that did not fit or could not be written
+
+        constexpr CheckpointWriterState() : sigma(CHECKPOINT_PERIOD), saved(0), failed(0) {}
+    };
+
+    inline std::ostream &operator<<(std::ostream &out, const CheckpointWriterState &state)
+    {
+        out << "Checkpoints: " << state.saved << ", failed: " << state.failed;
+        return out;
+    }
+
+    /**
+     * CheckpointWriter: saves a snapshot of the registered states every
+     * period, as an event of the simulation so that no transition is
+     * interrupted.
+     */
+    template <class Store = CheckpointStore>
+    class CheckpointWriter : public Atomic<CheckpointWriterState>
+    {
+    public:
+        double period; // Time between two snapshots
+
+        CheckpointWriter(const std::string &id, double savePeriod = CHECKPOINT_PERIOD)
+            : Atomic<CheckpointWriterState>(id, CheckpointWriterState()), period(savePeriod)
+        {
+            state.sigma = period;
+        }
+
+        void internalTransition(CheckpointWriterState &state) const override
+        {
+            if (Checkpoint<Store>::save())
+            {
+                state.saved++;
+            }
+            else
+            {
+                state.failed++;
+            }
+            state.sigma = period;
+        }
+
+        void externalTransition(CheckpointWriterState &state, double e) const override
+        {
+        }
+
+        void output(const CheckpointWriterState &state) const override
+        {
+        }
+
+        [[nodiscard]] double timeAdvance(const CheckpointWriterState &state) const override
+        {
+            return state.sigma;
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_CHECKPOINT_HPP
@@ -15,7 +15,7 @@ namespace cadmium
         double duty;  // PWM duty cycle corresponding to the servo angle
         double sigma; // Time until the next internal transition
 
-        ServoControllerState() : duty(0.0), sigma(std::numeric_limits<double>::infinity()) {}
+        constexpr ServoControllerState() : duty(0.0), sigma(std::numeric_limits<double>::infinity()) {}
     };
 
     // Optional debug print for logging the state
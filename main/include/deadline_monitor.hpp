@@ -0,0 +1,205 @@
+/**
+ * Real-time deadline and jitter monitor.
+ *
+ * DeadlineMonitoredClock<C> decorates the real-time clock C handed to the
+ * RealTimeRootCoordinator. Every time the coordinator waits for the next event,
+ * the decorator compares the scheduled simulation time with the wall-clock time
+ * actually reached (TIM2 on the board, std::chrono on the host) and feeds the
+ * lateness to DeadlineMonitor, which keeps a jitter histogram, counts missed
+ * deadlines and applies the configured lag policy.
+ *
+ * Per-model miss counts are attributed by Profiled<> (profiler.hpp): every
+ * scheduled transition that runs while the current event is late is counted
+ * against its model.
+ */
+
+#ifndef RT_DEADLINE_MONITOR_HPP
+#define RT_DEADLINE_MONITOR_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include "cadmium/exception.hpp"
+#include "profiler.hpp"
+
+#if defined(__arm__)
+#include "tim2_clock.hpp"
+#else
+#include <chrono>
+#endif
+
+namespace cadmium
+{
+
+    // What to do once the simulation lags behind wall-clock time by more than the lag bound
+    enum class LagPolicy
+    {
+        CatchUp, // Keep going: events run back to back until the backlog is gone
+        Skip,    // Forgive the backlog: re-anchor the clock so later events are timed from now
+        Abort    // Stop the simulation with a CadmiumSimulationException
+    };
+
+    /**
+     * Global lateness statistics. Lateness is measured in microseconds and
+     * stored in a TransitionStats so it shares the profiler's histogram layout.
+     */
+    class DeadlineMonitor
+    {
+    public:
+        /**
+         * @param toleranceSeconds - Lateness above which an event counts as a missed deadline
+         * @param lagBoundSeconds - Lateness above which the lag policy is applied
+         * @param lagPolicy - Policy applied when the lag bound is exceeded
+         */
+        static void configure(double toleranceSeconds, double lagBoundSeconds, LagPolicy lagPolicy)
+        {
+            tolerance = toleranceSeconds;
+            lagBound = lagBoundSeconds;
+            policy = lagPolicy;
+        }
+
+        /**
+         * Record one event. Returns the correction (in seconds) the clock must
+         * add to its time base, which is non-zero only under LagPolicy::Skip.
+         */
+        static double record(double scheduled, double actual)
+        {
+            double lateness = actual - scheduled;
+            if (lateness < 0.0)
+            {
+                lateness = 0.0; // The clock never releases an event early; guard against rounding
+            }
+            jitter.record(static_cast<uint32_t>(lateness * 1e6));
+
+            bool late = lateness > tolerance;
+            Profiler::eventLate = late;
+            missed += late;
+
+            if (lateness > lagBound)
+            {
+                overruns++;
+                switch (policy)
+                {
+                case LagPolicy::CatchUp:
+                    break;
+                case LagPolicy::Skip:
+                    return lateness;
+                case LagPolicy::Abort:
+                    throw CadmiumSimulationException("Real-time lag bound exceeded");
+                }
+            }
+            return 0.0;
+        }
+
+        [[nodiscard]] static const TransitionStats &lateness() { return jitter; }
+        [[nodiscard]] static uint32_t missedDeadlines() { return missed; }
+        [[nodiscard]] static uint32_t lagOverruns() { return overruns; }
+
+        /**
+         * Report the summary, the lateness histogram and the misses per model,
+         * line by line, in the same format as Profiler::report().
+         */
+        static void report(void (*sink)(const char *line))
+        {
+            char line[160];
+            std::snprintf(line, sizeof(line), "events;%lu;missed;%lu;lag_overruns;%lu;lateness_us min/mean/max;%lu;%lu;%lu\n",
+                          (unsigned long)jitter.count, (unsigned long)missed, (unsigned long)overruns,
+                          (unsigned long)jitter.min, (unsigned long)jitter.mean(), (unsigned long)jitter.max);
+            sink(line);
+            for (std::size_t b = 0; b < PROFILER_BUCKETS; b++)
+            {
+                if (jitter.histogram[b])
+                {
+                    std::snprintf(line, sizeof(line), "lateness_bucket;b%u;%lu\n", (unsigned)b, (unsigned long)jitter.histogram[b]);
+                    sink(line);
+                }
+            }
+            std::size_t count;
+            const ModelProfile *rows = Profiler::rows(count);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                std::snprintf(line, sizeof(line), "missed;%s;%lu\n", rows[i].id, (unsigned long)rows[i].missedDeadlines);
+                sink(line);
+            }
+        }
+
+    private:
+        static inline double tolerance = 0.001;
+        static inline double lagBound = 1.0;
+        static inline LagPolicy policy = LagPolicy::CatchUp;
+        static inline TransitionStats jitter = {};
+        static inline uint32_t missed = 0;
+        static inline uint32_t overruns = 0;
+    };
+
+    /**
+     * DeadlineMonitoredClock<C>: real-time clock C with lateness tracking.
+     * It exposes the same start/stop/waitUntil interface, so it can be passed
+     * to RealTimeRootCoordinator in place of C.
+     */
+    template <class C>
+    class DeadlineMonitoredClock : public C
+    {
+        double origin;      // Simulation time at start()
+        double offset;      // Accumulated re-anchoring (LagPolicy::Skip)
+#if defined(__arm__)
+        uint32_t startTicks; // TIM2 counter at start()
+        double tickPeriod;   // Seconds per TIM2 tick
+#else
+        std::chrono::steady_clock::time_point startTime;
+#endif
+
+        // Wall-clock seconds elapsed since start()
+        double elapsed() const
+        {
+#if defined(__arm__)
+            return (uint32_t)(__HAL_TIM_GET_COUNTER(&htim2) - startTicks) * tickPeriod;
+#else
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+#endif
+        }
+
+    public:
+        template <typename... Args>
+        explicit DeadlineMonitoredClock(Args &&...args) : C(std::forward<Args>(args)...), origin(0.0), offset(0.0)
+        {
+        }
+
+        void start(double timeLast)
+        {
+            C::start(timeLast);
+            origin = timeLast;
+            offset = 0.0;
+#if defined(__arm__)
+            tickPeriod = tim2TickPeriod();
+            startTicks = __HAL_TIM_GET_COUNTER(&htim2);
+#else
+            startTime = std::chrono::steady_clock::now();
+#endif
+        }
+
+        void stop(double timeLast)
+        {
+            C::stop(timeLast + offset);
+        }
+
+        /**
+         * Wait for the scheduled time, then measure how late the event really is.
+         * The wrapped clock sees a time base shifted by the skipped lag; the time
+         * it returns (earlier than timeNext if its wait was cut short) is the
+         * one the coordinator advances to and the deadline lateness is measured
+         * against.
+         */
+        double waitUntil(double timeNext)
+        {
+            double target = timeNext + offset;
+            double returned = C::waitUntil(target);
+            double reached = returned == target ? timeNext : returned - offset; // Exactly timeNext when the wait completed
+            double actual = origin + elapsed() - offset;
+            offset += DeadlineMonitor::record(reached, actual);
+            return reached;
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_DEADLINE_MONITOR_HPP
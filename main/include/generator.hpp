@@ -4,7 +4,7 @@
 #include <cadmium/modeling/devs/atomic.hpp>
 #include <limits>
 #include <iostream>
-#include <vector>
+#include <array>
 
 namespace cadmium
 {
@@ -12,20 +12,27 @@ namespace cadmium
     // State structure for the ServoCommandGenerator atomic model
     struct ServoCommandState
     {
-        bool input;                   // Input signal indicating whether to send commands
-        double speed;                 // Current speed command to output
-        double sigma;                 // Time until next internal transition
-        size_t index;                 // Index to track current command in the sequence
-        bool send_command;            // Flag to indicate if a command should be sent
-        std::vector<double> commands; // Predefined speed commands
-
-        ServoCommandState()
+        bool input;                     // Input signal indicating whether to send commands
+        double speed;                   // Current speed command to output
+        double sigma;                   // Time until next internal transition
+        size_t index;                   // Index to track current command in the sequence
+        bool send_command;              // Flag to indicate if a command should be sent
+        std::array<double, 3> commands; // Predefined speed commands
+
+        constexpr ServoCommandState()
             : input(false),
               speed(0.0),
               sigma(std::numeric_limits<double>::infinity()),
               index(0),
               send_command(false),
-              commands({0.25, 0.5, 0.75}) {}
+              commands{0.25, 0.5, 0.75} {}
+    };
+
+    // Command sequence of the ServoCommandGenerator model
+    struct ServoCommandConfig
+    {
+        std::array<double, 3> commands{0.25, 0.5, 0.75}; // Commands sent in turn while the input is true
+        double step = 1.0;                               // Time between two commands (s)
     };
 
     // Optional: output stream operator for debugging (empty implementation)
@@ -44,15 +51,19 @@ namespace cadmium
         Port<double> out; // Output port for speed commands
         Port<bool> in;    // Input port to receive trigger signals
 
+        double step; // Time between two commands
+
         /**
          * Constructor
          * @param id Unique identifier for the atomic model
+         * @param sequence Commands and their spacing
          */
-        ServoCommandGenerator(const std::string &id)
-            : Atomic<ServoCommandState>(id, ServoCommandState())
+        ServoCommandGenerator(const std::string &id, const ServoCommandConfig &sequence = ServoCommandConfig())
+            : Atomic<ServoCommandState>(id, ServoCommandState()), step(sequence.step)
         {
             out = addOutPort<double>("out");
             in = addInPort<bool>("in");
+            state.commands = sequence.commands;
         }
 
         /**
@@ -68,7 +79,7 @@ namespace cadmium
             {
                 state.index++;
                 state.speed = state.commands[state.index];
-                state.sigma = 1.0; // Schedule next internal event in 1 second
+                state.sigma = step; // Schedule next internal event (1 second by default)
             }
         }
 
@@ -89,12 +100,12 @@ namespace cadmium
                 {
                     state.send_command = true;
                     state.speed = state.commands[state.index];
-                    state.sigma = 1.0; // Trigger internal transition in 1 second
+                    state.sigma = step; // Trigger internal transition (1 second by default)
                 }
                 else
                 {
                     state.speed = -0.5; // Negative value signals stopping or idle
-                    state.sigma = 1.0;
+                    state.sigma = step;
                 }
             }
         }
@@ -0,0 +1,425 @@
+/**
+ * Event-heap root coordinator.
+ *
+ * Cadmium's coordinators visit every component on every event: they look for
+ * the smallest time advance, call collection/transition on each simulator and
+ * propagate every coupling. HeapRootCoordinator flattens the coupled model into
+ * its atomic models once and keeps them in an indexed binary heap keyed by next
+ * event time, so one event costs O(k log n) for the k models it touches:
+ *  - the imminent models are read from the top of the heap,
+ *  - only their output ports are routed, along couplings resolved up front,
+ *  - only imminent and influenced models transition, and each new time
+ *    advance is one O(log n) key update.
+ *
+ * The public interface (setLogger, start, simulate, stop) and the log format
+ * are the same as RealTimeRootCoordinator's, and model ids are numbered the
+ * same way, so it can replace it in main.cpp.
+ */
+
+#ifndef RT_HEAP_COORDINATOR_HPP
+#define RT_HEAP_COORDINATOR_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "cadmium/modeling/devs/coupled.hpp"
+#include "cadmium/simulation/logger/logger.hpp"
+
+namespace cadmium
+{
+
+    /**
+     * Indexed binary min-heap of model indices keyed by next event time.
+     * Ties are broken by model index so the order is deterministic.
+     */
+    class EventHeap
+    {
+        std::vector<std::size_t> heap; // heap[slot] = model index
+        std::vector<std::size_t> slot; // slot[model] = position in heap
+        std::vector<double> keys;      // keys[model] = next event time
+
+        [[nodiscard]] bool before(std::size_t a, std::size_t b) const
+        {
+            return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+        }
+
+        void place(std::size_t s, std::size_t model)
+        {
+            heap[s] = model;
+            slot[model] = s;
+        }
+
+        void siftUp(std::size_t s)
+        {
+            std::size_t model = heap[s];
+            while (s > 0)
+            {
+                std::size_t parent = (s - 1) / 2;
+                if (!before(model, heap[parent]))
+                {
+                    break;
+                }
+                place(s, heap[parent]);
+                s = parent;
+            }
+            place(s, model);
+        }
+
+        void siftDown(std::size_t s)
+        {
+            std::size_t model = heap[s];
+            std::size_t n = heap.size();
+            for (;;)
+            {
+                std::size_t child = 2 * s + 1;
+                if (child >= n)
+                {
+                    break;
+                }
+                if (child + 1 < n && before(heap[child + 1], heap[child]))
+                {
+                    child++;
+                }
+                if (!before(heap[child], model))
+                {
+                    break;
+                }
+                place(s, heap[child]);
+                s = child;
+            }
+            place(s, model);
+        }
+
+        template <typename F>
+        void visitDue(std::size_t s, double time, F &f) const
+        {
+            if (s < heap.size() && keys[heap[s]] <= time)
+            {
+                f(heap[s]);
+                visitDue(2 * s + 1, time, f);
+                visitDue(2 * s + 2, time, f);
+            }
+        }
+
+    public:
+        // Reserve room for n models (no allocation afterwards)
+        void reserve(std::size_t n)
+        {
+            heap.reserve(n);
+            slot.reserve(n);
+            keys.reserve(n);
+        }
+
+        // Add model index keys.size() with the given key
+        std::size_t push(double key)
+        {
+            std::size_t model = keys.size();
+            keys.push_back(key);
+            slot.push_back(heap.size());
+            heap.push_back(model);
+            siftUp(heap.size() - 1);
+            return model;
+        }
+
+        // Change the key of a model: O(log n)
+        void update(std::size_t model, double key)
+        {
+            double old = keys[model];
+            keys[model] = key;
+            if (key < old)
+            {
+                siftUp(slot[model]);
+            }
+            else if (key > old)
+            {
+                siftDown(slot[model]);
+            }
+        }
+
+        [[nodiscard]] double key(std::size_t model) const { return keys[model]; }
+
+        [[nodiscard]] double topKey() const
+        {
+            return heap.empty() ? std::numeric_limits<double>::infinity() : keys[heap.front()];
+        }
+
+        [[nodiscard]] std::size_t size() const { return heap.size(); }
+
+        // Call f(model) for every model whose key is <= time, without popping: O(k)
+        template <typename F>
+        void forEachDue(double time, F &&f) const
+        {
+            visitDue(0, time, f);
+        }
+    };
+
+    // Clock for runs in virtual time: events are processed back to back
+    struct VirtualClock
+    {
+        void start(double) {}
+        void stop(double) {}
+        double waitUntil(double timeNext) { return timeNext; }
+    };
+
+    /**
+     * HeapRootCoordinator<C>: root coordinator scheduling the atomic models of a
+     * coupled model through an EventHeap. C is the real-time clock (same
+     * interface as for RealTimeRootCoordinator) or VirtualClock.
+     */
+    template <class C = VirtualClock>
+    class HeapRootCoordinator
+    {
+        // Output port of one atomic model wired to an input port of another
+        struct Route
+        {
+            std::shared_ptr<const PortInterface> from;
+            std::shared_ptr<PortInterface> to;
+            std::size_t receiver;
+        };
+
+        std::shared_ptr<Coupled> model;
+        C clock;
+        std::shared_ptr<Logger> logger;
+        double timeLast; // Time of the last event
+
+        std::vector<std::shared_ptr<AtomicInterface>> atomics; // Flattened atomic models
+        std::vector<long> modelIds;                            // Logger ids, numbered like Cadmium's coordinators
+        std::vector<double> lastTransition;                    // Time of each model's last transition
+        std::vector<std::vector<Route>> routes;                // Routes grouped by sending model
+        EventHeap schedule;
+
+        std::vector<std::size_t> active; // Models transitioning in the current event
+        std::vector<uint32_t> mark;      // mark[model] == epoch when the model is in active
+        uint32_t epoch;
+
+        unsigned long events;      // Events processed
+        unsigned long transitions; // Model transitions in those events
+
+        using Links = std::unordered_map<const PortInterface *, std::vector<std::shared_ptr<PortInterface>>>;
+
+        // Collect the atomic models and all couplings, depth first in component order
+        long flatten(const Coupled &coupled, long nextId, Links &links)
+        {
+            for (const auto &[id, component] : coupled.getComponents())
+            {
+                if (auto child = std::dynamic_pointer_cast<Coupled>(component))
+                {
+                    nextId = flatten(*child, nextId + 1, links);
+                }
+                else
+                {
+                    atomics.push_back(std::dynamic_pointer_cast<AtomicInterface>(component));
+                    modelIds.push_back(nextId++);
+                }
+            }
+            for (const auto *couplings : {&coupled.getEICs(), &coupled.getICs(), &coupled.getEOCs()})
+            {
+                for (const auto &[from, to] : *couplings)
+                {
+                    links[from.get()].push_back(to);
+                }
+            }
+            return nextId;
+        }
+
+        // Follow couplings from port through coupled-model ports down to atomic input ports
+        void resolve(std::size_t sender, const std::shared_ptr<const PortInterface> &from, const PortInterface *port,
+                     const Links &links, const std::unordered_map<const Component *, std::size_t> &index)
+        {
+            auto it = links.find(port);
+            if (it == links.end())
+            {
+                return;
+            }
+            for (const auto &to : it->second)
+            {
+                auto receiver = index.find(to->getParent());
+                if (receiver != index.end())
+                {
+                    routes[sender].push_back({from, to, receiver->second});
+                }
+                else
+                {
+                    resolve(sender, from, to.get(), links, index);
+                }
+            }
+        }
+
+        void logTransition(std::size_t i, double time)
+        {
+            const AtomicInterface &atomic = *atomics[i];
+            for (const auto &outPort : atomic.getOutPorts())
+            {
+                for (std::size_t m = 0; m < outPort->size(); m++)
+                {
+                    logger->logOutput(time, modelIds[i], atomic.getId(), outPort->getId(), outPort->logMessage(m));
+                }
+            }
+            logger->logState(time, modelIds[i], atomic.getId(), atomic.logState());
+        }
+
+        // Process the event at the given time
+        void advance(double time)
+        {
+            if (logger)
+            {
+                logger->lock();
+                logger->logTime(time);
+                logger->unlock();
+            }
+            active.clear();
+            epoch++;
+
+            // Outputs of the imminent models
+            schedule.forEachDue(time, [this](std::size_t i)
+                                { active.push_back(i);
+                                  mark[i] = epoch; });
+            std::size_t imminent = active.size();
+            for (std::size_t k = 0; k < imminent; k++)
+            {
+                atomics[active[k]]->output();
+            }
+
+            // Route only the ports that carry messages
+            for (std::size_t k = 0; k < imminent; k++)
+            {
+                for (const Route &route : routes[active[k]])
+                {
+                    if (!route.from->empty())
+                    {
+                        route.to->propagate(route.from);
+                        if (mark[route.receiver] != epoch)
+                        {
+                            mark[route.receiver] = epoch;
+                            active.push_back(route.receiver);
+                        }
+                    }
+                }
+            }
+
+            // Transitions, in component order like Cadmium
+            std::sort(active.begin(), active.end());
+            events++;
+            transitions += active.size();
+            for (std::size_t i : active)
+            {
+                AtomicInterface &atomic = *atomics[i];
+                if (atomic.inEmpty())
+                {
+                    atomic.internalTransition();
+                }
+                else if (schedule.key(i) <= time)
+                {
+                    atomic.confluentTransition(time - lastTransition[i]);
+                }
+                else
+                {
+                    atomic.externalTransition(time - lastTransition[i]);
+                }
+                if (logger)
+                {
+                    logger->lock();
+                    logTransition(i, time);
+                    logger->unlock();
+                }
+                lastTransition[i] = time;
+                schedule.update(i, time + atomic.timeAdvance());
+            }
+            for (std::size_t i : active)
+            {
+                atomics[i]->clearPorts();
+            }
+            timeLast = time;
+        }
+
+    public:
+        HeapRootCoordinator(std::shared_ptr<Coupled> model, C clock, double time)
+            : model(std::move(model)), clock(clock), logger(), timeLast(time), epoch(0), events(0), transitions(0)
+        {
+            Links links;
+            flatten(*this->model, 1, links);
+
+            std::unordered_map<const Component *, std::size_t> index;
+            schedule.reserve(atomics.size());
+            for (std::size_t i = 0; i < atomics.size(); i++)
+            {
+                index[atomics[i].get()] = i;
+                schedule.push(time + atomics[i]->timeAdvance());
+            }
+            routes.resize(atomics.size());
+            for (std::size_t i = 0; i < atomics.size(); i++)
+            {
+                for (const auto &outPort : atomics[i]->getOutPorts())
+                {
+                    resolve(i, outPort, outPort.get(), links, index);
+                }
+            }
+            lastTransition.assign(atomics.size(), time);
+            mark.assign(atomics.size(), 0);
+            active.reserve(atomics.size());
+        }
+
+        HeapRootCoordinator(std::shared_ptr<Coupled> model, C clock) : HeapRootCoordinator(std::move(model), clock, 0) {}
+
+        explicit HeapRootCoordinator(std::shared_ptr<Coupled> model) : HeapRootCoordinator(std::move(model), C(), 0) {}
+
+        template <typename L, typename... Args>
+        void setLogger(Args &&...args)
+        {
+            logger = std::make_shared<L>(std::forward<Args>(args)...);
+        }
+
+        void start()
+        {
+            clock.start(timeLast);
+            if (logger)
+            {
+                logger->start();
+                for (std::size_t i = 0; i < atomics.size(); i++)
+                {
+                    logger->logState(timeLast, modelIds[i], atomics[i]->getId(), atomics[i]->logState());
+                }
+            }
+        }
+
+        void stop()
+        {
+            if (logger)
+            {
+                logger->stop();
+            }
+            clock.stop(timeLast);
+        }
+
+        // Run until timeInterval seconds of simulated time have elapsed
+        void simulate(double timeInterval)
+        {
+            double timeFinal = timeLast + timeInterval;
+            for (double timeNext = schedule.topKey(); timeNext < timeFinal; timeNext = schedule.topKey())
+            {
+                advance(clock.waitUntil(timeNext));
+            }
+        }
+
+        // Run at most nIterations events
+        void simulate(long nIterations)
+        {
+            for (double timeNext = schedule.topKey(); nIterations-- > 0 && timeNext < std::numeric_limits<double>::infinity(); timeNext = schedule.topKey())
+            {
+                advance(clock.waitUntil(timeNext));
+            }
+        }
+
+        [[nodiscard]] double getTimeLast() const { return timeLast; }
+        [[nodiscard]] double getTimeNext() const { return schedule.topKey(); }
+        [[nodiscard]] std::size_t size() const { return atomics.size(); }
+        [[nodiscard]] unsigned long getEventCount() const { return events; }
+        [[nodiscard]] unsigned long getTransitionCount() const { return transitions; }
+    };
+
+} // namespace cadmium
+
+#endif // RT_HEAP_COORDINATOR_HPP
@@ -0,0 +1,210 @@
+/**
+ * Record of the hardware reads, for bit-exact replay on the host.
+ *
+ * Every value the models read from the hardware goes through HwTrace: ADC
+ * samples (HwTrace::adc), GPIO levels (HwTrace::pin) and DHT11 frames
+ * (HwTrace::dht). With DEVS_HW_RECORD each read is also stored, with its TIM2
+ * tick, as an 8-byte HwRecord in a RAM ring; otherwise the calls compile to
+ * the bare value.
+ *
+ * HwRecordingClock<C> decorates the real-time clock and drains the ring as
+ * "hw;<tick>;<kind>;<channel>;<value>" lines just before the core waits for
+ * the next event, so the text output uses idle time; recording an event costs
+ * one critical section and one 8-byte store.
+ *
+ * On the host, hw_replay (host/tools) feeds the recorded values back through
+ * the HAL stand-in, in the same order per channel, and prints the output log,
+ * which then matches the log of the recorded run line for line.
+ */
+
+#ifndef RT_HW_TRACE_HPP
+#define RT_HW_TRACE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include "profiler.hpp"
+
+extern "C"
+{
+#include "stm32h7xx_hal.h"
+#include "DHT_11/DHT.h"
+#include "tim.h"
+}
+
+#if defined(DEVS_HW_RECORD) && !defined(__arm__)
+#include <mutex>
+#endif
+
+#ifndef HW_TRACE_CAPACITY
+#define HW_TRACE_CAPACITY 1024 // Records (8 bytes each); a power of two
+#endif
+
+namespace cadmium
+{
+
+    // Kind of hardware read
+    enum class HwRead : uint8_t
+    {
+        Adc = 1,            // channel = rank in the conversion sequence
+        Gpio = 2,           // channel = port index * 16 + pin number
+        DhtHumidity = 3,    // value = RHI << 8 | RHD
+        DhtTemperature = 4, // value = TCI << 8 | TCD
+        DhtCheck = 5        // value = SUM << 8 | valid
+    };
+
+    // One recorded read
+    struct HwRecord
+    {
+        uint32_t tick; // TIM2 counter at the read (µs on the board)
+        uint8_t kind;  // HwRead
+        uint8_t channel;
+        uint16_t value;
+    };
+
+    static_assert(sizeof(HwRecord) == 8, "HwRecord is packed in 8 bytes");
+    static_assert((HW_TRACE_CAPACITY & (HW_TRACE_CAPACITY - 1)) == 0, "HW_TRACE_CAPACITY must be a power of two");
+
+    // Channel of a GPIO pin: port index (GPIOA = 0) * 16 + pin number, 0xFF for other ports
+    inline uint8_t hwPinChannel(const GPIO_TypeDef *port, uint16_t pin)
+    {
+        GPIO_TypeDef *const ports[] = {GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOF, GPIOG};
+        for (uint8_t i = 0; i < sizeof(ports) / sizeof(ports[0]); i++)
+        {
+            if (ports[i] == port)
+            {
+                return static_cast<uint8_t>(i * 16 + __builtin_ctz(pin));
+            }
+        }
+        return 0xFF;
+    }
+
+    class HwTrace
+    {
+    public:
+        // ADC sample of the given rank
+        static uint16_t adc(uint8_t rank, uint16_t value)
+        {
+            record(HwRead::Adc, rank, value);
+            return value;
+        }
+
+        // Level of a GPIO input pin
+        static GPIO_PinState pin(const GPIO_TypeDef *port, uint16_t pin, GPIO_PinState level)
+        {
+            record(HwRead::Gpio, hwPinChannel(port, pin), static_cast<uint16_t>(level));
+            return level;
+        }
+
+        // DHT11 frame as returned by DHT11_ReadFrame()
+        static void dht(const DHT11_Frame &frame)
+        {
+            record(HwRead::DhtHumidity, 0, static_cast<uint16_t>(frame.RHI << 8 | frame.RHD));
+            record(HwRead::DhtTemperature, 0, static_cast<uint16_t>(frame.TCI << 8 | frame.TCD));
+            record(HwRead::DhtCheck, 0, static_cast<uint16_t>(frame.SUM << 8 | frame.valid));
+        }
+
+        // Print and release the records not yet drained; reports overflows as "hw;dropped;<count>"
+        static void drain(void (*sink)(const char *line))
+        {
+#ifdef DEVS_HW_RECORD
+            char line[48];
+            for (;;)
+            {
+                HwRecord r;
+                {
+                    Lock lock;
+                    if (tail == head)
+                    {
+                        break;
+                    }
+                    r = ring[tail & (HW_TRACE_CAPACITY - 1)];
+                    tail++;
+                }
+                std::snprintf(line, sizeof(line), "hw;%lu;%u;%u;%u\n", (unsigned long)r.tick, r.kind, r.channel, r.value);
+                sink(line);
+            }
+            if (dropped != reported)
+            {
+                std::snprintf(line, sizeof(line), "hw;dropped;%lu\n", (unsigned long)dropped);
+                sink(line);
+                reported = dropped;
+            }
+#else
+            (void)sink;
+#endif
+        }
+
+    private:
+#ifdef DEVS_HW_RECORD
+        static inline HwRecord ring[HW_TRACE_CAPACITY] = {};
+        static inline uint32_t head = 0;    // Records written
+        static inline uint32_t tail = 0;    // Records drained
+        static inline uint32_t dropped = 0; // Records lost because the ring was full
+        static inline uint32_t reported = 0;
+
+        // Reads may come from the coordinator and from the RTOS worker threads
+#if defined(__arm__)
+        struct Lock
+        {
+            uint32_t primask = __get_PRIMASK();
+            Lock() { __disable_irq(); }
+            ~Lock() { __set_PRIMASK(primask); }
+        };
+#else
+        static inline std::mutex mutex;
+        struct Lock
+        {
+            std::lock_guard<std::mutex> guard{mutex};
+        };
+#endif
+#endif
+
+        static void record(HwRead kind, uint8_t channel, uint16_t value)
+        {
+#ifdef DEVS_HW_RECORD
+            HwRecord r = {static_cast<uint32_t>(__HAL_TIM_GET_COUNTER(&htim2)), static_cast<uint8_t>(kind), channel, value};
+            Lock lock;
+            if (head - tail == HW_TRACE_CAPACITY)
+            {
+                dropped++;
+                return;
+            }
+            ring[head & (HW_TRACE_CAPACITY - 1)] = r;
+            head++;
+#else
+            (void)kind;
+            (void)channel;
+            (void)value;
+#endif
+        }
+    };
+
+    /**
+     * HwRecordingClock<C>: real-time clock C that drains the hardware-read
+     * trace to stdout before waiting for each event.
+     */
+    template <class C>
+    class HwRecordingClock : public C
+    {
+    public:
+        template <typename... Args>
+        explicit HwRecordingClock(Args &&...args) : C(std::forward<Args>(args)...)
+        {
+        }
+
+        void stop(double timeLast)
+        {
+            HwTrace::drain(profilerStdoutSink);
+            C::stop(timeLast);
+        }
+
+        double waitUntil(double timeNext)
+        {
+            HwTrace::drain(profilerStdoutSink);
+            return C::waitUntil(timeNext);
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_HW_TRACE_HPP
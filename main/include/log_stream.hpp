@@ -0,0 +1,183 @@
+/**
+ * Log stream ring with backpressure.
+ *
+ * LogStream<Bytes> buffers the text output (simulation log, reports) for a
+ * packet link such as the USB CDC channel (usb_cdc.hpp). The producer appends
+ * whole lines; the link takes up to LOG_STREAM_PACKET bytes at a time straight
+ * from the ring (pending/release), so a packet is sent from where the line was
+ * written, without another copy.
+ *
+ * When the link does not keep up the ring fills, and lines are thinned
+ * rather than the producer being blocked:
+ *  - above the downsampling threshold only one simulation log line in
+ *    keepOneIn is kept (lines starting with a digit, "<time>;<model>;...");
+ *    report lines (profiler;, telemetry;, hw;...) are always kept,
+ *  - a line that does not fit is dropped.
+ * Once the ring has drained below half the threshold, the counts are written
+ * to the stream as "stream;dropped;<lines>;downsampled;<lines>".
+ *
+ * One producer and one consumer: head is only written by write(), tail only
+ * by release(), so each side can run in its own context (thread and USB
+ * interrupt).
+ */
+
+#ifndef RT_LOG_STREAM_HPP
+#define RT_LOG_STREAM_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+
+namespace cadmium
+{
+
+    constexpr uint32_t LOG_STREAM_PACKET = 512;     // Bytes handed to the link at once
+    constexpr uint32_t LOG_STREAM_LINE_RESERVE = 160; // Room a line needs to be started
+
+    // Thinning of the simulation log lines under backpressure
+    struct LogStreamPolicy
+    {
+        uint32_t downsampleAbove; // Fill level (bytes) from which lines are downsampled
+        uint32_t keepOneIn;       // Simulation log lines kept while downsampling
+    };
+
+    template <uint32_t Bytes>
+    class LogStream
+    {
+        static_assert((Bytes & (Bytes - 1)) == 0, "the ring size must be a power of two");
+        static_assert(Bytes >= 2 * LOG_STREAM_PACKET, "the ring must hold two packets");
+
+        uint8_t ring[Bytes];
+        std::atomic<uint32_t> head; // Bytes written
+        std::atomic<uint32_t> tail; // Bytes released by the link
+        LogStreamPolicy policy;
+
+        bool inLine;      // In the middle of a line
+        bool keepLine;    // The current line is kept
+        uint32_t skipped; // Simulation log lines seen while downsampling
+
+        uint32_t dropped;     // Lines lost because the ring was full
+        uint32_t downsampled; // Lines thinned out by the policy
+        uint32_t reported;    // dropped + downsampled already written to the stream
+        uint32_t peak;        // Highest fill level
+
+    public:
+        // Downsampling from half full, one simulation log line in 4 kept
+        LogStream() : LogStream(LogStreamPolicy{Bytes / 2, 4})
+        {
+        }
+
+        explicit LogStream(LogStreamPolicy thinning)
+            : ring{}, head(0), tail(0), policy(thinning), inLine(false), keepLine(true), skipped(0),
+              dropped(0), downsampled(0), reported(0), peak(0)
+        {
+        }
+
+        /**
+         * Append text; lines are kept or dropped as a whole (a kept line
+         * that outgrows the ring is cut). Returns len: the producer never
+         * blocks.
+         */
+        uint32_t write(const char *data, uint32_t len)
+        {
+            uint32_t h = head.load(std::memory_order_relaxed);
+            for (uint32_t i = 0; i < len; i++)
+            {
+                char c = data[i];
+                if (!inLine)
+                {
+                    h = startLine(h, c);
+                    inLine = true;
+                }
+                if (keepLine)
+                {
+                    if (h - tail.load(std::memory_order_acquire) < Bytes)
+                    {
+                        ring[h++ & (Bytes - 1)] = static_cast<uint8_t>(c);
+                    }
+                    else
+                    {
+                        keepLine = false;
+                        dropped++;
+                    }
+                }
+                if (c == '\n')
+                {
+                    inLine = false;
+                }
+            }
+            head.store(h, std::memory_order_release);
+            uint32_t fill = h - tail.load(std::memory_order_relaxed);
+            peak = fill > peak ? fill : peak;
+            return len;
+        }
+
+        /**
+         * Contiguous bytes ready for the link, at most LOG_STREAM_PACKET.
+         * Without flush only a full packet is returned, so that short lines
+         * are batched; returns nullptr when there is nothing to send.
+         */
+        const uint8_t *pending(uint32_t &len, bool flush) const
+        {
+            uint32_t t = tail.load(std::memory_order_relaxed);
+            uint32_t ready = head.load(std::memory_order_acquire) - t;
+            uint32_t contiguous = Bytes - (t & (Bytes - 1));
+            len = ready < contiguous ? ready : contiguous;
+            len = len < LOG_STREAM_PACKET ? len : LOG_STREAM_PACKET;
+            if (len == 0 || (!flush && len < LOG_STREAM_PACKET && ready < LOG_STREAM_PACKET))
+            {
+                len = 0;
+                return nullptr;
+            }
+            return &ring[t & (Bytes - 1)];
+        }
+
+        // Give back the len bytes returned by pending() once they are sent
+        void release(uint32_t len)
+        {
+            tail.store(tail.load(std::memory_order_relaxed) + len, std::memory_order_release);
+        }
+
+        [[nodiscard]] uint32_t fill() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+        [[nodiscard]] uint32_t droppedLines() const { return dropped; }
+        [[nodiscard]] uint32_t downsampledLines() const { return downsampled; }
+        [[nodiscard]] uint32_t peakFill() const { return peak; }
+
+    private:
+        // Decide whether the line starting with c is kept; may first insert the loss report
+        uint32_t startLine(uint32_t h, char c)
+        {
+            uint32_t fill = h - tail.load(std::memory_order_acquire);
+            if (dropped + downsampled != reported && fill < policy.downsampleAbove / 2)
+            {
+                char line[64];
+                int n = std::snprintf(line, sizeof(line), "stream;dropped;%lu;downsampled;%lu\n", (unsigned long)dropped, (unsigned long)downsampled);
+                for (int k = 0; k < n; k++)
+                {
+                    ring[h++ & (Bytes - 1)] = static_cast<uint8_t>(line[k]);
+                }
+                reported = dropped + downsampled;
+                fill += static_cast<uint32_t>(n);
+            }
+
+            keepLine = Bytes - fill >= LOG_STREAM_LINE_RESERVE;
+            if (!keepLine)
+            {
+                dropped++;
+            }
+            else if (c >= '0' && c <= '9' && fill >= policy.downsampleAbove)
+            {
+                keepLine = skipped++ % policy.keepOneIn == 0;
+                downsampled += keepLine ? 0 : 1;
+            }
+            else
+            {
+                skipped = 0;
+            }
+            return h;
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_LOG_STREAM_HPP
@@ -5,6 +5,7 @@
 #include "stm32h7xx_hal_gpio.h"
 #include "stm32h7xx_hal_rcc.h"
 #include "stm32h743xx.h"
+#include "boot_sequencer.hpp"
 
 namespace cadmium
 {
@@ -15,7 +16,7 @@ namespace cadmium
         bool output;  // Current output value (true = HIGH, false = LOW)
         double sigma; // Time until next internal transition (unused here)
 
-        explicit DigitalOutputState() : output(true), sigma(0) {}
+        explicit constexpr DigitalOutputState() : output(true), sigma(0) {}
     };
 
     // Optional stream operator for debugging (empty here)
@@ -43,13 +44,13 @@ namespace cadmium
          * @param selectedPort - GPIO port where the output pin is connected
          * @param selectedPins - GPIO pin initialization parameters
          */
-        DigitalOutput(const std::string &id, GPIO_TypeDef *selectedPort, GPIO_InitTypeDef *selectedPins)
+        DigitalOutput(const std::string &id, GPIO_TypeDef *selectedPort, const GPIO_InitTypeDef *selectedPins)
             : Atomic<DigitalOutputState>(id, DigitalOutputState()), port(selectedPort), pins(*selectedPins)
         {
             in = addInPort<bool>("in");
 
-            // Initialize GPIO pin with STM32 HAL
-            HAL_GPIO_Init(port, &pins);
+            // Queue the pin configuration; written with the other pins by BootSequencer::commit()
+            BootSequencer::requestPin(port, pins);
         }
 
         /**
@@ -0,0 +1,292 @@
+/**
+ * Per-model transition profiler.
+ *
+ * Wrapping an atomic model in Profiled<> measures every call to its internal,
+ * external and confluent transitions and to its output function. Samples are
+ * taken from the Cortex-M7 DWT cycle counter on the board and from std::chrono
+ * (nanoseconds) on the host, and are accumulated in a static table that can be
+ * dumped at the end of the simulation.
+ *
+ * Profiling is compiled in only when DEVS_PROFILING (or DEVS_DEADLINE_MONITOR,
+ * which reuses the table for per-model deadline misses) is defined; otherwise
+ * Profiled<M> is an alias of M and costs nothing.
+ */
+
+#ifndef RT_PROFILER_HPP
+#define RT_PROFILER_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "cadmium/modeling/devs/atomic.hpp"
+#include "wrapped_model.hpp"
+
+#if defined(__arm__)
+extern "C"
+{
+#include "stm32h7xx.h"
+}
+#else
+#include <chrono>
+#endif
+
+namespace cadmium
+{
+
+    constexpr std::size_t PROFILER_MAX_MODELS = 16;  // Rows in the profile table (last row collects overflow)
+    constexpr std::size_t PROFILER_BUCKETS = 20;     // Number of log2 histogram buckets
+    constexpr std::size_t PROFILER_BUCKET_SHIFT = 6; // Bucket 0 holds every sample below 2^(SHIFT+1)
+
+    /**
+     * Free-running time stamp source used by the profiler.
+     * Target: DWT->CYCCNT (core clock cycles). Host: steady_clock nanoseconds.
+     */
+    struct CycleCounter
+    {
+        // Start the counter (idempotent)
+        static void enable()
+        {
+#if defined(__arm__)
+            if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+            {
+                CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+                DWT->LAR = 0xC5ACCE55; // Unlock DWT access on the Cortex-M7
+                DWT->CYCCNT = 0;
+                DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+            }
+#endif
+        }
+
+        // Current counter value; differences are valid across one 32-bit wrap
+        static uint32_t now()
+        {
+#if defined(__arm__)
+            return DWT->CYCCNT;
+#else
+            using namespace std::chrono;
+            return static_cast<uint32_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        // Unit of the values returned by now()
+        static const char *unit()
+        {
+#if defined(__arm__)
+            return "cyc";
+#else
+            return "ns";
+#endif
+        }
+    };
+
+    // Running statistics for one kind of transition of one model
+    struct TransitionStats
+    {
+        uint32_t count;                      // Number of samples
+        uint32_t min;                        // Shortest sample
+        uint32_t max;                        // Longest sample
+        uint64_t total;                      // Sum of all samples (for the mean)
+        uint32_t histogram[PROFILER_BUCKETS]; // log2 buckets, see bucketOf()
+
+        // Index of the histogram bucket a sample falls in
+        static std::size_t bucketOf(uint32_t sample)
+        {
+            std::size_t log2 = sample ? 31 - __builtin_clz(sample) : 0;
+            std::size_t bucket = log2 > PROFILER_BUCKET_SHIFT ? log2 - PROFILER_BUCKET_SHIFT : 0;
+            return bucket < PROFILER_BUCKETS ? bucket : PROFILER_BUCKETS - 1;
+        }
+
+        void record(uint32_t sample)
+        {
+            if (count == 0 || sample < min)
+            {
+                min = sample;
+            }
+            if (sample > max)
+            {
+                max = sample;
+            }
+            count++;
+            total += sample;
+            histogram[bucketOf(sample)]++;
+        }
+
+        [[nodiscard]] uint32_t mean() const
+        {
+            return count ? static_cast<uint32_t>(total / count) : 0;
+        }
+    };
+
+    // Profile row of one atomic model
+    struct ModelProfile
+    {
+        char id[24];               // Model id (truncated)
+        TransitionStats internal;  // internalTransition()
+        TransitionStats external;  // externalTransition()
+        TransitionStats confluent; // confluentTransition()
+        TransitionStats output;    // output()
+        uint32_t missedDeadlines;  // Scheduled transitions run late (see deadline_monitor.hpp)
+    };
+
+    /**
+     * Static table of model profiles. Rows are handed out at construction time
+     * by Profiled<> and never freed, so no allocation happens while simulating.
+     */
+    class Profiler
+    {
+    public:
+        // Reserve a row for the model with the given id
+        static ModelProfile *registerModel(const std::string &id)
+        {
+            CycleCounter::enable();
+            ModelProfile *row = &table[used < PROFILER_MAX_MODELS - 1 ? used++ : PROFILER_MAX_MODELS - 1];
+            if (row->id[0] == '\0')
+            {
+                std::strncpy(row->id, row == &table[PROFILER_MAX_MODELS - 1] ? "(overflow)" : id.c_str(), sizeof(row->id) - 1);
+            }
+            return row;
+        }
+
+        // Clear all samples but keep the registered rows
+        static void reset()
+        {
+            for (std::size_t i = 0; i < PROFILER_MAX_MODELS; i++)
+            {
+                ModelProfile &row = table[i];
+                row.internal = row.external = row.confluent = row.output = TransitionStats{};
+                row.missedDeadlines = 0;
+            }
+        }
+
+        // Registered rows, for reports built on top of the profile table
+        static const ModelProfile *rows(std::size_t &count)
+        {
+            count = used;
+            return table;
+        }
+
+        // Set by the deadline monitor while the current event runs behind schedule
+        static inline bool eventLate = false;
+
+        /**
+         * Format the table line by line and hand every line to the sink.
+         * Columns: model, transition, count, min, mean, max, then the non-empty
+         * histogram buckets as "b<index>:<count>" (bucket b covers [2^(b+SHIFT), 2^(b+SHIFT+1))).
+         */
+        static void report(void (*sink)(const char *line))
+        {
+            char line[160];
+            std::snprintf(line, sizeof(line), "model;transition;count;min_%s;mean_%s;max_%s;histogram\n",
+                          CycleCounter::unit(), CycleCounter::unit(), CycleCounter::unit());
+            sink(line);
+            for (std::size_t i = 0; i < PROFILER_MAX_MODELS; i++)
+            {
+                const ModelProfile &row = table[i];
+                reportRow(sink, row.id, "internal", row.internal);
+                reportRow(sink, row.id, "external", row.external);
+                reportRow(sink, row.id, "confluent", row.confluent);
+                reportRow(sink, row.id, "output", row.output);
+            }
+        }
+
+    private:
+        static inline ModelProfile table[PROFILER_MAX_MODELS] = {};
+        static inline std::size_t used = 0;
+
+        static void reportRow(void (*sink)(const char *), const char *id, const char *kind, const TransitionStats &stats)
+        {
+            if (stats.count == 0)
+            {
+                return;
+            }
+            char line[160];
+            int n = std::snprintf(line, sizeof(line), "%s;%s;%lu;%lu;%lu;%lu;", id, kind,
+                                  (unsigned long)stats.count, (unsigned long)stats.min,
+                                  (unsigned long)stats.mean(), (unsigned long)stats.max);
+            for (std::size_t b = 0; b < PROFILER_BUCKETS && n > 0 && n < (int)sizeof(line) - 16; b++)
+            {
+                if (stats.histogram[b])
+                {
+                    n += std::snprintf(line + n, sizeof(line) - n, " b%u:%lu", (unsigned)b, (unsigned long)stats.histogram[b]);
+                }
+            }
+            sink(line);
+            sink("\n");
+        }
+    };
+
+    // Report sink writing through stdio (same path as the STDOUT logger)
+    inline void profilerStdoutSink(const char *line)
+    {
+        std::fputs(line, stdout);
+    }
+
+#if defined(__arm__)
+    // Report sink writing to the SWO trace port (ITM stimulus port 0)
+    inline void profilerSwoSink(const char *line)
+    {
+        while (*line)
+        {
+            ITM_SendChar(static_cast<uint32_t>(*line++));
+        }
+    }
+#endif
+
+#if defined(DEVS_PROFILING) || defined(DEVS_DEADLINE_MONITOR)
+    /**
+     * Profiled<M>: drop-in replacement for the atomic model M that times every
+     * transition and output call. Constructor arguments are forwarded to M.
+     */
+    template <class M>
+    class Profiled : public M
+    {
+        ModelProfile *profile; // Row of this model in the profile table
+
+    public:
+        template <typename... Args>
+        explicit Profiled(Args &&...args)
+            : M(std::forward<Args>(args)...), profile(Profiler::registerModel(this->getId()))
+        {
+        }
+
+        void internalTransition() override
+        {
+            profile->missedDeadlines += Profiler::eventLate;
+            uint32_t start = CycleCounter::now();
+            WrappedModel<M>::internalTransition(*this);
+            profile->internal.record(CycleCounter::now() - start);
+        }
+
+        void externalTransition(double e) override
+        {
+            uint32_t start = CycleCounter::now();
+            WrappedModel<M>::externalTransition(*this, e);
+            profile->external.record(CycleCounter::now() - start);
+        }
+
+        void confluentTransition(double e) override
+        {
+            profile->missedDeadlines += Profiler::eventLate;
+            uint32_t start = CycleCounter::now();
+            WrappedModel<M>::confluentTransition(*this, e);
+            profile->confluent.record(CycleCounter::now() - start);
+        }
+
+        void output() override
+        {
+            uint32_t start = CycleCounter::now();
+            WrappedModel<M>::output(*this);
+            profile->output.record(CycleCounter::now() - start);
+        }
+    };
+#else
+    template <class M>
+    using Profiled = M;
+#endif
+
+} // namespace cadmium
+
+#endif // RT_PROFILER_HPP
@@ -18,7 +18,7 @@ namespace cadmium
         double output; // Current PWM duty cycle [0.0, 1.0]
         double sigma;  // Time until next internal event (unused here)
 
-        explicit PWMOutputState() : output(0.0), sigma(1.0) {}
+        explicit constexpr PWMOutputState() : output(0.0), sigma(1.0) {}
     };
 
     // Stream output operator for debugging the PWM duty cycle
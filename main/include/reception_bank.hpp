@@ -0,0 +1,116 @@
+/**
+ * Bank of CO2 classifiers.
+ *
+ * ReceptionBank<N> classifies the CO2 readings of N rooms or sensors against
+ * the bands of ReceptionConfig, like N Reception models (CO2reception.hpp),
+ * as one VectorAtomic (vector_atomic.hpp): readings arrive as Lane<float>,
+ * all lanes are classified in one pass every 0.1 s, and the lanes whose band
+ * changed leave as Lane<uint8_t> (0 good, 1 average, 2 bad).
+ *
+ * The classification is branchless, band = (ppm >= average) + (ppm >= bad),
+ * which matches Reception as long as the average threshold is below the bad
+ * one.
+ */
+
+#ifndef RT_RECEPTION_BANK_HPP
+#define RT_RECEPTION_BANK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "vector_atomic.hpp"
+#include "CO2reception.hpp"
+
+namespace cadmium
+{
+
+    constexpr uint8_t CO2_BAND_NONE = 0xFF; // Lane not classified yet
+
+    // Lanes of the bank, one array per field
+    template <std::size_t N>
+    struct ReceptionBankState
+    {
+        float input[N];  // Last CO2 value of each lane (ppm)
+        uint8_t band[N]; // Band computed at the last step
+        uint8_t sent[N]; // Band sent by the last output
+        double sigma;    // Time until the next step
+
+        ReceptionBankState() : input{}, sigma(0)
+        {
+            std::memset(band, CO2_BAND_NONE, sizeof(band));
+            std::memset(sent, CO2_BAND_NONE, sizeof(sent));
+        }
+    };
+
+    // Logs the number of lanes in each band
+    template <std::size_t N>
+    inline std::ostream &operator<<(std::ostream &out, const ReceptionBankState<N> &state)
+    {
+        std::size_t count[3] = {};
+        for (std::size_t i = 0; i < N; i++)
+        {
+            if (state.band[i] < 3)
+            {
+                count[state.band[i]]++;
+            }
+        }
+        out << "good: " << count[0] << ", average: " << count[1] << ", bad: " << count[2];
+        return out;
+    }
+
+    /**
+     * Batch kernel: band of n readings. Straight-line loop over contiguous
+     * arrays, vectorised by the compiler (SSE/AVX/NEON on the host, unrolled
+     * on the Cortex-M7).
+     */
+    inline void classifyCo2Bands(const float *__restrict ppm, uint8_t *__restrict band, std::size_t n, float average, float bad)
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            band[i] = static_cast<uint8_t>((ppm[i] >= average) + (ppm[i] >= bad));
+        }
+    }
+
+    template <std::size_t N>
+    class ReceptionBank : public VectorAtomic<ReceptionBank<N>, ReceptionBankState<N>, float, uint8_t>
+    {
+        using Base = VectorAtomic<ReceptionBank<N>, ReceptionBankState<N>, float, uint8_t>;
+
+    public:
+        ReceptionConfig config; // CO2 bands, shared by every lane
+
+        ReceptionBank(const std::string &id, const ReceptionConfig &bands = ReceptionConfig(), double period = 0.1)
+            : Base(id, ReceptionBankState<N>(), period), config(bands)
+        {
+        }
+
+        void accept(ReceptionBankState<N> &state, uint32_t lane, float ppm) const
+        {
+            if (lane < N)
+            {
+                state.input[lane] = ppm;
+            }
+        }
+
+        // The bands just output become the reference, then every lane is classified again
+        void step(ReceptionBankState<N> &state) const
+        {
+            std::memcpy(state.sent, state.band, N);
+            classifyCo2Bands(state.input, state.band, N, config.averageThreshold, config.badThreshold);
+        }
+
+        void emit(const ReceptionBankState<N> &state, const Port<Lane<uint8_t>> &out) const
+        {
+            for (uint32_t i = 0; i < N; i++)
+            {
+                if (state.band[i] != state.sent[i])
+                {
+                    out->addMessage({i, state.band[i]});
+                }
+            }
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_RECEPTION_BANK_HPP
@@ -0,0 +1,251 @@
+/**
+ * Room coupled model.
+ *
+ * Everything one room needs (CO2 input and its three LEDs, motion input and
+ * LED, DHT11 and servo chain) as a coupled model parameterised by a Config
+ * class and by the pins of the room, so that the same model can be built once
+ * for the lab (top.hpp) or N times on one MCU (building.hpp).
+ *
+ * Config provides:
+ *  - static constexpr bool sharedScan: the CO2 input comes from a shared
+ *    AdcScanner through the scan port (true) or from an AnalogInput polling
+ *    its own ADC (false),
+ *  - static RoomHardware hardware(std::size_t index): pins of room index.
+ */
+
+#ifndef RT_ROOM_HPP
+#define RT_ROOM_HPP
+
+#include "cadmium/modeling/devs/coupled.hpp"
+#include "Digitalinput.hpp"
+#include "Digitalout_good.hpp"
+#include "Digitalout_bad.hpp"
+#include "Digitalout_avrege.hpp"
+#include "motionout.hpp"
+#include "CO2polling.hpp"
+#include "CO2reception.hpp"
+#include "temperature.hpp"
+#include "generator.hpp"
+#include "controller.hpp"
+#include "pwmoutput.hpp"
+#include "adc_scan.hpp"
+#include "profiler.hpp"
+#include "checkpoint.hpp"
+#include "change_only.hpp"
+
+namespace cadmium
+{
+
+    // Pins and peripherals of one room
+    struct RoomHardware
+    {
+        GPIO_TypeDef *goodPort; // CO2 LEDs
+        GPIO_InitTypeDef good;
+        GPIO_TypeDef *averagePort;
+        GPIO_InitTypeDef average;
+        GPIO_TypeDef *badPort;
+        GPIO_InitTypeDef bad;
+
+        GPIO_TypeDef *motionPort; // Motion sensor input
+        GPIO_InitTypeDef motion;
+        GPIO_TypeDef *motionLedPort; // Motion LED
+        GPIO_InitTypeDef motionLed;
+
+        GPIO_TypeDef *dhtPort; // DHT11 data line
+        uint16_t dhtPin;
+
+        TIM_HandleTypeDef *servoTimer; // Servo PWM
+        uint32_t servoChannel;
+        GPIO_TypeDef *servoPort; // Servo pin, nullptr when configured by CubeMX (TIM4 CH1)
+        GPIO_InitTypeDef servo;
+
+        ADC_HandleTypeDef *co2Adc; // CO2 sensor: ADC polled by AnalogInput (sharedScan = false)
+        GPIO_TypeDef *co2Port;
+        std::size_t co2Rank; // CO2 sensor: rank in the shared scan (sharedScan = true)
+    };
+
+    // Tunable parameters of one room, passed to its models at construction
+    struct RoomParameters
+    {
+        ReceptionConfig co2;
+        TemperatureSensorConfig temperature;
+        ServoCommandConfig servo;
+        RoomSampling sampling; // Sampling periods of the polled models (adaptive_sampling.hpp)
+        ChangeOnlyConfig outputs; // Messages of the sensor and command models sent on change only (change_only.hpp)
+    };
+
+    template <class Config>
+    struct room_coupled : public Coupled
+    {
+        // Frames of the shared AdcScanner (only coupled when Config::sharedScan)
+        Port<ScanFrame> scan;
+#ifdef DEVS_TELEMETRY
+        // Signals sampled by the telemetry recorder (telemetry.hpp)
+        Port<float> ppm;
+        Port<float> celsius;
+        Port<double> duty;
+        Port<bool> occupied;
+#endif
+
+        room_coupled(const std::string &id, const RoomHardware &hw, const RoomParameters &params = RoomParameters()) : Coupled(id)
+        {
+            // CO2 and motion LEDs
+            auto digitaloutputgood = addComponent<Profiled<DigitalOutputgood>>("digitaloutputgood", hw.goodPort, &hw.good);
+            auto digitaloutputavrege = addComponent<Profiled<DigitalOutputavrege>>("digitaloutputavrege", hw.averagePort, &hw.average);
+            auto digitaloutputbad = addComponent<Profiled<DigitalOutputbad>>("digitaloutputbad", hw.badPort, &hw.bad);
+            auto motionoutput = addComponent<Profiled<DigitalOutput>>("motionoutput", hw.motionLedPort, &hw.motionLed);
+
+            // CO2 input: own polled ADC or one rank of the shared scan
+            std::shared_ptr<ChangeOnly<Profiled<Persistent<AnalogInput>>>> polledinput;
+            std::shared_ptr<ChangeOnly<Profiled<Persistent<ScanChannelInput>>>> scaninput;
+            if constexpr (Config::sharedScan)
+            {
+                scan = addInPort<ScanFrame>("scan");
+                scaninput = addComponent<ChangeOnly<Profiled<Persistent<ScanChannelInput>>>>("analogueinout", hw.co2Rank);
+                scaninput->configure(params.outputs);
+                scaninput->deadband(scaninput->out, params.outputs.ppmDeadband);
+            }
+            else
+            {
+                polledinput = addComponent<ChangeOnly<Profiled<Persistent<AnalogInput>>>>("analogueinout", hw.co2Port, hw.co2Adc, params.sampling.co2);
+                polledinput->configure(params.outputs);
+                polledinput->deadband(polledinput->out, params.outputs.ppmDeadband);
+            }
+
+            auto motion = addComponent<ChangeOnly<Profiled<DigitalInput>>>("motion", hw.motionPort, &hw.motion, params.sampling.motion);
+            auto reception = addComponent<ChangeOnly<Profiled<Reception>>>("reception", params.co2, params.sampling.classifier);
+
+            // Temperature and servo chain
+            auto temp = addComponent<ChangeOnly<Profiled<TemperatureSensorInput>>>("Temp", hw.dhtPort, hw.dhtPin, params.temperature,
+                                                                                   params.sampling.temperature);
+            auto generator = addComponent<ChangeOnly<Profiled<Persistent<ServoCommandGenerator>>>>("ServocommandState", params.servo);
+            auto controller = addComponent<ChangeOnly<Profiled<ServoController>>>("ServoCOntroller");
+
+            // Sensor and command models send their values on change only (change_only.hpp)
+            motion->configure(params.outputs);
+            reception->configure(params.outputs);
+            temp->configure(params.outputs);
+            generator->configure(params.outputs);
+            controller->configure(params.outputs);
+            auto pwm = addComponent<Profiled<PWMOutput>>("servoPWM", hw.servoTimer, hw.servoChannel, __HAL_TIM_GET_AUTORELOAD(hw.servoTimer));
+            if (hw.servoPort != nullptr)
+            {
+                BootSequencer::requestPin(hw.servoPort, hw.servo);
+            }
+
+            // Couplings
+            if constexpr (Config::sharedScan)
+            {
+                addCoupling(scan, scaninput->in);
+                addCoupling(scaninput->out, reception->in);
+            }
+            else
+            {
+                addCoupling(polledinput->out, reception->in);
+            }
+            addCoupling(reception->out_good, digitaloutputgood->in);
+            addCoupling(reception->out_avrege, digitaloutputavrege->in);
+            addCoupling(reception->out_bad, digitaloutputbad->in);
+            addCoupling(temp->out, generator->in);
+            addCoupling(generator->out, controller->in);
+            addCoupling(controller->out, pwm->in);
+            addCoupling(motion->out, motionoutput->in);
+
+            // Occupancy shortens the longest sampling periods; fixed policies leave the inputs uncoupled
+            if constexpr (!Config::sharedScan)
+            {
+                if (params.sampling.co2.adaptive())
+                {
+                    addCoupling(motion->out, polledinput->occupied);
+                }
+            }
+            if (params.sampling.temperature.adaptive())
+            {
+                addCoupling(motion->out, temp->occupied);
+            }
+
+#ifdef DEVS_TELEMETRY
+            ppm = addOutPort<float>("ppm");
+            celsius = addOutPort<float>("celsius");
+            duty = addOutPort<double>("duty");
+            occupied = addOutPort<bool>("occupied");
+            if constexpr (Config::sharedScan)
+            {
+                addCoupling(scaninput->out, ppm);
+            }
+            else
+            {
+                addCoupling(polledinput->out, ppm);
+            }
+            addCoupling(temp->celsius, celsius);
+            addCoupling(controller->out, duty);
+            addCoupling(motion->out, occupied);
+#endif
+        }
+    };
+
+    // The lab room: one room with its CO2 sensor on its own ADC (PA0) and the servo on TIM4 CH1
+    struct LabRoom
+    {
+        static constexpr bool sharedScan = false;
+
+        static RoomHardware hardware(std::size_t)
+        {
+            // GPIO configurations for output LEDs and input pins
+            static constexpr GPIO_InitTypeDef led_config_good = {
+                .Pin = GPIO_PIN_0,
+                .Mode = GPIO_MODE_OUTPUT_PP,
+                .Pull = GPIO_NOPULL,
+                .Speed = GPIO_SPEED_FREQ_LOW,
+                .Alternate = 0};
+            static constexpr GPIO_InitTypeDef led_config_avrege = {
+                .Pin = GPIO_PIN_1,
+                .Mode = GPIO_MODE_OUTPUT_PP,
+                .Pull = GPIO_NOPULL,
+                .Speed = GPIO_SPEED_FREQ_LOW,
+                .Alternate = 0};
+            static constexpr GPIO_InitTypeDef led_config_bad = {
+                .Pin = GPIO_PIN_14,
+                .Mode = GPIO_MODE_OUTPUT_PP,
+                .Pull = GPIO_NOPULL,
+                .Speed = GPIO_SPEED_FREQ_LOW,
+                .Alternate = 0};
+
+            static constexpr GPIO_InitTypeDef led_config_input = {
+                .Pin = GPIO_PIN_0,
+                .Mode = GPIO_MODE_INPUT,
+                .Pull = GPIO_NOPULL,
+                .Speed = GPIO_SPEED_FREQ_LOW,
+                .Alternate = 0};
+
+            static constexpr GPIO_InitTypeDef led_config_motion = {
+                .Pin = GPIO_PIN_1,
+                .Mode = GPIO_MODE_OUTPUT_PP,
+                .Pull = GPIO_NOPULL,
+                .Speed = GPIO_SPEED_FREQ_LOW,
+                .Alternate = 0};
+
+            RoomHardware hw = {};
+            hw.goodPort = GPIOB;
+            hw.good = led_config_good;
+            hw.averagePort = GPIOE;
+            hw.average = led_config_avrege;
+            hw.badPort = GPIOB;
+            hw.bad = led_config_bad;
+            hw.motionPort = GPIOE;
+            hw.motion = led_config_input;
+            hw.motionLedPort = GPIOG;
+            hw.motionLed = led_config_motion;
+            hw.dhtPort = DHT11_PORT;
+            hw.dhtPin = DHT11_PIN;
+            hw.servoTimer = &htim4;
+            hw.servoChannel = TIM_CHANNEL_1;
+            hw.co2Adc = &hadc1;
+            hw.co2Port = GPIOA;
+            return hw;
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_ROOM_HPP
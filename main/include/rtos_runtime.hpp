@@ -0,0 +1,334 @@
+/**
+ * CMSIS-RTOS2 runtime mode (DEVS_RTOS_RUNTIME).
+ *
+ * The coordinator runs in its own thread and sleeps between events instead of
+ * busy-waiting. The blocking drivers (ADC conversion, DHT11 bit-banging and the
+ * log output) run in lower-priority worker threads and exchange data with the
+ * models through message queues.
+ *
+ * DEVS semantics are kept at the model boundary: a sensor model requests a
+ * reading in one internal transition and consumes it in the next one, so the
+ * value seen by the model always has a fixed one-period latency and is part of
+ * the model state. The worker only decides *when* the hardware is touched.
+ *
+ * On the board an RTOS2 kernel (e.g. RTX5) must be linked in; on the host the
+ * POSIX stand-in from host/src/cmsis_os2_posix.cpp provides the same API.
+ */
+
+#ifndef RT_RTOS_RUNTIME_HPP
+#define RT_RTOS_RUNTIME_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "cadmium/simulation/logger/logger.hpp"
+
+extern "C"
+{
+#include "cmsis_os2.h"
+#include "stm32h7xx_hal.h"
+#include "DHT_11/DHT.h"
+}
+#include "hw_trace.hpp"
+
+namespace cadmium
+{
+
+    constexpr uint32_t RTOS_ADC_TIMEOUT_TICKS = 25;   // Wait for an ADC result that is still in flight
+    constexpr uint32_t RTOS_DHT11_TIMEOUT_TICKS = 30; // Wait for a DHT11 frame that is still in flight
+    constexpr uint32_t RTOS_LOG_QUEUE_DEPTH = 32;     // Log lines buffered before dropping
+    constexpr std::size_t RTOS_LOG_LINE_SIZE = 96;    // Bytes per queued log line
+
+    /**
+     * DriverWorker<T>: one thread running a blocking driver on request.
+     * Requests and results travel through two single-slot message queues.
+     */
+    template <typename T>
+    class DriverWorker
+    {
+    public:
+        using Driver = T (*)(void *arg);
+
+        // Create the thread and its queues
+        void start(const char *name, Driver driver, void *arg, uint32_t stackSize, osPriority_t priority)
+        {
+            fn = driver;
+            fnArg = arg;
+            requests = osMessageQueueNew(1, sizeof(uint8_t), nullptr);
+            results = osMessageQueueNew(1, sizeof(T), nullptr);
+            osThreadAttr_t attr = {};
+            attr.name = name;
+            attr.stack_size = stackSize;
+            attr.priority = priority;
+            osThreadNew(run, this, &attr);
+        }
+
+        /**
+         * Collect the result of the previous request (waiting at most timeout
+         * ticks) and issue the next request. Returns false and leaves value
+         * untouched when no fresh result is available; a request still in
+         * flight is not duplicated.
+         */
+        bool exchange(T &value, uint32_t timeout)
+        {
+            bool fresh = false;
+            if (pending)
+            {
+                fresh = osMessageQueueGet(results, &value, nullptr, timeout) == osOK;
+                if (!fresh)
+                {
+                    stale++;
+                    return false;
+                }
+            }
+            uint8_t token = 0;
+            pending = osMessageQueuePut(requests, &token, 0, 0) == osOK;
+            return fresh;
+        }
+
+        [[nodiscard]] uint32_t staleCount() const { return stale; }
+
+    private:
+        Driver fn = nullptr;
+        void *fnArg = nullptr;
+        osMessageQueueId_t requests = nullptr;
+        osMessageQueueId_t results = nullptr;
+        bool pending = false; // A request was issued and its result not yet collected
+        uint32_t stale = 0;   // Transitions that found no fresh result
+
+        static void run(void *self)
+        {
+            auto *worker = static_cast<DriverWorker *>(self);
+            for (;;)
+            {
+                uint8_t token;
+                osMessageQueueGet(worker->requests, &token, nullptr, osWaitForever);
+                T value = worker->fn(worker->fnArg);
+                osMessageQueuePut(worker->results, &value, 0, osWaitForever);
+            }
+        }
+    };
+
+    // Fixed-size log line carried by the log queue
+    struct LogLine
+    {
+        char text[RTOS_LOG_LINE_SIZE];
+    };
+
+    /**
+     * Log sink thread: lines are formatted by the coordinator and written to
+     * stdout by a low-priority thread. Lines are dropped (and counted) when the
+     * queue is full so logging never blocks the simulation. flush() is the
+     * only blocking call, for the end of the run.
+     */
+    class LogWorker
+    {
+    public:
+        void start(uint32_t stackSize, osPriority_t priority)
+        {
+            lines = osMessageQueueNew(RTOS_LOG_QUEUE_DEPTH, sizeof(LogLine), nullptr);
+            flushed = osMessageQueueNew(1, sizeof(uint8_t), nullptr);
+            osThreadAttr_t attr = {};
+            attr.name = "log";
+            attr.stack_size = stackSize;
+            attr.priority = priority;
+            osThreadNew(run, this, &attr);
+        }
+
+        void post(const LogLine &line)
+        {
+            if (osMessageQueuePut(lines, &line, 0, 0) != osOK)
+            {
+                dropped++;
+            }
+        }
+
+        /**
+         * Wait until every line queued so far is written: an empty line is
+         * queued behind them as a marker and the worker acknowledges it once
+         * stdout is flushed.
+         */
+        void flush()
+        {
+            if (lines == nullptr)
+            {
+                return;
+            }
+            LogLine marker;
+            marker.text[0] = '\0';
+            osMessageQueuePut(lines, &marker, 0, osWaitForever);
+            uint8_t token;
+            osMessageQueueGet(flushed, &token, nullptr, osWaitForever);
+        }
+
+        [[nodiscard]] uint32_t droppedCount() const { return dropped; }
+
+    private:
+        osMessageQueueId_t lines = nullptr;
+        osMessageQueueId_t flushed = nullptr; // Acknowledges the flush() marker
+        uint32_t dropped = 0;
+
+        static void run(void *self)
+        {
+            auto *worker = static_cast<LogWorker *>(self);
+            for (;;)
+            {
+                LogLine line;
+                osMessageQueueGet(worker->lines, &line, nullptr, osWaitForever);
+                if (line.text[0] == '\0')
+                {
+                    std::fflush(stdout);
+                    uint8_t token = 0;
+                    osMessageQueuePut(worker->flushed, &token, 0, osWaitForever);
+                    continue;
+                }
+                std::fputs(line.text, stdout);
+            }
+        }
+    };
+
+    // ADC driver run by the ADC worker: one blocking conversion
+    inline uint16_t rtosAdcDriver(void *handle)
+    {
+        auto *adc = static_cast<ADC_HandleTypeDef *>(handle);
+        HAL_ADC_Start(adc);
+        HAL_ADC_PollForConversion(adc, 20);
+        return HwTrace::adc(0, static_cast<uint16_t>(HAL_ADC_GetValue(adc)));
+    }
+
+    /**
+     * DHT11 driver run by the DHT11 worker. The 20 ms start pulse sleeps so
+     * other threads can run; the timed handshake and bit reads run with the
+     * scheduler locked (about 4 ms) so the bit timing is not disturbed.
+     */
+    inline DHT11_Frame rtosDht11Driver(void *)
+    {
+        DHT11_Frame frame = {};
+        DHT11_PullLow();
+        osDelay(20);
+        int32_t lock = osKernelLock();
+        DHT11_ReadFrame(&frame);
+        osKernelRestoreLock(lock);
+        HwTrace::dht(frame);
+        return frame;
+    }
+
+    /**
+     * Worker threads shared by the models when DEVS_RTOS_RUNTIME is defined.
+     * Call start() after osKernelInitialize() and before osKernelStart().
+     */
+    class RtosRuntime
+    {
+    public:
+        static void start(ADC_HandleTypeDef *adc)
+        {
+            adcWorker.start("adc", rtosAdcDriver, adc, 512, osPriorityBelowNormal);
+            dht11Worker.start("dht11", rtosDht11Driver, nullptr, 512, osPriorityBelowNormal);
+            logWorker.start(1024, osPriorityLow);
+        }
+
+        // Start the coordinator thread; it is joinable so the host stand-in can wait for it
+        static osThreadId_t spawnCoordinator(osThreadFunc_t body, void *arg)
+        {
+            osThreadAttr_t attr = {};
+            attr.name = "coordinator";
+            attr.attr_bits = osThreadJoinable;
+            attr.stack_size = 8192;
+            attr.priority = osPriorityAboveNormal;
+            return osThreadNew(body, arg, &attr);
+        }
+
+        static DriverWorker<uint16_t> &adc() { return adcWorker; }
+        static DriverWorker<DHT11_Frame> &dht11() { return dht11Worker; }
+        static LogWorker &log() { return logWorker; }
+
+    private:
+        static inline DriverWorker<uint16_t> adcWorker;
+        static inline DriverWorker<DHT11_Frame> dht11Worker;
+        static inline LogWorker logWorker;
+    };
+
+    /**
+     * Real-time clock that sleeps on the RTOS tick instead of spinning on TIM2,
+     * so worker threads get the CPU between events. Resolution is one tick.
+     */
+    class RtosClock
+    {
+        double origin;      // Simulation time at start()
+        uint32_t startTick; // Kernel tick at start()
+
+    public:
+        RtosClock() : origin(0.0), startTick(0) {}
+
+        void start(double timeLast)
+        {
+            origin = timeLast;
+            startTick = osKernelGetTickCount();
+        }
+
+        void stop(double timeLast)
+        {
+            (void)timeLast;
+        }
+
+        double waitUntil(double timeNext)
+        {
+            uint32_t target = startTick + static_cast<uint32_t>((timeNext - origin) * osKernelGetTickFreq());
+            if (static_cast<int32_t>(target - osKernelGetTickCount()) > 0)
+            {
+                osDelayUntil(target);
+            }
+            return timeNext;
+        }
+    };
+
+    /**
+     * Logger with the STDOUTLogger format whose output is written by the log
+     * worker thread.
+     */
+    class QueuedLogger : public Logger
+    {
+        std::string sep;
+
+    public:
+        explicit QueuedLogger(std::string sep) : Logger(), sep(std::move(sep)) {}
+
+        void start() override
+        {
+            post("time" + sep + "model_id" + sep + "model_name" + sep + "port_name" + sep + "data");
+        }
+
+        // Lines still queued are written before the coordinator returns from stop()
+        void stop() override
+        {
+            RtosRuntime::log().flush();
+        }
+
+        void logOutput(double time, long modelId, const std::string &modelName, const std::string &portName, const std::string &output) override
+        {
+            LogLine line;
+            std::snprintf(line.text, sizeof(line.text), "%g%s%ld%s%s%s%s%s%s\n", time, sep.c_str(), modelId, sep.c_str(),
+                          modelName.c_str(), sep.c_str(), portName.c_str(), sep.c_str(), output.c_str());
+            RtosRuntime::log().post(line);
+        }
+
+        void logState(double time, long modelId, const std::string &modelName, const std::string &state) override
+        {
+            LogLine line;
+            std::snprintf(line.text, sizeof(line.text), "%g%s%ld%s%s%s%s%s\n", time, sep.c_str(), modelId, sep.c_str(),
+                          modelName.c_str(), sep.c_str(), sep.c_str(), state.c_str());
+            RtosRuntime::log().post(line);
+        }
+
+    private:
+        static void post(const std::string &text)
+        {
+            LogLine line;
+            std::snprintf(line.text, sizeof(line.text), "%s\n", text.c_str());
+            RtosRuntime::log().post(line);
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_RTOS_RUNTIME_HPP
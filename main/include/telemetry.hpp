@@ -0,0 +1,646 @@
+/**
+ * On-device telemetry store.
+ *
+ * TelemetryRecorder samples the room signals (CO2 ppm, temperature, servo duty
+ * cycle, motion) at a fixed period into TelemetryStore, one column per signal,
+ * kept in AXI SRAM (section .axisram, not zeroed by the startup code).
+ *
+ * Samples are grouped in blocks of TELEMETRY_BLOCK_SAMPLES:
+ *  - DeltaColumn quantises each value (fixed step per signal) and codes it as
+ *    the difference with the previous sample; runs of equal samples take one
+ *    byte per 64, small steps one byte. The coded bytes go to a byte ring that
+ *    drops the oldest blocks when full, so history length follows how much
+ *    the signal moves. The noisy CO2 column gets TELEMETRY_COLUMN_BYTES, the
+ *    steady temperature and duty cycle TELEMETRY_STEADY_COLUMN_BYTES.
+ *  - BitColumn packs booleans one bit per sample (one 64-bit word per block).
+ *
+ * Every block header keeps its first sample, where its tokens start and the
+ * running sum of everything before it. Block minima and maxima are the leaves
+ * of one min/max segment tree per column, updated when a block closes.
+ * summary(samples) covers exactly the last samples: the whole blocks inside
+ * the window come from the tree (O(log TELEMETRY_BLOCKS)) and the sums, and
+ * the block cut by the start of the window is decoded (at most 64 samples).
+ * Whole-block aggregates outlive the coded bytes and reach back
+ * TELEMETRY_BLOCKS - 1 blocks; when the cut block's samples were already
+ * dropped, the summary starts at the next block boundary instead and
+ * TelemetrySummary::samples says so.
+ *
+ * Footprint with the defaults: 16 KB for CO2 (4 KB headers, 4 KB tree, 8 KB
+ * coded bytes, about 4.5 h of raw samples), 10 KB for temperature and duty
+ * cycle each, 3 KB of motion bits: 39 KB per room, summaries over 9 h at 2 s.
+ */
+
+#ifndef RT_TELEMETRY_HPP
+#define RT_TELEMETRY_HPP
+
+#include <cadmium/modeling/devs/atomic.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+#ifndef TELEMETRY_BLOCKS
+#define TELEMETRY_BLOCKS 256 // Block headers per column, a power of two
+#endif
+#ifndef TELEMETRY_COLUMN_BYTES
+#define TELEMETRY_COLUMN_BYTES 8192 // Coded samples of the CO2 column, a power of two
+#endif
+#ifndef TELEMETRY_STEADY_COLUMN_BYTES
+#define TELEMETRY_STEADY_COLUMN_BYTES 2048 // Coded samples of the temperature and duty cycle columns, a power of two
+#endif
+
+#if defined(__arm__)
+#define TELEMETRY_SECTION __attribute__((section(".axisram")))
+#else
+#define TELEMETRY_SECTION
+#endif
+
+namespace cadmium
+{
+
+    constexpr uint32_t TELEMETRY_BLOCK_SAMPLES = 64;
+
+    static_assert((TELEMETRY_BLOCKS & (TELEMETRY_BLOCKS - 1)) == 0, "TELEMETRY_BLOCKS must be a power of two");
+    static_assert(TELEMETRY_BLOCKS >= 2, "summaries need at least one closed block besides the current one");
+
+    // Result of a query over the most recent samples
+    struct TelemetrySummary
+    {
+        uint32_t samples; // Samples covered: those asked for unless history is shorter (0: none recorded)
+        float min;
+        float max;
+        float mean;
+    };
+
+    /**
+     * Numeric column: quantised samples coded as deltas with run-length
+     * coding of repeated values.
+     *
+     * Tokens (one per sample unless noted):
+     *  00rrrrrr           r + 1 samples equal to the previous one
+     *  01zzzzzz           zigzag delta 1..63
+     *  10zzzzzz zzzzzzzz  zigzag delta up to 2^14 - 1
+     *  11000000 + 4 bytes absolute value (int32, little endian)
+     * The first sample of a block is kept in its header.
+     */
+    template <uint32_t Bytes>
+    class DeltaColumn
+    {
+        static_assert((Bytes & (Bytes - 1)) == 0, "the byte ring size must be a power of two");
+
+        struct Block
+        {
+            int32_t first;     // First sample (quantised)
+            uint32_t offset;   // Position of its first token in the byte ring
+            int64_t sumBefore; // Sum of every sample before the block
+        };
+
+        Block blocks[TELEMETRY_BLOCKS];
+        // Segment trees over the header slots: leaf TELEMETRY_BLOCKS + slot holds the block extremes, node i those of 2i and 2i + 1
+        int32_t minTree[2 * TELEMETRY_BLOCKS];
+        int32_t maxTree[2 * TELEMETRY_BLOCKS];
+        uint8_t bytes[Bytes];
+        int64_t total;        // Sum of every sample
+        float step;           // Value of one quantisation step
+        uint32_t count;       // Samples appended since reset
+        uint32_t head;        // Bytes written (position of the next token)
+        uint32_t tail;        // Position of the oldest byte still held
+        uint32_t oldestCoded; // First block whose tokens are still held
+        uint32_t runToken;    // Position of the last token if it is an open run, else head + 1
+        int32_t last;         // Previous sample (quantised)
+
+    public:
+        void reset(float quantum)
+        {
+            std::memset(this, 0, sizeof(*this));
+            step = quantum;
+            runToken = 1;
+        }
+
+        void append(float value)
+        {
+            int32_t q = quantise(value);
+            uint32_t index = count % TELEMETRY_BLOCK_SAMPLES;
+            uint32_t b = count / TELEMETRY_BLOCK_SAMPLES;
+            Block &block = blocks[b % TELEMETRY_BLOCKS];
+            uint32_t leaf = TELEMETRY_BLOCKS + b % TELEMETRY_BLOCKS;
+
+            if (index == 0)
+            {
+                if (b > 0)
+                {
+                    close((b - 1) % TELEMETRY_BLOCKS);
+                }
+                // The header slot being reused drops the tokens of its previous block
+                if (b >= TELEMETRY_BLOCKS && oldestCoded <= b - TELEMETRY_BLOCKS)
+                {
+                    oldestCoded = b - TELEMETRY_BLOCKS + 1;
+                    tail = oldestCoded < b ? blocks[oldestCoded % TELEMETRY_BLOCKS].offset : head;
+                }
+                block.first = q;
+                block.offset = head;
+                block.sumBefore = total;
+                minTree[leaf] = maxTree[leaf] = q;
+                runToken = head + 1;
+            }
+            else
+            {
+                encode(q - last, q);
+                minTree[leaf] = q < minTree[leaf] ? q : minTree[leaf];
+                maxTree[leaf] = q > maxTree[leaf] ? q : maxTree[leaf];
+            }
+            total += q;
+            last = q;
+            count++;
+        }
+
+        /**
+         * Min, max and mean of the last samples (all of them when fewer were
+         * recorded, at most TELEMETRY_BLOCKS - 1 whole blocks before the
+         * current one).
+         */
+        TelemetrySummary summary(uint32_t samples) const
+        {
+            if (count == 0 || samples == 0)
+            {
+                return {0, 0, 0, 0};
+            }
+            uint32_t current = (count - 1) / TELEMETRY_BLOCK_SAMPLES;
+            uint32_t oldest = current >= TELEMETRY_BLOCKS - 1 ? current - (TELEMETRY_BLOCKS - 1) : 0; // Oldest block summarised
+            uint32_t begin = samples < count ? count - samples : 0;
+            begin = begin > oldest * TELEMETRY_BLOCK_SAMPLES ? begin : oldest * TELEMETRY_BLOCK_SAMPLES;
+            uint32_t first = begin / TELEMETRY_BLOCK_SAMPLES;
+            uint32_t cut = begin % TELEMETRY_BLOCK_SAMPLES;
+            if (cut != 0 && first < oldestCoded)
+            {
+                first++; // The cut block's samples are gone: start at the next boundary
+                cut = 0;
+                begin = first * TELEMETRY_BLOCK_SAMPLES;
+            }
+
+            int32_t lo = std::numeric_limits<int32_t>::max();
+            int32_t hi = std::numeric_limits<int32_t>::min();
+            int64_t sum = total - blocks[first % TELEMETRY_BLOCKS].sumBefore;
+            uint32_t whole = first; // First block entirely inside the window
+            if (cut != 0)
+            {
+                decode(first, [&](uint32_t i, int32_t q)
+                       {
+                           if (i < cut)
+                           {
+                               sum -= q;
+                           }
+                           else
+                           {
+                               lo = std::min(lo, q);
+                               hi = std::max(hi, q);
+                           } });
+                whole++;
+            }
+            if (whole < current)
+            {
+                // Closed blocks [whole, current - 1], split in two where the header ring wraps
+                uint32_t from = whole % TELEMETRY_BLOCKS;
+                uint32_t to = (current - 1) % TELEMETRY_BLOCKS;
+                if (from <= to)
+                {
+                    extremes(from, to, lo, hi);
+                }
+                else
+                {
+                    extremes(from, TELEMETRY_BLOCKS - 1, lo, hi);
+                    extremes(0, to, lo, hi);
+                }
+            }
+            if (whole <= current)
+            {
+                lo = std::min(lo, minTree[TELEMETRY_BLOCKS + current % TELEMETRY_BLOCKS]);
+                hi = std::max(hi, maxTree[TELEMETRY_BLOCKS + current % TELEMETRY_BLOCKS]);
+            }
+            uint32_t covered = count - begin;
+            return {covered, lo * step, hi * step, static_cast<float>(static_cast<double>(sum) / covered) * step};
+        }
+
+        /**
+         * Decode the last samples still held (at most samples), oldest first,
+         * calling f(value) for each; returns the number decoded.
+         */
+        template <typename F>
+        uint32_t replay(uint32_t samples, F &&f) const
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+            uint32_t current = (count - 1) / TELEMETRY_BLOCK_SAMPLES;
+            uint32_t available = count - oldestCoded * TELEMETRY_BLOCK_SAMPLES;
+            samples = samples < available ? samples : available;
+            uint32_t skip = available - samples;
+            for (uint32_t b = oldestCoded; b <= current; b++)
+            {
+                decode(b, [&](uint32_t, int32_t q)
+                       {
+                           if (skip > 0)
+                           {
+                               skip--;
+                           }
+                           else
+                           {
+                               f(q * step);
+                           } });
+            }
+            return samples;
+        }
+
+        [[nodiscard]] uint32_t samples() const { return count; }
+
+        // Samples whose raw values are still held
+        [[nodiscard]] uint32_t heldSamples() const { return count - oldestCoded * TELEMETRY_BLOCK_SAMPLES; }
+
+        // Bytes of tokens held for heldSamples()
+        [[nodiscard]] uint32_t heldBytes() const { return head - tail; }
+
+    private:
+        // Call f(index, quantised sample) for each sample of block b, whose tokens must still be held
+        template <typename F>
+        void decode(uint32_t b, F &&f) const
+        {
+            const Block &block = blocks[b % TELEMETRY_BLOCKS];
+            uint32_t n = b == (count - 1) / TELEMETRY_BLOCK_SAMPLES ? count - b * TELEMETRY_BLOCK_SAMPLES : TELEMETRY_BLOCK_SAMPLES;
+            uint32_t pos = block.offset;
+            int32_t q = block.first;
+            uint32_t run = 0;
+            for (uint32_t i = 0; i < n; i++)
+            {
+                if (i > 0 && run == 0)
+                {
+                    uint8_t token = bytes[pos++ % Bytes];
+                    switch (token >> 6)
+                    {
+                    case 0:
+                        run = (token & 0x3F) + 1u;
+                        break;
+                    case 1:
+                        q += unzigzag(token & 0x3Fu);
+                        break;
+                    case 2:
+                        q += unzigzag((token & 0x3Fu) << 8 | bytes[pos++ % Bytes]);
+                        break;
+                    default:
+                    {
+                        uint32_t v = 0;
+                        for (int k = 0; k < 4; k++)
+                        {
+                            v |= static_cast<uint32_t>(bytes[pos++ % Bytes]) << (8 * k);
+                        }
+                        q = static_cast<int32_t>(v);
+                    }
+                    }
+                }
+                if (run > 0)
+                {
+                    run--; // Repeated sample: q unchanged
+                }
+                f(i, q);
+            }
+        }
+
+        int32_t quantise(float value) const
+        {
+            float q = std::nearbyint(value / step);
+            if (!(q > -2147483520.0f))
+            {
+                return std::numeric_limits<int32_t>::min() + 128; // Also NaN
+            }
+            return q < 2147483520.0f ? static_cast<int32_t>(q) : std::numeric_limits<int32_t>::max() - 128;
+        }
+
+        static uint32_t zigzag(int64_t delta)
+        {
+            return static_cast<uint32_t>(delta < 0 ? -2 * delta - 1 : 2 * delta);
+        }
+
+        static int32_t unzigzag(uint32_t z)
+        {
+            return (z & 1u) ? -static_cast<int32_t>((z + 1) >> 1) : static_cast<int32_t>(z >> 1);
+        }
+
+        void encode(int64_t delta, int32_t value)
+        {
+            if (delta == 0)
+            {
+                if (runToken == head - 1 && (bytes[runToken % Bytes] & 0x3F) < 0x3F)
+                {
+                    bytes[runToken % Bytes]++;
+                    return;
+                }
+                reserve(1);
+                runToken = head;
+                put(0x00);
+                return;
+            }
+            uint32_t z = delta >= -(1 << 13) && delta < (1 << 13) ? zigzag(delta) : 0xFFFFFFFFu;
+            if (z < 0x40)
+            {
+                reserve(1);
+                put(static_cast<uint8_t>(0x40 | z));
+            }
+            else if (z < 0x4000)
+            {
+                reserve(2);
+                put(static_cast<uint8_t>(0x80 | z >> 8));
+                put(static_cast<uint8_t>(z));
+            }
+            else
+            {
+                reserve(5);
+                put(0xC0);
+                for (int k = 0; k < 4; k++)
+                {
+                    put(static_cast<uint8_t>(static_cast<uint32_t>(value) >> (8 * k)));
+                }
+            }
+            runToken = head + 1;
+        }
+
+        // Drop the oldest coded blocks until n more bytes fit
+        void reserve(uint32_t n)
+        {
+            uint32_t current = count / TELEMETRY_BLOCK_SAMPLES;
+            while (head + n - tail > Bytes && oldestCoded < current)
+            {
+                oldestCoded++;
+                tail = blocks[oldestCoded % TELEMETRY_BLOCKS].offset;
+            }
+        }
+
+        void put(uint8_t byte)
+        {
+            bytes[head++ % Bytes] = byte;
+        }
+
+        // Carry the extremes of a completed block (header slot) up the trees
+        void close(uint32_t slot)
+        {
+            for (uint32_t node = (TELEMETRY_BLOCKS + slot) / 2; node > 0; node /= 2)
+            {
+                minTree[node] = std::min(minTree[2 * node], minTree[2 * node + 1]);
+                maxTree[node] = std::max(maxTree[2 * node], maxTree[2 * node + 1]);
+            }
+        }
+
+        /**
+         * Fold the extremes of header slots [from, to] into lo and hi. Only
+         * nodes lying wholly inside the range are read, so the open block's
+         * slot, whose ancestors are stale until it closes, must not be in it.
+         */
+        void extremes(uint32_t from, uint32_t to, int32_t &lo, int32_t &hi) const
+        {
+            for (uint32_t l = TELEMETRY_BLOCKS + from, r = TELEMETRY_BLOCKS + to + 1; l < r; l /= 2, r /= 2)
+            {
+                if (l & 1u)
+                {
+                    lo = std::min(lo, minTree[l]);
+                    hi = std::max(hi, maxTree[l]);
+                    l++;
+                }
+                if (r & 1u)
+                {
+                    r--;
+                    lo = std::min(lo, minTree[r]);
+                    hi = std::max(hi, maxTree[r]);
+                }
+            }
+        }
+    };
+
+    // Boolean column: one bit per sample, count of ones per block
+    class BitColumn
+    {
+        uint64_t bits[TELEMETRY_BLOCKS];
+        uint32_t onesBefore[TELEMETRY_BLOCKS]; // Ones recorded before each block (modulo 2^32)
+        uint32_t count;
+
+    public:
+        void reset()
+        {
+            std::memset(this, 0, sizeof(*this));
+        }
+
+        void append(bool value)
+        {
+            uint32_t index = count % TELEMETRY_BLOCK_SAMPLES;
+            uint32_t b = count / TELEMETRY_BLOCK_SAMPLES;
+            if (index == 0)
+            {
+                uint32_t previous = (b + TELEMETRY_BLOCKS - 1) % TELEMETRY_BLOCKS;
+                onesBefore[b % TELEMETRY_BLOCKS] = b > 0 ? onesBefore[previous] + static_cast<uint32_t>(__builtin_popcountll(bits[previous])) : 0;
+                bits[b % TELEMETRY_BLOCKS] = 0;
+            }
+            bits[b % TELEMETRY_BLOCKS] |= static_cast<uint64_t>(value) << index;
+            count++;
+        }
+
+        // Share of true samples (mean), any (max) and all (min) over the last samples, like DeltaColumn::summary
+        TelemetrySummary summary(uint32_t samples) const
+        {
+            if (count == 0 || samples == 0)
+            {
+                return {0, 0, 0, 0};
+            }
+            uint32_t current = (count - 1) / TELEMETRY_BLOCK_SAMPLES;
+            uint32_t oldest = current >= TELEMETRY_BLOCKS - 1 ? current - (TELEMETRY_BLOCKS - 1) : 0;
+            uint32_t begin = samples < count ? count - samples : 0;
+            begin = begin > oldest * TELEMETRY_BLOCK_SAMPLES ? begin : oldest * TELEMETRY_BLOCK_SAMPLES;
+
+            // Ones before begin: those of the earlier blocks, then the bits of its block below it
+            uint32_t first = begin / TELEMETRY_BLOCK_SAMPLES;
+            uint64_t below = (uint64_t{1} << (begin % TELEMETRY_BLOCK_SAMPLES)) - 1;
+            uint32_t onesBeforeBegin = onesBefore[first % TELEMETRY_BLOCKS] +
+                                       static_cast<uint32_t>(__builtin_popcountll(bits[first % TELEMETRY_BLOCKS] & below));
+            uint32_t ones = onesBefore[current % TELEMETRY_BLOCKS] + static_cast<uint32_t>(__builtin_popcountll(bits[current % TELEMETRY_BLOCKS])) -
+                            onesBeforeBegin;
+            uint32_t covered = count - begin;
+            return {covered, ones == covered ? 1.0f : 0.0f, ones > 0 ? 1.0f : 0.0f, static_cast<float>(ones) / covered};
+        }
+
+        [[nodiscard]] uint32_t samples() const { return count; }
+    };
+
+    /**
+     * Columns of one room. Trivially constructible so that it can live in a
+     * section the startup code does not initialise: call reset() first.
+     */
+    struct TelemetryStore
+    {
+        DeltaColumn<TELEMETRY_COLUMN_BYTES> ppm;                // CO2 (1 ppm steps)
+        DeltaColumn<TELEMETRY_STEADY_COLUMN_BYTES> temperature; // DHT11 temperature (0.1 °C steps)
+        DeltaColumn<TELEMETRY_STEADY_COLUMN_BYTES> duty;        // Servo duty cycle (0.1 % steps)
+        BitColumn motion;                                       // PIR level
+        double period;                                          // Time between two samples (s)
+
+        void reset(double samplePeriod)
+        {
+            ppm.reset(1.0f);
+            temperature.reset(0.1f);
+            duty.reset(0.001f);
+            motion.reset();
+            period = samplePeriod;
+        }
+
+        void append(float co2, float celsius, double dutyCycle, bool occupied)
+        {
+            ppm.append(co2);
+            temperature.append(celsius);
+            duty.append(static_cast<float>(dutyCycle));
+            motion.append(occupied);
+        }
+
+        // Samples covering the last seconds
+        [[nodiscard]] uint32_t samplesIn(double seconds) const
+        {
+            return static_cast<uint32_t>(std::ceil(seconds / period));
+        }
+
+        /**
+         * One line per signal and window,
+         * "telemetry;<signal>;<window_s>;<samples>;<min>;<max>;<mean>", then
+         * "telemetry;held;<signal>;<raw_samples>;<bytes>" per numeric column.
+         */
+        void report(void (*sink)(const char *line), const double *windows, std::size_t count) const
+        {
+            sink("telemetry;signal;window_s;samples;min;max;mean\n");
+            for (std::size_t w = 0; w < count; w++)
+            {
+                uint32_t n = samplesIn(windows[w]);
+                reportRow(sink, "ppm", windows[w], ppm.summary(n));
+                reportRow(sink, "temperature", windows[w], temperature.summary(n));
+                reportRow(sink, "duty", windows[w], duty.summary(n));
+                reportRow(sink, "motion", windows[w], motion.summary(n));
+            }
+            reportHeld(sink, "ppm", ppm);
+            reportHeld(sink, "temperature", temperature);
+            reportHeld(sink, "duty", duty);
+        }
+
+    private:
+        static void reportRow(void (*sink)(const char *), const char *signal, double window, const TelemetrySummary &s)
+        {
+            char line[128];
+            std::snprintf(line, sizeof(line), "telemetry;%s;%.0f;%lu;%.3f;%.3f;%.3f\n", signal, window, (unsigned long)s.samples,
+                          (double)s.min, (double)s.max, (double)s.mean);
+            sink(line);
+        }
+
+        template <uint32_t Bytes>
+        static void reportHeld(void (*sink)(const char *), const char *signal, const DeltaColumn<Bytes> &column)
+        {
+            char line[96];
+            std::snprintf(line, sizeof(line), "telemetry;held;%s;%lu;%lu\n", signal, (unsigned long)column.heldSamples(),
+                          (unsigned long)column.heldBytes());
+            sink(line);
+        }
+    };
+
+    // Store of the lab room
+    inline TelemetryStore telemetryStore TELEMETRY_SECTION;
+
+    // State of the TelemetryRecorder model: last value received on each port
+    struct TelemetryRecorderState
+    {
+        double sigma; // Time until the next sample
+        float ppm;
+        float celsius;
+        double duty;
+        bool motion;
+        uint32_t samples; // Samples recorded
+
+        constexpr TelemetryRecorderState() : sigma(0.0), ppm(0.0f), celsius(0.0f), duty(0.0), motion(false), samples(0) {}
+    };
+
+    inline std::ostream &operator<<(std::ostream &out, const TelemetryRecorderState &state)
+    {
+        out << "Samples: " << state.samples;
+        return out;
+    }
+
+    /**
+     * TelemetryRecorder: holds the last value of each input and appends one
+     * sample of all of them to a TelemetryStore every period.
+     */
+    class TelemetryRecorder : public Atomic<TelemetryRecorderState>
+    {
+    public:
+        Port<float> ppm;     // CO2 from the analog input
+        Port<float> celsius; // Temperature from the DHT11 model
+        Port<double> duty;   // Duty cycle from the servo controller
+        Port<bool> motion;   // Level from the motion input
+
+        TelemetryStore *store;
+        double period;
+
+        /**
+         * Constructor: resets store
+         * @param id - Unique model identifier
+         * @param columns - Store receiving the samples
+         * @param samplePeriod - Time between two samples (s)
+         */
+        TelemetryRecorder(const std::string &id, TelemetryStore *columns, double samplePeriod = 2.0)
+            : Atomic<TelemetryRecorderState>(id, TelemetryRecorderState()), store(columns), period(samplePeriod)
+        {
+            ppm = addInPort<float>("ppm");
+            celsius = addInPort<float>("celsius");
+            duty = addInPort<double>("duty");
+            motion = addInPort<bool>("motion");
+            store->reset(period);
+            state.sigma = period;
+        }
+
+        // Internal transition: record one sample
+        void internalTransition(TelemetryRecorderState &state) const override
+        {
+            store->append(state.ppm, state.celsius, state.duty, state.motion);
+            state.samples++;
+            state.sigma = period;
+        }
+
+        // External transition: keep the latest values, sampling stays on its period
+        void externalTransition(TelemetryRecorderState &state, double e) const override
+        {
+            if (!ppm->empty())
+            {
+                state.ppm = ppm->getBag().back();
+            }
+            if (!celsius->empty())
+            {
+                state.celsius = celsius->getBag().back();
+            }
+            if (!duty->empty())
+            {
+                state.duty = duty->getBag().back();
+            }
+            if (!motion->empty())
+            {
+                state.motion = motion->getBag().back();
+            }
+            state.sigma -= e;
+        }
+
+        // Output function: no output port
+        void output(const TelemetryRecorderState &state) const override
+        {
+            (void)state;
+        }
+
+        [[nodiscard]] double timeAdvance(const TelemetryRecorderState &state) const override
+        {
+            return state.sigma;
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_TELEMETRY_HPP
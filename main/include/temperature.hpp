@@ -11,6 +11,11 @@ extern "C"
 #include "DHT_11/DHT.h"
 #include "tim.h"
 }
+#include "hw_trace.hpp"
+#include "adaptive_sampling.hpp"
+#ifdef DEVS_RTOS_RUNTIME
+#include "rtos_runtime.hpp"
+#endif
 
 #ifndef NO_LOGGING
 #include <iostream>
@@ -30,8 +35,16 @@ namespace cadmium
         double sigma;          // Time until next internal transition
         float Temperature;     // Current temperature value read from sensor
         float lastTemperature; // Last temperature value (not used currently)
+        SamplingTracker rate;  // Polling period
+        bool occupied;         // Room occupied (motion input), shortens the longest period
+
+        constexpr TemperatureSensorInputState() : output(false), sigma(0.0), Temperature(100), rate{}, occupied(false) {}
+    };
 
-        TemperatureSensorInputState() : output(false), sigma(0.0), Temperature(100) {}
+    // Trigger of the TemperatureSensorInput model
+    struct TemperatureSensorConfig
+    {
+        float threshold = 25.0f; // Output is true above this temperature (°C)
     };
 
     // Stream operator for debug/logging: outputs the current temperature
@@ -44,17 +57,34 @@ namespace cadmium
     /**
      * TemperatureSensorInput: DEVS atomic model for reading temperature from a DHT11 sensor.
      * It periodically reads sensor data, validates checksum, updates temperature,
-     * and outputs a boolean signal indicating if temperature is above 25°C.
+     * and outputs a boolean signal indicating if temperature is above the
+     * configured threshold (25°C by default).
      */
     class TemperatureSensorInput : public Atomic<TemperatureSensorInputState>
     {
     public:
-        Port<bool> out; // Output port sending true if temperature > 25°C, else false
+        Port<bool> out;      // Output port sending true if temperature > threshold, else false
+        Port<bool> occupied; // Motion input, coupled only with an adaptive sampling policy
+#ifdef DEVS_TELEMETRY
+        Port<float> celsius; // Last temperature read, for the telemetry recorder
+#endif
+
+        GPIO_TypeDef *port; // DHT11 data line
+        uint16_t pin;
+        TemperatureSensorConfig config;
+        SamplingPolicy sampling; // Polling period (adaptive_sampling.hpp)
 
-        TemperatureSensorInput(const std::string &id)
-            : Atomic<TemperatureSensorInputState>(id, TemperatureSensorInputState())
+        TemperatureSensorInput(const std::string &id, GPIO_TypeDef *dhtPort = DHT11_PORT, uint16_t dhtPin = DHT11_PIN,
+                               const TemperatureSensorConfig &trigger = TemperatureSensorConfig(),
+                               const SamplingPolicy &policy = SamplingPolicy::fixed(2.0))
+            : Atomic<TemperatureSensorInputState>(id, TemperatureSensorInputState()), port(dhtPort), pin(dhtPin), config(trigger),
+              sampling(policy)
         {
             out = addOutPort<bool>("out");
+            occupied = addInPort<bool>("occupied");
+#ifdef DEVS_TELEMETRY
+            celsius = addOutPort<float>("celsius");
+#endif
         }
 
         /**
@@ -64,54 +94,52 @@ namespace cadmium
          */
         void internalTransition(TemperatureSensorInputState &state) const override
         {
-            uint8_t RHI, RHD, TCI, TCD, SUM;
-            float tCelsius = 0.0f;
+            DHT11_Frame frame = {};
+
+#ifdef DEVS_RTOS_RUNTIME
+            // Collect the frame requested at the previous transition (read by the DHT11 worker thread);
+            // keep the last temperature while the first frame is still in flight
+            bool fresh = RtosRuntime::dht11().exchange(frame, RTOS_DHT11_TIMEOUT_TICKS);
+#else
+            // Start pulse, then handshake, 5 bytes and checksum check
+            DHT11_Select(port, pin);
+            DHT11_PullLow();
+            milliDelay(20);
+            DHT11_ReadFrame(&frame);
+            HwTrace::dht(frame);
+            bool fresh = true;
+#endif
 
-            // Start communication with DHT11 sensor
-            if (DHT11_Start())
+            if (fresh)
             {
-                // Read humidity integer and decimal parts (unused here but read for checksum)
-                RHI = DHT11_Read();
-                RHD = DHT11_Read();
-                // Read temperature integer and decimal parts
-                TCI = DHT11_Read();
-                TCD = DHT11_Read();
-                // Read checksum
-                SUM = DHT11_Read();
-
-                // Verify checksum to confirm data validity
-                if ((uint8_t)(RHI + RHD + TCI + TCD) == SUM)
-                {
-                    // Calculate temperature in Celsius
-                    tCelsius = TCI + (TCD / 10.0f);
-                    state.Temperature = tCelsius;
-                }
-                else
-                {
-                    // Checksum error: assign error value
-                    state.Temperature = 100;
-                }
-            }
-            else
-            {
-                // Sensor start failure: assign error value
-                state.Temperature = 100;
+                // Calculate temperature in Celsius, or assign the error value on start/checksum failure
+                state.Temperature = frame.valid ? frame.TCI + (frame.TCD / 10.0f) : 100;
             }
 
-            // Update output boolean: true if temperature > 25°C, false otherwise
-            state.output = (state.Temperature > 25);
+            // Update output boolean: true if temperature > threshold, false otherwise
+            state.output = (state.Temperature > config.threshold);
 
-            // Set next transition time to 2 seconds (polling interval)
-            state.sigma = 2.0;
+            // Set next transition time to 2 seconds (polling interval), or as the sampling policy says
+            state.sigma = state.rate.next(state.Temperature, state.rate.sinceSample + state.sigma, state.occupied, sampling);
         }
 
         /**
-         * External transition: no external inputs handled here.
+         * External transition: occupancy from the motion input. Entering
+         * an occupied room brings the next reading within the occupied cap.
          */
         void externalTransition(TemperatureSensorInputState &state, double e) const override
         {
-            (void)state;
-            (void)e;
+            state.sigma -= e;
+            state.rate.sinceSample += e;
+            bool was = state.occupied;
+            for (const auto value : occupied->getBag())
+            {
+                state.occupied = value;
+            }
+            if (state.occupied && !was)
+            {
+                state.sigma = state.rate.occupiedRemaining(state.sigma, sampling);
+            }
         }
 
         /**
@@ -120,6 +148,9 @@ namespace cadmium
         void output(const TemperatureSensorInputState &state) const override
         {
             out->addMessage(state.output);
+#ifdef DEVS_TELEMETRY
+            celsius->addMessage(state.Temperature);
+#endif
         }
 
         /**
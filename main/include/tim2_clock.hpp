@@ -0,0 +1,107 @@
+/**
+ * TIM2 time base shared by the real-time clocks.
+ *
+ * TIM2 is the free-running 32-bit counter set up by MX_TIM2_Init(). The
+ * compare clock programs CCR1 with the next event deadline and sleeps on WFE
+ * until the compare flag is raised, instead of spinning on the counter.
+ * Board only.
+ */
+
+#ifndef RT_TIM2_CLOCK_HPP
+#define RT_TIM2_CLOCK_HPP
+
+#if defined(__arm__)
+
+#include <cstdint>
+
+extern "C"
+{
+#include "stm32h7xx_hal.h"
+#include "tim.h"
+}
+
+namespace cadmium
+{
+
+    // Seconds per TIM2 tick. TIM2 runs from the APB1 timer clock, which is twice PCLK1 when APB1 is divided
+    inline double tim2TickPeriod()
+    {
+        uint32_t timerClock = HAL_RCC_GetPCLK1Freq();
+        if ((RCC->D2CFGR & RCC_D2CFGR_D2PPRE1) != RCC_APB1_DIV1)
+        {
+            timerClock *= 2;
+        }
+        return (double)(htim2.Instance->PSC + 1) / timerClock;
+    }
+
+    /**
+     * Real-time clock driven by the TIM2 channel 1 compare match.
+     *
+     * TIM2 has no interrupt handler in this project, so the TIM2 line is masked
+     * in the NVIC and the compare interrupt is only used as a wake-up event
+     * (SEVONPEND): the core sleeps in WFE until the deadline. Deadlines further
+     * than 2^31 ticks away are reached in several compare steps, so the 32-bit
+     * counter wrapping is handled.
+     */
+    class Tim2CompareClock
+    {
+        double origin;       // Simulation time at start()
+        double tickPeriod;   // Seconds per TIM2 tick
+        uint32_t lastCount;  // Counter value at the last extension
+        uint64_t ticks;      // 64-bit ticks elapsed since start()
+
+        // Extend the 32-bit counter to 64 bits; called at least once per 2^31 ticks
+        uint64_t elapsedTicks()
+        {
+            uint32_t count = TIM2->CNT;
+            ticks += (uint32_t)(count - lastCount);
+            lastCount = count;
+            return ticks;
+        }
+
+    public:
+        Tim2CompareClock() : origin(0.0), tickPeriod(0.0), lastCount(0), ticks(0) {}
+
+        void start(double timeLast)
+        {
+            origin = timeLast;
+            tickPeriod = tim2TickPeriod();
+            lastCount = TIM2->CNT;
+            ticks = 0;
+            HAL_NVIC_DisableIRQ(TIM2_IRQn); // Pending bit only, no handler
+            SCB->SCR = SCB->SCR | SCB_SCR_SEVONPEND_Msk;
+            TIM2->DIER = TIM2->DIER | TIM_DIER_CC1IE;
+        }
+
+        void stop(double timeLast)
+        {
+            (void)timeLast;
+            TIM2->DIER = TIM2->DIER & ~TIM_DIER_CC1IE;
+            NVIC_ClearPendingIRQ(TIM2_IRQn);
+        }
+
+        double waitUntil(double timeNext)
+        {
+            uint64_t target = (uint64_t)((timeNext - origin) / tickPeriod);
+            for (uint64_t now = elapsedTicks(); now < target; now = elapsedTicks())
+            {
+                uint64_t remaining = target - now;
+                uint32_t step = remaining > 0x7FFFFFFFU ? 0x7FFFFFFFU : (uint32_t)remaining;
+                TIM2->CCR1 = lastCount + step;
+                TIM2->SR = ~TIM_SR_CC1IF; // rc_w0: only CC1IF is cleared
+                NVIC_ClearPendingIRQ(TIM2_IRQn);
+                // The match may already have passed while programming CCR1
+                while (!(TIM2->SR & TIM_SR_CC1IF) && (uint32_t)(TIM2->CNT - lastCount) < step)
+                {
+                    __WFE();
+                }
+            }
+            return timeNext;
+        }
+    };
+
+} // namespace cadmium
+
+#endif // __arm__
+
+#endif // RT_TIM2_CLOCK_HPP
@@ -0,0 +1,450 @@
+/**
+ * USB CDC (virtual COM port) output of the log stream.
+ *
+ * A minimal CDC-ACM device written directly on the HAL PCD driver, on the
+ * full-speed OTG port of the Nucleo USB connector (PA11/PA12, 48 MHz from
+ * HSI48): enumeration, line coding requests and one bulk IN endpoint. The
+ * text written to stdout (_write in main.cpp) goes to UsbCdc::stream; every
+ * bulk transfer takes up to LOG_STREAM_PACKET bytes straight from the ring.
+ * An idle endpoint is started by a full packet, or by UsbStreamClock<C> once
+ * the coordinator is idle; then each transfer-complete interrupt sends what
+ * was written meanwhile. The producer never waits for the link
+ * (log_stream.hpp for the backpressure policy).
+ *
+ * Defines the OTG_FS interrupt and the HAL_PCD callbacks: include from one
+ * translation unit only (main.cpp, with DEVS_USB_STREAM).
+ */
+
+#ifndef RT_USB_CDC_HPP
+#define RT_USB_CDC_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include "log_stream.hpp"
+
+extern "C"
+{
+#include "stm32h7xx_hal.h"
+}
+
+#ifndef USB_STREAM_BYTES
+#define USB_STREAM_BYTES 16384 // Log stream ring; a power of two
+#endif
+
+namespace cadmium
+{
+
+    class UsbCdc
+    {
+    public:
+        static inline LogStream<USB_STREAM_BYTES> stream;
+
+        // Clocks, pins and device start; the host then enumerates the port
+        static void init()
+        {
+            RCC_OscInitTypeDef osc = {};
+            osc.OscillatorType = RCC_OSCILLATORTYPE_HSI48;
+            osc.HSI48State = RCC_HSI48_ON;
+            osc.PLL.PLLState = RCC_PLL_NONE;
+            HAL_RCC_OscConfig(&osc);
+
+            RCC_PeriphCLKInitTypeDef clock = {};
+            clock.PeriphClockSelection = RCC_PERIPHCLK_USB;
+            clock.UsbClockSelection = RCC_USBCLKSOURCE_HSI48;
+            HAL_RCCEx_PeriphCLKConfig(&clock);
+            HAL_PWREx_EnableUSBVoltageDetector();
+
+            __HAL_RCC_GPIOA_CLK_ENABLE();
+            GPIO_InitTypeDef pins = {};
+            pins.Pin = GPIO_PIN_11 | GPIO_PIN_12;
+            pins.Mode = GPIO_MODE_AF_PP;
+            pins.Pull = GPIO_NOPULL;
+            pins.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+            pins.Alternate = GPIO_AF10_OTG2_FS;
+            HAL_GPIO_Init(GPIOA, &pins);
+            __HAL_RCC_USB2_OTG_FS_CLK_ENABLE();
+
+            pcd.Instance = USB_OTG_FS;
+            pcd.Init.dev_endpoints = 9;
+            pcd.Init.speed = PCD_SPEED_FULL;
+            pcd.Init.dma_enable = DISABLE;
+            pcd.Init.phy_itface = PCD_PHY_EMBEDDED;
+            pcd.Init.Sof_enable = DISABLE;
+            pcd.Init.low_power_enable = DISABLE;
+            pcd.Init.lpm_enable = DISABLE;
+            pcd.Init.battery_charging_enable = DISABLE;
+            pcd.Init.vbus_sensing_enable = DISABLE;
+            pcd.Init.use_dedicated_ep1 = DISABLE;
+            HAL_PCD_Init(&pcd);
+
+            // FIFOs in 32-bit words (1.25 KB in all): a whole bulk packet fits in the EP1 FIFO
+            HAL_PCDEx_SetRxFiFo(&pcd, 0x80);
+            HAL_PCDEx_SetTxFiFo(&pcd, 0, 0x10);
+            HAL_PCDEx_SetTxFiFo(&pcd, 1, 0x80);
+            HAL_PCDEx_SetTxFiFo(&pcd, 2, 0x10);
+
+            HAL_NVIC_SetPriority(OTG_FS_IRQn, 6, 0);
+            HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+            HAL_PCD_Start(&pcd);
+        }
+
+        // Text output (from _write); interrupts are masked so that threads can write too
+        static int write(const char *data, int len)
+        {
+            uint32_t primask = __get_PRIMASK();
+            __disable_irq();
+            stream.write(data, static_cast<uint32_t>(len));
+            if (!busy && configured)
+            {
+                send(false);
+            }
+            __set_PRIMASK(primask);
+            return len;
+        }
+
+        // Start a bulk transfer if the endpoint is idle; flush also sends a partial packet
+        static void kick(bool flush)
+        {
+            uint32_t primask = __get_PRIMASK();
+            __disable_irq();
+            if (!busy && configured)
+            {
+                send(flush);
+            }
+            __set_PRIMASK(primask);
+        }
+
+        [[nodiscard]] static bool connected() { return configured && (lineState & 0x01u) != 0; }
+
+        // PCD callbacks (interrupt context)
+        static void onSetup(PCD_HandleTypeDef *hpcd);
+        static void onDataIn(PCD_HandleTypeDef *hpcd, uint8_t epnum);
+        static void onDataOut(PCD_HandleTypeDef *hpcd, uint8_t epnum);
+        static void onReset(PCD_HandleTypeDef *hpcd);
+
+        static inline PCD_HandleTypeDef pcd = {};
+
+    private:
+        static constexpr uint8_t EP_DATA_IN = 0x81;
+        static constexpr uint8_t EP_DATA_OUT = 0x01;
+        static constexpr uint8_t EP_NOTIFY = 0x82;
+        static constexpr uint16_t EP0_SIZE = 64;
+        static constexpr uint16_t BULK_SIZE = 64; // Full-speed bulk packet; a LOG_STREAM_PACKET transfer spans 8 of them
+
+        static inline volatile bool busy = false;       // Bulk IN transfer in progress
+        static inline volatile bool configured = false; // SET_CONFIGURATION received
+        static inline volatile uint16_t lineState = 0;  // DTR (bit 0) and RTS (bit 1)
+        static inline uint32_t inFlight = 0;            // Bytes of the current bulk transfer (0: zero-length packet)
+
+        static inline const uint8_t *ep0Data = nullptr; // Control IN data still to send
+        static inline uint32_t ep0Left = 0;
+        static inline bool ep0Zlp = false;     // End the control IN data with a zero-length packet
+        static inline uint8_t ep0Out[8] = {};  // Control OUT data (line coding)
+        static inline uint8_t ep0Reply[2] = {};
+        static inline uint8_t lineCoding[7] = {0x00, 0xC2, 0x01, 0x00, 0x00, 0x00, 0x08}; // 115200 8N1, reported only
+        static inline uint8_t rxPacket[BULK_SIZE] = {}; // Received data, discarded
+
+        // Device and configuration descriptors: CDC-ACM, one interface pair
+        static constexpr uint8_t deviceDescriptor[18] = {
+            18, 0x01, 0x00, 0x02, 0x02, 0x02, 0x00, EP0_SIZE,
+            0x83, 0x04, 0x40, 0x57, // VID 0x0483 (ST), PID 0x5740 (virtual COM port)
+            0x00, 0x02, 1, 2, 3, 1};
+        static constexpr uint8_t configDescriptor[67] = {
+            9, 0x02, 67, 0, 2, 1, 0, 0xC0, 50,
+            // Communication interface, with header, call management, ACM and union descriptors
+            9, 0x04, 0, 0, 1, 0x02, 0x02, 0x01, 0,
+            5, 0x24, 0x00, 0x10, 0x01,
+            5, 0x24, 0x01, 0x00, 1,
+            4, 0x24, 0x02, 0x02,
+            5, 0x24, 0x06, 0, 1,
+            7, 0x05, EP_NOTIFY, 0x03, 8, 0, 0x10,
+            // Data interface
+            9, 0x04, 1, 0, 2, 0x0A, 0x00, 0x00, 0,
+            7, 0x05, EP_DATA_OUT, 0x02, BULK_SIZE, 0, 0,
+            7, 0x05, EP_DATA_IN, 0x02, BULK_SIZE, 0, 0};
+        static constexpr uint8_t languageString[4] = {4, 0x03, 0x09, 0x04};
+
+        // String descriptor n (1: manufacturer, 2: product, 3: serial) in UTF-16
+        static uint32_t stringDescriptor(uint8_t index, uint8_t *out)
+        {
+            static const char *const strings[] = {"STMicroelectronics", "DEVS lab log", "0001"};
+            const char *text = strings[index - 1];
+            uint32_t n = 2;
+            for (; *text != '\0' && n < 62; text++)
+            {
+                out[n++] = static_cast<uint8_t>(*text);
+                out[n++] = 0;
+            }
+            out[0] = static_cast<uint8_t>(n);
+            out[1] = 0x03;
+            return n;
+        }
+
+        // Next bulk transfer from the ring (interrupts disabled or interrupt context)
+        static void send(bool flush)
+        {
+            uint32_t len;
+            const uint8_t *data = stream.pending(len, flush);
+            if (data == nullptr)
+            {
+                return;
+            }
+            busy = true;
+            inFlight = len;
+            HAL_PCD_EP_Transmit(&pcd, EP_DATA_IN, const_cast<uint8_t *>(data), len);
+        }
+
+        static void controlIn(const uint8_t *data, uint32_t len, uint16_t requested)
+        {
+            len = len < requested ? len : requested;
+            ep0Data = data;
+            ep0Left = len;
+            ep0Zlp = len < requested && len % EP0_SIZE == 0;
+            continueControlIn();
+        }
+
+        static void continueControlIn()
+        {
+            uint32_t chunk = ep0Left < EP0_SIZE ? ep0Left : EP0_SIZE;
+            HAL_PCD_EP_Transmit(&pcd, 0x80, const_cast<uint8_t *>(ep0Data), chunk);
+            ep0Data += chunk;
+            ep0Left -= chunk;
+        }
+
+        static void controlStatusIn()
+        {
+            ep0Data = nullptr;
+            ep0Left = 0;
+            ep0Zlp = false;
+            HAL_PCD_EP_Transmit(&pcd, 0x80, nullptr, 0);
+        }
+
+        static void controlStall()
+        {
+            HAL_PCD_EP_SetStall(&pcd, 0x80);
+            HAL_PCD_EP_SetStall(&pcd, 0x00);
+        }
+    };
+
+    inline void UsbCdc::onSetup(PCD_HandleTypeDef *hpcd)
+    {
+        const uint8_t *setup = reinterpret_cast<const uint8_t *>(hpcd->Setup);
+        uint8_t type = setup[0];
+        uint8_t request = setup[1];
+        uint16_t value = static_cast<uint16_t>(setup[2] | setup[3] << 8);
+        uint16_t length = static_cast<uint16_t>(setup[6] | setup[7] << 8);
+        static uint8_t text[64];
+
+        if ((type & 0x60) == 0x20) // Class requests of the CDC interface
+        {
+            switch (request)
+            {
+            case 0x20: // SET_LINE_CODING: 7 bytes follow
+                HAL_PCD_EP_Receive(hpcd, 0x00, ep0Out, 7);
+                return;
+            case 0x21: // GET_LINE_CODING
+                controlIn(lineCoding, sizeof(lineCoding), length);
+                return;
+            case 0x22: // SET_CONTROL_LINE_STATE
+                lineState = value;
+                controlStatusIn();
+                return;
+            default:
+                controlStall();
+                return;
+            }
+        }
+
+        switch (request)
+        {
+        case 0x06: // GET_DESCRIPTOR
+            switch (value >> 8)
+            {
+            case 0x01:
+                controlIn(deviceDescriptor, sizeof(deviceDescriptor), length);
+                return;
+            case 0x02:
+                controlIn(configDescriptor, sizeof(configDescriptor), length);
+                return;
+            case 0x03:
+                if ((value & 0xFF) == 0)
+                {
+                    controlIn(languageString, sizeof(languageString), length);
+                    return;
+                }
+                if ((value & 0xFF) <= 3)
+                {
+                    controlIn(text, stringDescriptor(static_cast<uint8_t>(value & 0xFF), text), length);
+                    return;
+                }
+                break;
+            default:
+                break; // Device qualifier and others: full-speed only device
+            }
+            controlStall();
+            return;
+        case 0x05: // SET_ADDRESS
+            HAL_PCD_SetAddress(hpcd, static_cast<uint8_t>(value & 0x7F));
+            controlStatusIn();
+            return;
+        case 0x09: // SET_CONFIGURATION
+            if (value != 0 && !configured)
+            {
+                HAL_PCD_EP_Open(hpcd, EP_DATA_IN, BULK_SIZE, EP_TYPE_BULK);
+                HAL_PCD_EP_Open(hpcd, EP_DATA_OUT, BULK_SIZE, EP_TYPE_BULK);
+                HAL_PCD_EP_Open(hpcd, EP_NOTIFY, 8, EP_TYPE_INTR);
+                HAL_PCD_EP_Receive(hpcd, EP_DATA_OUT, rxPacket, BULK_SIZE);
+                busy = false;
+                configured = true;
+            }
+            controlStatusIn();
+            return;
+        case 0x08: // GET_CONFIGURATION
+            ep0Reply[0] = configured ? 1 : 0;
+            controlIn(ep0Reply, 1, length);
+            return;
+        case 0x00: // GET_STATUS: the device is self powered (board supply, as bmAttributes says), no remote wakeup
+            ep0Reply[0] = (type & 0x1F) == 0 ? 0x01 : 0x00;
+            ep0Reply[1] = 0;
+            controlIn(ep0Reply, 2, length);
+            return;
+        case 0x0A: // GET_INTERFACE
+            ep0Reply[0] = 0;
+            controlIn(ep0Reply, 1, length);
+            return;
+        case 0x01: // CLEAR_FEATURE
+        case 0x03: // SET_FEATURE
+        case 0x0B: // SET_INTERFACE
+            controlStatusIn();
+            return;
+        default:
+            controlStall();
+            return;
+        }
+    }
+
+    inline void UsbCdc::onDataIn(PCD_HandleTypeDef *hpcd, uint8_t epnum)
+    {
+        if (epnum == 0)
+        {
+            if (ep0Left > 0)
+            {
+                continueControlIn();
+            }
+            else if (ep0Zlp)
+            {
+                ep0Zlp = false;
+                HAL_PCD_EP_Transmit(hpcd, 0x80, nullptr, 0);
+            }
+            else if (ep0Data != nullptr)
+            {
+                ep0Data = nullptr;
+                HAL_PCD_EP_Receive(hpcd, 0x00, nullptr, 0); // Status stage of a control read
+            }
+        }
+        else if (epnum == (EP_DATA_IN & 0x7F))
+        {
+            bool packetBoundary = inFlight > 0 && inFlight % BULK_SIZE == 0;
+            stream.release(inFlight);
+            busy = false;
+            send(true); // What was written during the transfer, batched up to a packet
+            if (!busy && packetBoundary)
+            {
+                // Nothing follows a transfer of whole packets: end it with a zero-length packet so the host read completes
+                busy = true;
+                inFlight = 0;
+                HAL_PCD_EP_Transmit(hpcd, EP_DATA_IN, nullptr, 0);
+            }
+        }
+    }
+
+    inline void UsbCdc::onDataOut(PCD_HandleTypeDef *hpcd, uint8_t epnum)
+    {
+        if (epnum == 0)
+        {
+            if (hpcd->OUT_ep[0].xfer_count == 7)
+            {
+                std::memcpy(lineCoding, ep0Out, sizeof(lineCoding)); // SET_LINE_CODING data
+                controlStatusIn();
+            }
+        }
+        else if (epnum == EP_DATA_OUT)
+        {
+            HAL_PCD_EP_Receive(hpcd, EP_DATA_OUT, rxPacket, BULK_SIZE); // Nothing is read from the host
+        }
+    }
+
+    inline void UsbCdc::onReset(PCD_HandleTypeDef *hpcd)
+    {
+        HAL_PCD_EP_Open(hpcd, 0x00, EP0_SIZE, EP_TYPE_CTRL);
+        HAL_PCD_EP_Open(hpcd, 0x80, EP0_SIZE, EP_TYPE_CTRL);
+        if (busy)
+        {
+            stream.release(inFlight); // Aborted by the reset: the bytes are lost
+        }
+        busy = false;
+        configured = false;
+        lineState = 0;
+    }
+
+    /**
+     * UsbStreamClock<C>: real-time clock C that sends the partial packet of
+     * the log stream before waiting for each event.
+     */
+    template <class C>
+    class UsbStreamClock : public C
+    {
+    public:
+        template <typename... Args>
+        explicit UsbStreamClock(Args &&...args) : C(std::forward<Args>(args)...)
+        {
+        }
+
+        void stop(double timeLast)
+        {
+            std::fflush(stdout);
+            UsbCdc::kick(true);
+            C::stop(timeLast);
+        }
+
+        double waitUntil(double timeNext)
+        {
+            std::fflush(stdout);
+            UsbCdc::kick(true);
+            return C::waitUntil(timeNext);
+        }
+    };
+
+} // namespace cadmium
+
+extern "C"
+{
+    void OTG_FS_IRQHandler(void)
+    {
+        HAL_PCD_IRQHandler(&cadmium::UsbCdc::pcd);
+    }
+
+    void HAL_PCD_SetupStageCallback(PCD_HandleTypeDef *hpcd)
+    {
+        cadmium::UsbCdc::onSetup(hpcd);
+    }
+
+    void HAL_PCD_DataInStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
+    {
+        cadmium::UsbCdc::onDataIn(hpcd, epnum);
+    }
+
+    void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
+    {
+        cadmium::UsbCdc::onDataOut(hpcd, epnum);
+    }
+
+    void HAL_PCD_ResetCallback(PCD_HandleTypeDef *hpcd)
+    {
+        cadmium::UsbCdc::onReset(hpcd);
+    }
+}
+
+#endif // RT_USB_CDC_HPP
@@ -0,0 +1,97 @@
+/**
+ * Vectorised atomic model for homogeneous populations.
+ *
+ * N identical models (one classifier per room or sensor) cost N states behind
+ * N virtual interfaces, N scheduler entries and N output calls per period. A
+ * VectorAtomic holds the population as one atomic model instead: the state
+ * stores each field of the N members as an array (structure of arrays), and
+ * the internal transition runs one batch kernel over all lanes, written as
+ * plain loops over the arrays so that the compiler unrolls and vectorises
+ * them.
+ *
+ * Members are addressed by lane: inputs arrive as Lane<In> messages, which
+ * the population stores with accept(), and outputs leave as Lane<Out>
+ * messages, emit() only reporting the lanes whose output changed.
+ *
+ * Derived (CRTP) provides:
+ *  - void accept(S &state, uint32_t lane, const In &value) const,
+ *  - void step(S &state) const: the batch kernel, run every period,
+ *  - void emit(const S &state, const Port<Lane<Out>> &out) const.
+ * S must have a double sigma.
+ */
+
+#ifndef RT_VECTOR_ATOMIC_HPP
+#define RT_VECTOR_ATOMIC_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "cadmium/modeling/devs/atomic.hpp"
+
+namespace cadmium
+{
+
+    // Message to or from one member of a population
+    template <typename T>
+    struct Lane
+    {
+        uint32_t lane; // Index of the member
+        T value;
+    };
+
+    template <typename T>
+    inline std::ostream &operator<<(std::ostream &out, const Lane<T> &message)
+    {
+        out << message.lane << ":" << +message.value;
+        return out;
+    }
+
+    template <class Derived, class S, typename In, typename Out>
+    class VectorAtomic : public Atomic<S>
+    {
+    public:
+        Port<Lane<In>> in;   // Inputs of the members
+        Port<Lane<Out>> out; // Changed outputs of the members
+
+        double period; // Time between two batch steps
+
+        VectorAtomic(const std::string &id, const S &initial, double stepPeriod) : Atomic<S>(id, initial), period(stepPeriod)
+        {
+            in = this->template addInPort<Lane<In>>("in");
+            out = this->template addOutPort<Lane<Out>>("out");
+        }
+
+        // Batch step of every lane, then wait one period
+        void internalTransition(S &state) const override
+        {
+            derived().step(state);
+            state.sigma = period;
+        }
+
+        // Store the inputs of their lanes; they are taken into account at the next step
+        void externalTransition(S &state, double e) const override
+        {
+            state.sigma -= e;
+            for (const auto &message : in->getBag())
+            {
+                derived().accept(state, message.lane, message.value);
+            }
+        }
+
+        void output(const S &state) const override
+        {
+            derived().emit(state, out);
+        }
+
+        [[nodiscard]] double timeAdvance(const S &state) const override
+        {
+            return state.sigma;
+        }
+
+    private:
+        const Derived &derived() const { return static_cast<const Derived &>(*this); }
+    };
+
+} // namespace cadmium
+
+#endif // RT_VECTOR_ATOMIC_HPP
@@ -0,0 +1,87 @@
+/**
+ * Calls from an atomic model wrapper to the model it wraps.
+ *
+ * The wrappers (Profiled<M>, ChangeOnly<M>) derive from M and override the
+ * argument-less hooks of AtomicInterface (internalTransition(),
+ * externalTransition(e), confluentTransition(e), output()). To run the
+ * wrapped model they must call M's own version of the hook, not the virtual
+ * one (that is themselves) and not the Atomic<S> one (that skips any wrapper
+ * inside M):
+ *  - when M is itself a wrapper, or derives from one, the hook it overrides
+ *    is called as M::hook(),
+ *  - when M is a plain model, its state-taking overloads (output(const S &)...)
+ *    hide the hooks from M::, and Atomic<S>::hook() is what M inherits.
+ * WrappedModel<M> picks between the two, so wrappers compose in any order.
+ */
+
+#ifndef RT_WRAPPED_MODEL_HPP
+#define RT_WRAPPED_MODEL_HPP
+
+#include <utility>
+#include "cadmium/modeling/devs/atomic.hpp"
+
+namespace cadmium
+{
+
+    // Deduces S from a model deriving from Atomic<S>
+    template <typename S>
+    S wrappedStateOf(const Atomic<S> *);
+
+    // Non-virtual calls to the hooks of M (see above)
+    template <class M>
+    struct WrappedModel
+    {
+        using Base = Atomic<decltype(wrappedStateOf(std::declval<M *>()))>;
+
+        static void internalTransition(M &model)
+        {
+            if constexpr (requires(M &m) { m.M::internalTransition(); })
+            {
+                model.M::internalTransition();
+            }
+            else
+            {
+                model.Base::internalTransition();
+            }
+        }
+
+        static void externalTransition(M &model, double e)
+        {
+            if constexpr (requires(M &m, double d) { m.M::externalTransition(d); })
+            {
+                model.M::externalTransition(e);
+            }
+            else
+            {
+                model.Base::externalTransition(e);
+            }
+        }
+
+        static void confluentTransition(M &model, double e)
+        {
+            if constexpr (requires(M &m, double d) { m.M::confluentTransition(d); })
+            {
+                model.M::confluentTransition(e);
+            }
+            else
+            {
+                model.Base::confluentTransition(e);
+            }
+        }
+
+        static void output(M &model)
+        {
+            if constexpr (requires(M &m) { m.M::output(); })
+            {
+                model.M::output();
+            }
+            else
+            {
+                model.Base::output();
+            }
+        }
+    };
+
+} // namespace cadmium
+
+#endif // RT_WRAPPED_MODEL_HPP
@@ -2,7 +2,21 @@
 #include "cadmium/simulation/root_coordinator.hpp"
 #include "cadmium/simulation/rt_root_coordinator.hpp"
 #include "cadmium/simulation/logger/stdout.hpp"
+#include "include/deadline_monitor.hpp"
+
+#if defined(DEVS_RTOS_RUNTIME)
+#include "include/rtos_runtime.hpp"
+using BaseClock = cadmium::RtosClock; // Sleeps on the RTOS tick so worker threads can run
+#elif defined(__arm__) && defined(DEVS_HEAP_SCHEDULER)
+#include "include/tim2_clock.hpp"
+using BaseClock = cadmium::Tim2CompareClock; // Sleeps until the TIM2 compare match of the next event
+#elif defined(__arm__)
 #include "cadmium/simulation/rt_clock/stm32_rt_clock.hpp"
+using BaseClock = STM32Clock<double>;
+#else
+#include "cadmium/simulation/rt_clock/chrono.hpp"
+using BaseClock = cadmium::ChronoClock<>; // Host build: wall clock from std::chrono
+#endif
 
 extern "C"
 {
@@ -10,34 +24,144 @@ extern "C"
 #include "tim.h"
 }
 
-int main()
+#ifdef DEVS_DEADLINE_MONITOR
+using MonitoredClock = cadmium::DeadlineMonitoredClock<BaseClock>; // Clock with lateness tracking
+#else
+using MonitoredClock = BaseClock;
+#endif
+
+#ifdef DEVS_HW_RECORD
+#include "include/hw_trace.hpp"
+using RecordingClock = cadmium::HwRecordingClock<MonitoredClock>; // Prints the recorded hardware reads while idle
+#else
+using RecordingClock = MonitoredClock;
+#endif
+
+#ifdef DEVS_USB_STREAM
+#include "include/usb_cdc.hpp"
+using RTClock = cadmium::UsbStreamClock<RecordingClock>; // Sends the partial USB packet while idle
+
+// stdout (log lines and reports) goes to the USB CDC stream instead of __io_putchar
+extern "C" int _write(int file, char *ptr, int len)
 {
-  MX_TIM2_Init();             // Initialize timer 2 (generated by CubeMX)
-  HAL_TIM_Base_Start(&htim2); // Start timer 2 in base mode
+  (void)file;
+  return cadmium::UsbCdc::write(ptr, len);
+}
+#else
+using RTClock = RecordingClock;
+#endif
 
-  MX_TIM4_Init();                           // Initialize timer 4 (generated by CubeMX)
-  HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_1); // Start PWM on timer 4 channel 1
+#ifdef DEVS_HEAP_SCHEDULER
+#include "include/heap_coordinator.hpp"
+using SimCoordinator = cadmium::HeapRootCoordinator<RTClock>; // O(log n) event heap
+#else
+using SimCoordinator = cadmium::RealTimeRootCoordinator<RTClock>;
+#endif
 
-  MX_TIM6_Init();             // Initialize timer 6 (generated by CubeMX)
-  HAL_TIM_Base_Start(&htim6); // Start timer 6 in base mode
+#ifdef DEVS_BUILDING_SCALING
+#include "include/building.hpp"
+#endif
 
-  MX_ADC1_Init(); // Initialize ADC1
+#ifndef SIM_DURATION
+#define SIM_DURATION 10000.0 // Simulated time in seconds
+#endif
+
+// Build the model and run the real-time simulation (coordinator thread body in RTOS mode)
+static void runSimulation(void *)
+{
+#ifdef DEVS_BUILDING_SCALING
+  // Scaling figures of the multi-room building (1 to 32 rooms, 20 s each) instead of the lab run
+  cadmium::BuildingScaling::sweep<cadmium::BuildingRoom>(32, 20.0, &hadc1, cadmium::profilerStdoutSink);
+  return;
+#endif
 
   // Create a shared instance of the main coupled model "top_coupled"
   auto model = std::make_shared<top_coupled>("top_coupled");
+  cadmium::BootSequencer::mark("models");
+
+#ifdef DEVS_CHECKPOINT
+  // Warm restart: resume the persistent states from the last snapshot, before the coordinator reads their time advance
+  bool restored = cadmium::Checkpoint<>::restore();
+  std::printf("checkpoint;%s;%lu\n", restored ? "restored" : "cold", (unsigned long)cadmium::Checkpoint<>::lastSequence());
+  cadmium::BootSequencer::mark("checkpoint_restore");
+#endif
 
-  STM32Clock<double> clock; // Create STM32 real-time clock object
+  RTClock clock; // Create STM32 real-time clock object
 
-  // Create Cadmium real-time root coordinator with the model and STM32 clock
-  auto rootCoordinator = cadmium::RealTimeRootCoordinator<STM32Clock<double>>(model, clock);
+#ifdef DEVS_DEADLINE_MONITOR
+  // Count a miss above 5 ms of lateness, re-anchor the clock when more than 2 s behind
+  cadmium::DeadlineMonitor::configure(0.005, 2.0, cadmium::LagPolicy::Skip);
+#endif
 
+  // Create the real-time root coordinator with the model and STM32 clock
+  auto rootCoordinator = SimCoordinator(model, clock);
+
+#ifdef DEVS_RTOS_RUNTIME
+  rootCoordinator.setLogger<cadmium::QueuedLogger>(";"); // Log lines are written by the log worker thread
+#else
   rootCoordinator.setLogger<cadmium::STDOUTLogger>(";"); // Set logger to write to standard output
+#endif
+
+  cadmium::BootSequencer::mark("coordinator");
+
+  cadmium::BootSequencer::awaitAdcCalibration(); // First conversion happens at the first event
+  cadmium::BootSequencer::mark("adc_calibration");
+#ifdef DEVS_BOOT_REPORT
+  cadmium::BootSequencer::report(cadmium::profilerStdoutSink); // Boot-time breakdown, up to the first event
+#endif
 
   rootCoordinator.start(); // Start the simulation
 
-  rootCoordinator.simulate(10000.0); // Run simulation for 10,000 time units (ms, s, depending on definition)
+  rootCoordinator.simulate(static_cast<double>(SIM_DURATION)); // Run simulation for SIM_DURATION seconds (10,000 by default)
 
   rootCoordinator.stop(); // Stop the simulation
 
+#ifdef DEVS_PROFILING
+  cadmium::Profiler::report(cadmium::profilerStdoutSink); // Dump per-model transition timings
+#endif
+#ifdef DEVS_DEADLINE_MONITOR
+  cadmium::DeadlineMonitor::report(cadmium::profilerStdoutSink); // Dump lateness and missed deadlines
+#endif
+#ifdef DEVS_TELEMETRY
+  static constexpr double windows[] = {60.0, 600.0, 3600.0}; // Last minute, 10 minutes and hour
+  cadmium::telemetryStore.report(cadmium::profilerStdoutSink, windows, 3);
+#endif
+}
+
+int main()
+{
+  cadmium::BootSequencer::mark("static_init");
+
+  MX_ADC1_Init();                                      // Initialize ADC1 first
+  cadmium::BootSequencer::beginAdcCalibration(&hadc1); // Calibration runs while the rest is set up
+  cadmium::BootSequencer::mark("adc_init");
+
+  MX_TIM2_Init();             // Initialize timer 2 (generated by CubeMX)
+  HAL_TIM_Base_Start(&htim2); // Start timer 2 in base mode
+
+  MX_TIM4_Init();                           // Initialize timer 4 (generated by CubeMX)
+  HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_1); // Start PWM on timer 4 channel 1
+
+  MX_TIM6_Init();             // Initialize timer 6 (generated by CubeMX)
+  HAL_TIM_Base_Start(&htim6); // Start timer 6 in base mode
+  cadmium::BootSequencer::mark("timers");
+
+#ifdef DEVS_CHECKPOINT
+  MX_CRC_Init(); // CRC of the checkpoint snapshots
+#endif
+
+#ifdef DEVS_USB_STREAM
+  cadmium::UsbCdc::init(); // Virtual COM port for stdout
+#endif
+
+#ifdef DEVS_RTOS_RUNTIME
+  osKernelInitialize();                                       // Initialize the RTOS kernel
+  cadmium::RtosRuntime::start(&hadc1);                        // ADC, DHT11 and log worker threads
+  cadmium::RtosRuntime::spawnCoordinator(runSimulation, NULL); // Coordinator thread
+  osKernelStart();                                            // Never returns on the board
+#else
+  runSimulation(NULL);
+#endif
+
   return 0;
-}
\ No newline at end of file
+}